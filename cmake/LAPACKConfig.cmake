@@ -70,6 +70,39 @@ else()
     message( "${red}   XBLAS not found.${plain}" )
 endif()
 
+#-------------------------------------------------------------------------------
+# Vendor, for lapack::set_num_threads and ThreadScope.
+message( STATUS "Checking for MKL or OpenBLAS" )
+
+set( vendor_list "mkl_version;openblas_version" )
+foreach (vendor IN LISTS vendor_list)
+    try_run(
+        run_result compile_result ${CMAKE_CURRENT_BINARY_DIR}
+        SOURCES
+            "${CMAKE_CURRENT_SOURCE_DIR}/config/${vendor}.cc"
+        LINK_LIBRARIES
+            ${LAPACK_LIBRARIES} ${blaspp_libraries}
+        COMPILE_DEFINITIONS
+            ${blaspp_defines}
+        COMPILE_OUTPUT_VARIABLE
+            compile_output
+        RUN_OUTPUT_VARIABLE
+            run_output
+    )
+    debug_try_run( "${vendor}.cc" "${compile_result}" "${compile_output}"
+                                  "${run_result}" "${run_output}" )
+
+    if (compile_result AND "${run_output}" MATCHES "MKL_VERSION=([0-9.]+)")
+        message( "${blue}   Found MKL ${CMAKE_MATCH_1}${plain}" )
+        list( APPEND lapackpp_defs_ "-DLAPACK_HAVE_MKL" )
+        break()
+    elseif (compile_result AND "${run_output}" MATCHES "OPENBLAS_VERSION=")
+        message( "${blue}   Found OpenBLAS${plain}" )
+        list( APPEND lapackpp_defs_ "-DLAPACK_HAVE_OPENBLAS" )
+        break()
+    endif()
+endforeach()
+
 #-------------------------------------------------------------------------------
 # Find LAPACKE, either in the BLAS/LAPACK library or in -llapacke.
 # Check for pstrf (Cholesky with pivoting).
@@ -8,6 +8,8 @@
 
 #include "lapack/defines.h"
 
+#include <cstdint>
+
 // Version is updated by make_release.py; DO NOT EDIT.
 // Version 2022.07.00
 #define LAPACKPP_VERSION 20220700
@@ -17,8 +19,19 @@ namespace lapack {
 int lapackpp_version();
 const char* lapackpp_id();
 
+int64_t workspace_bytes();
+int64_t workspace_high_water();
+void workspace_reset_high_water();
+
 }  // namespace lapack
 
 #include "lapack/wrappers.hh"
+#ifdef LAPACK_INLINE_WRAPPERS
+    #include "lapack/inline.hh"
+#endif
+#include "lapack/tuning.hh"
+#include "lapack/threads.hh"
+#include "lapack/factor.hh"
+#include "lapack/update.hh"
 
 #endif // LAPACK_HH
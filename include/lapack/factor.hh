@@ -0,0 +1,635 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_FACTOR_HH
+#define LAPACK_FACTOR_HH
+
+#include "lapack/util.hh"
+#include "lapack/NoConstructAllocator.hh"
+
+namespace lapack {
+
+// -----------------------------------------------------------------------------
+// Factorization objects. Each owns its factor, pivots, and workspace, sized
+// for its shape when constructed or resized, so refactoring a new matrix of
+// the same shape, solving, and estimating rcond don't allocate, e.g., for
+// a time-stepping loop:
+//
+//     lapack::LU< double > lu( n, n );
+//     for (int step = 0; step < nsteps; ++step) {
+//         update_matrix( step, A, lda );
+//         if (lu.factor( A, lda ) != 0)
+//             ...  // singular
+//         lu.solve( lapack::Op::NoTrans, nrhs, B, ldb );
+//     }
+//
+// factor( A, lda ) copies A into the object, then factors it;
+// alternatively, fill data() in place and call factor().
+// It returns LAPACK's info: 0 on success, > 0 if the matrix is singular
+// (LU, LDLT) or not positive definite (Cholesky). solve, logdet, and rcond
+// throw Error if there is no successful factorization.
+// Storage is lapack::vector, so it isn't zero filled, and counts toward
+// workspace_high_water(). Objects can be moved, but not copied.
+// Instantiated for float, double, std::complex<float>, std::complex<double>.
+
+// -----------------------------------------------------------------------------
+/// LU factorization with partial pivoting, $A = P L U$, of an m-by-n matrix,
+/// as computed by getrf. solve, logdet, and rcond require m = n.
+/// @ingroup gesv_computational
+template <typename scalar_t>
+class LU {
+public:
+    using real_t = blas::real_type< scalar_t >;
+
+    LU();
+    LU( int64_t m, int64_t n );
+
+    LU( LU const& ) = delete;
+    LU& operator = ( LU const& ) = delete;
+    LU( LU&& ) = default;
+    LU& operator = ( LU&& ) = default;
+
+    void resize( int64_t m, int64_t n );
+
+    int64_t factor( scalar_t const* A, int64_t lda );
+    int64_t factor();
+
+    void solve( lapack::Op trans, int64_t nrhs,
+                scalar_t* B, int64_t ldb ) const;
+
+    real_t logdet( scalar_t* sign = nullptr ) const;
+    real_t rcond( lapack::Norm norm = lapack::Norm::One );
+
+    int64_t m()    const { return m_; }
+    int64_t n()    const { return n_; }
+    int64_t info() const { return info_; }
+
+    /// @return factor L and U, m-by-n, column-major with leading dimension
+    /// lda(). Before factor(), holds the matrix to factor.
+    scalar_t*       data()       { return A_.data(); }
+    scalar_t const* data() const { return A_.data(); }
+    int64_t lda() const { return lda_; }
+
+    /// @return pivots, 1-based as from getrf; length min( m, n ).
+    lapack_int const* ipiv() const { return ipiv_.data(); }
+
+private:
+    int64_t m_, n_, lda_, info_;
+    bool factored_;
+    real_t anorm_one_, anorm_inf_;
+    lapack::vector< scalar_t > A_;
+    lapack::vector< lapack_int > ipiv_;
+    lapack::vector< scalar_t > work_;
+    lapack::vector< real_t > rwork_;
+    lapack::vector< lapack_int > iwork_;
+};
+
+// -----------------------------------------------------------------------------
+/// Cholesky factorization, $A = L L^H$ or $A = U^H U$, of an n-by-n
+/// Hermitian positive definite matrix, as computed by potrf. Only the uplo
+/// triangle of A is used.
+/// @ingroup posv_computational
+template <typename scalar_t>
+class Cholesky {
+public:
+    using real_t = blas::real_type< scalar_t >;
+
+    explicit Cholesky( lapack::Uplo uplo = lapack::Uplo::Lower );
+    Cholesky( lapack::Uplo uplo, int64_t n );
+
+    Cholesky( Cholesky const& ) = delete;
+    Cholesky& operator = ( Cholesky const& ) = delete;
+    Cholesky( Cholesky&& ) = default;
+    Cholesky& operator = ( Cholesky&& ) = default;
+
+    void resize( int64_t n );
+
+    int64_t factor( scalar_t const* A, int64_t lda );
+    int64_t factor();
+
+    void solve( int64_t nrhs, scalar_t* B, int64_t ldb ) const;
+
+    real_t logdet() const;
+    real_t rcond();
+
+    lapack::Uplo uplo() const { return uplo_; }
+    int64_t n()    const { return n_; }
+    int64_t info() const { return info_; }
+
+    /// @return factor L or U in the uplo triangle, n-by-n, column-major with
+    /// leading dimension lda(). Before factor(), holds the matrix to factor.
+    scalar_t*       data()       { return A_.data(); }
+    scalar_t const* data() const { return A_.data(); }
+    int64_t lda() const { return lda_; }
+
+private:
+    lapack::Uplo uplo_;
+    int64_t n_, lda_, info_;
+    bool factored_;
+    real_t anorm_;
+    lapack::vector< scalar_t > A_;
+    lapack::vector< scalar_t > work_;
+    lapack::vector< real_t > rwork_;
+    lapack::vector< lapack_int > iwork_;
+};
+
+// -----------------------------------------------------------------------------
+/// Symmetric indefinite factorization with Bunch-Kaufman pivoting,
+/// $A = L D L^H$ or $A = U D U^H$, of an n-by-n Hermitian matrix, as
+/// computed by hetrf (sytrf for real types). D is block diagonal with
+/// 1-by-1 and 2-by-2 blocks. Only the uplo triangle of A is used.
+/// @ingroup hesv_computational
+template <typename scalar_t>
+class LDLT {
+public:
+    using real_t = blas::real_type< scalar_t >;
+
+    explicit LDLT( lapack::Uplo uplo = lapack::Uplo::Lower );
+    LDLT( lapack::Uplo uplo, int64_t n );
+
+    LDLT( LDLT const& ) = delete;
+    LDLT& operator = ( LDLT const& ) = delete;
+    LDLT( LDLT&& ) = default;
+    LDLT& operator = ( LDLT&& ) = default;
+
+    void resize( int64_t n );
+
+    int64_t factor( scalar_t const* A, int64_t lda );
+    int64_t factor();
+
+    void solve( int64_t nrhs, scalar_t* B, int64_t ldb ) const;
+
+    real_t logdet( real_t* sign = nullptr ) const;
+    real_t rcond();
+
+    lapack::Uplo uplo() const { return uplo_; }
+    int64_t n()    const { return n_; }
+    int64_t info() const { return info_; }
+
+    /// @return factors L or U, and D, as from hetrf, n-by-n, column-major
+    /// with leading dimension lda(). Before factor(), holds the matrix.
+    scalar_t*       data()       { return A_.data(); }
+    scalar_t const* data() const { return A_.data(); }
+    int64_t lda() const { return lda_; }
+
+    /// @return pivots as from hetrf; length n.
+    lapack_int const* ipiv() const { return ipiv_.data(); }
+
+private:
+    lapack::Uplo uplo_;
+    int64_t n_, lda_, info_;
+    bool factored_;
+    real_t anorm_;
+    lapack::vector< scalar_t > A_;
+    lapack::vector< lapack_int > ipiv_;
+    lapack::vector< scalar_t > work_;
+    lapack::vector< real_t > rwork_;
+    lapack::vector< lapack_int > iwork_;
+};
+
+// -----------------------------------------------------------------------------
+/// QR factorization, $A = Q R$, of an m-by-n matrix, as computed by geqrf.
+/// solve and rcond require m >= n.
+/// @ingroup geqrf
+template <typename scalar_t>
+class QR {
+public:
+    using real_t = blas::real_type< scalar_t >;
+
+    QR();
+    QR( int64_t m, int64_t n );
+
+    QR( QR const& ) = delete;
+    QR& operator = ( QR const& ) = delete;
+    QR( QR&& ) = default;
+    QR& operator = ( QR&& ) = default;
+
+    void resize( int64_t m, int64_t n );
+
+    int64_t factor( scalar_t const* A, int64_t lda );
+    int64_t factor();
+
+    void solve( int64_t nrhs, scalar_t* B, int64_t ldb );
+
+    void apply_Q( lapack::Side side, lapack::Op trans,
+                  int64_t mc, int64_t nc, scalar_t* C, int64_t ldc );
+
+    real_t rcond( lapack::Norm norm = lapack::Norm::One );
+
+    int64_t m() const { return m_; }
+    int64_t n() const { return n_; }
+
+    /// @return R in the upper triangle and Householder vectors below it,
+    /// as from geqrf, m-by-n, column-major with leading dimension lda().
+    /// Before factor(), holds the matrix to factor.
+    scalar_t*       data()       { return A_.data(); }
+    scalar_t const* data() const { return A_.data(); }
+    int64_t lda() const { return lda_; }
+
+    /// @return Householder scalars; length min( m, n ).
+    scalar_t const* tau() const { return tau_.data(); }
+
+private:
+    int64_t m_, n_, lda_;
+    bool factored_;
+    lapack::vector< scalar_t > A_;
+    lapack::vector< scalar_t > tau_;
+    lapack::vector< scalar_t > work_;
+    lapack::vector< real_t > rwork_;
+    lapack::vector< lapack_int > iwork_;
+};
+
+// -----------------------------------------------------------------------------
+/// Least squares, $\min_X || W^{1/2} (B - A X) ||_F$, for a tall A whose rows
+/// arrive in blocks, e.g., streamed from disk, without storing A.
+/// Keeps the n-by-n triangle R and the n-by-nrhs $Q^H B$, combining them with
+/// each new row block via tpqrt and tpmqrt (incremental TSQR), so memory is
+/// O(n^2 + n nrhs) regardless of the number of rows. Can solve at any point:
+///
+///     lapack::StreamingLS< double > ls( n, nrhs );
+///     while (read_rows( &mb, A, lda, B, ldb ))
+///         ls.add( mb, A, lda, B, ldb );
+///     ls.solve( X, ldx );
+///
+/// Requires LAPACK >= 3.4.
+/// @ingroup gels
+template <typename scalar_t>
+class StreamingLS {
+public:
+    using real_t = blas::real_type< scalar_t >;
+
+    StreamingLS();
+    StreamingLS( int64_t n, int64_t nrhs = 1 );
+
+    StreamingLS( StreamingLS const& ) = delete;
+    StreamingLS& operator = ( StreamingLS const& ) = delete;
+    StreamingLS( StreamingLS&& ) = default;
+    StreamingLS& operator = ( StreamingLS&& ) = default;
+
+    void resize( int64_t n, int64_t nrhs = 1 );
+    void reset();
+
+    void add( int64_t mb,
+              scalar_t const* A, int64_t lda,
+              scalar_t const* B, int64_t ldb,
+              real_t const* weights = nullptr );
+
+    void solve( scalar_t* X, int64_t ldx ) const;
+
+    void residual_norm( real_t* rnorm ) const;
+
+    int64_t n()    const { return n_; }
+    int64_t nrhs() const { return nrhs_; }
+
+    /// @return number of rows added since construction, resize, or reset.
+    int64_t rows() const { return rows_; }
+
+    /// @return current n-by-n upper triangular R, column-major with leading
+    /// dimension ldr().
+    scalar_t const* R() const { return R_.data(); }
+    int64_t ldr() const { return ldr_; }
+
+    /// @return current n-by-nrhs $Q^H B$, with leading dimension ldr().
+    scalar_t const* QHB() const { return C_.data(); }
+
+private:
+    int64_t n_, nrhs_, nb_, chunk_, ldr_, rows_;
+    lapack::vector< scalar_t > R_;
+    lapack::vector< scalar_t > C_;
+    lapack::vector< scalar_t > T_;
+    lapack::vector< scalar_t > Ablk_;
+    lapack::vector< scalar_t > Bblk_;
+    lapack::vector< real_t > sqrtw_;
+    lapack::vector< real_t > rnorm2_;
+};
+
+// -----------------------------------------------------------------------------
+/// Shifted solves, $(A - \sigma I) X = B$, for many shifts $\sigma$ with the
+/// same n-by-n A, e.g., for frequency response sweeps. factor reduces A once
+/// to Hessenberg form, $A = Q H Q^H$, with gehrd and unghr, in O(n^3). Then
+/// each shift costs O(n^2) to factor the Hessenberg $H - \sigma I$ by LU with
+/// partial pivoting, plus O(n^2 nrhs) to apply Q and solve, instead of
+/// O(n^3) for gesv:
+///
+///     lapack::ShiftedHessenberg< std::complex<double> > hess( n );
+///     hess.factor( A, lda );
+///     hess.solve( nshift, sigma, nrhs, B, ldb, X, ldx );
+///
+/// For real A with complex shifts, use a complex type.
+/// @ingroup gesv_computational
+template <typename scalar_t>
+class ShiftedHessenberg {
+public:
+    using real_t = blas::real_type< scalar_t >;
+
+    ShiftedHessenberg();
+    explicit ShiftedHessenberg( int64_t n );
+
+    ShiftedHessenberg( ShiftedHessenberg const& ) = delete;
+    ShiftedHessenberg& operator = ( ShiftedHessenberg const& ) = delete;
+    ShiftedHessenberg( ShiftedHessenberg&& ) = default;
+    ShiftedHessenberg& operator = ( ShiftedHessenberg&& ) = default;
+
+    void resize( int64_t n );
+
+    int64_t factor( scalar_t const* A, int64_t lda );
+    int64_t factor();
+
+    void solve( scalar_t sigma, int64_t nrhs, scalar_t* B, int64_t ldb );
+
+    void solve( int64_t nshift, scalar_t const* sigma,
+                int64_t nrhs, scalar_t const* B, int64_t ldb,
+                scalar_t* X, int64_t ldx );
+
+    int64_t n() const { return n_; }
+
+    /// @return H in the upper Hessenberg part and Householder vectors below
+    /// it, as from gehrd, n-by-n, column-major with leading dimension lda().
+    /// Before factor(), holds the matrix to factor.
+    scalar_t*       data()       { return H_.data(); }
+    scalar_t const* data() const { return H_.data(); }
+    int64_t lda() const { return lda_; }
+
+    /// @return unitary Q, n-by-n, with leading dimension lda().
+    scalar_t const* Q() const { return Q_.data(); }
+
+private:
+    int64_t n_, lda_;
+    bool factored_;
+    lapack::vector< scalar_t > H_;
+    lapack::vector< scalar_t > Q_;
+    lapack::vector< scalar_t > tau_;
+    lapack::vector< scalar_t > work_;
+    lapack::vector< scalar_t > U_;
+    lapack::vector< scalar_t > ell_;
+    lapack::vector< char > swap_;
+    lapack::vector< scalar_t > C_;
+};
+
+// -----------------------------------------------------------------------------
+/// Shifted solves, $(A - \sigma I) X = B$, for many shifts $\sigma$ with the
+/// same n-by-n Hermitian A, e.g., Green's functions over many energies.
+/// factor reduces A once to real symmetric tridiagonal form, $A = Q T Q^H$,
+/// with hetrd and ungtr, in O(n^3). Then each shift costs O(n nrhs) to solve
+/// the tridiagonal $T - \sigma I$ with gtsv, plus O(n^2 nrhs) to apply Q,
+/// which is done for a block of shifts at a time with one gemm:
+///
+///     lapack::ShiftedHermitian< std::complex<double> > herm( uplo, n );
+///     herm.factor( A, lda );
+///     herm.solve( nshift, sigma, nrhs, B, ldb, X, ldx );
+///
+/// Only the uplo triangle of A is used. For complex shifts, e.g.,
+/// $E + i\eta$, use a complex type.
+/// @ingroup hesv_computational
+template <typename scalar_t>
+class ShiftedHermitian {
+public:
+    using real_t = blas::real_type< scalar_t >;
+
+    explicit ShiftedHermitian( lapack::Uplo uplo = lapack::Uplo::Lower );
+    ShiftedHermitian( lapack::Uplo uplo, int64_t n );
+
+    ShiftedHermitian( ShiftedHermitian const& ) = delete;
+    ShiftedHermitian& operator = ( ShiftedHermitian const& ) = delete;
+    ShiftedHermitian( ShiftedHermitian&& ) = default;
+    ShiftedHermitian& operator = ( ShiftedHermitian&& ) = default;
+
+    void resize( int64_t n );
+
+    int64_t factor( scalar_t const* A, int64_t lda );
+    int64_t factor();
+
+    void solve( scalar_t sigma, int64_t nrhs, scalar_t* B, int64_t ldb );
+
+    void solve( int64_t nshift, scalar_t const* sigma,
+                int64_t nrhs, scalar_t const* B, int64_t ldb,
+                scalar_t* X, int64_t ldx );
+
+    lapack::Uplo uplo() const { return uplo_; }
+    int64_t n() const { return n_; }
+
+    /// @return Householder vectors, as from hetrd, n-by-n, column-major with
+    /// leading dimension lda(). Before factor(), holds the matrix to factor.
+    scalar_t*       data()       { return A_.data(); }
+    scalar_t const* data() const { return A_.data(); }
+    int64_t lda() const { return lda_; }
+
+    /// @return unitary Q, n-by-n, with leading dimension lda().
+    scalar_t const* Q() const { return Q_.data(); }
+
+    /// @return diagonal of T, length n, and off-diagonal, length n - 1.
+    real_t const* D() const { return D_.data(); }
+    real_t const* E() const { return E_.data(); }
+
+private:
+    lapack::Uplo uplo_;
+    int64_t n_, lda_;
+    bool factored_;
+    lapack::vector< scalar_t > A_;
+    lapack::vector< scalar_t > Q_;
+    lapack::vector< real_t > D_;
+    lapack::vector< real_t > E_;
+    lapack::vector< scalar_t > tau_;
+    lapack::vector< scalar_t > work_;
+    lapack::vector< scalar_t > tridiag_;
+    lapack::vector< scalar_t > C_;
+    lapack::vector< scalar_t > Y_;
+};
+
+// -----------------------------------------------------------------------------
+/// Generalized Hermitian-definite eigenvalue problems with the same n-by-n
+/// Hermitian positive definite B for many A, e.g., vibration modes with a
+/// fixed mass matrix:
+///     itype = 1: $A x = \lambda B x$;
+///     itype = 2: $A B x = \lambda x$;
+///     itype = 3: $B A x = \lambda x$.
+/// factor computes the Cholesky factor of B once with potrf, or set_factor
+/// takes one already computed. Each solve then does only what hegvd does
+/// after potrf: hegst to reduce A to standard form, heevd, and a triangular
+/// solve or multiply to back-transform the eigenvectors:
+///
+///     lapack::GeneralizedEigen< double > geig( 1, lapack::Uplo::Lower, n );
+///     geig.factor( B, ldb );
+///     for (int64_t i = 0; i < count; ++i)
+///         geig.solve( lapack::Job::Vec, A[ i ], lda, W[ i ] );
+///
+/// or geig.solve( lapack::Job::Vec, count, A, lda, W, ldw ) to solve all of
+/// them in parallel. Only the uplo triangles of A and B are used.
+/// @ingroup hygv
+template <typename scalar_t>
+class GeneralizedEigen {
+public:
+    using real_t = blas::real_type< scalar_t >;
+
+    explicit GeneralizedEigen( int64_t itype = 1,
+                               lapack::Uplo uplo = lapack::Uplo::Lower );
+    GeneralizedEigen( int64_t itype, lapack::Uplo uplo, int64_t n );
+
+    GeneralizedEigen( GeneralizedEigen const& ) = delete;
+    GeneralizedEigen& operator = ( GeneralizedEigen const& ) = delete;
+    GeneralizedEigen( GeneralizedEigen&& ) = default;
+    GeneralizedEigen& operator = ( GeneralizedEigen&& ) = default;
+
+    void resize( int64_t n );
+
+    int64_t factor( scalar_t const* B, int64_t ldb );
+    int64_t factor();
+
+    void set_factor( scalar_t const* L, int64_t ldl );
+
+    int64_t solve( lapack::Job jobz, scalar_t* A, int64_t lda, real_t* W );
+
+    int64_t solve( lapack::Job jobz, int64_t batch,
+                   scalar_t* const* Aarray, int64_t lda,
+                   real_t* W, int64_t ldw );
+
+    int64_t itype() const { return itype_; }
+    lapack::Uplo uplo() const { return uplo_; }
+    int64_t n()    const { return n_; }
+    int64_t info() const { return info_; }
+
+    /// @return Cholesky factor of B in the uplo triangle, as from potrf,
+    /// n-by-n, column-major with leading dimension lda().
+    /// Before factor(), holds B to factor.
+    scalar_t*       data()       { return B_.data(); }
+    scalar_t const* data() const { return B_.data(); }
+    int64_t lda() const { return lda_; }
+
+private:
+    int64_t itype_;
+    lapack::Uplo uplo_;
+    int64_t n_, lda_, info_;
+    bool factored_;
+    lapack::vector< scalar_t > B_;
+    lapack::vector< scalar_t > work_;
+    lapack::vector< real_t > rwork_;
+    lapack::vector< lapack_int > iwork_;
+};
+
+// -----------------------------------------------------------------------------
+/// Linear equality-constrained least squares (LSE), as solved by gglse,
+///     $\min_x || c - A x ||_2$ subject to $B x = d$,
+/// for m-by-n A and p-by-n B, with p <= n <= m + p, when B is fixed while A,
+/// c, and d change, e.g., model predictive control with fixed constraints.
+/// factor_B computes the RQ factorization $B = (0, T_{12}) Q$ with gerqf
+/// once. Each factor_A then forms $A Q^H = (A_1, A_2)$ with unmrq and the
+/// QR factorization of the m-by-(n-p) $A_1$ with geqrf, instead of gglse
+/// refactoring both. solve handles many (c, d) right-hand sides at once with
+/// Level 3 BLAS:
+///
+///     lapack::LSE< double > lse( m, n, p );
+///     lse.factor_B( B, ldb );
+///     for (int tick = 0; tick < nticks; ++tick) {
+///         update_objective( tick, A, lda, C, ldc, D, ldd );
+///         lse.factor_A( A, lda );
+///         lse.solve( nrhs, C, ldc, D, ldd, X, ldx );
+///     }
+///
+/// factor_B and factor_A return 0 on success, or i > 0 if $T_{12}(i,i)$,
+/// respectively $R_{11}(i,i)$, is exactly zero, i.e., B doesn't have full
+/// row rank, respectively $(A; B)$ doesn't have full column rank, as for
+/// gglse's info = 1 and 2. solve throws Error if there is no successful
+/// factorization.
+/// @ingroup ggls
+template <typename scalar_t>
+class LSE {
+public:
+    using real_t = blas::real_type< scalar_t >;
+
+    LSE();
+    LSE( int64_t m, int64_t n, int64_t p );
+
+    LSE( LSE const& ) = delete;
+    LSE& operator = ( LSE const& ) = delete;
+    LSE( LSE&& ) = default;
+    LSE& operator = ( LSE&& ) = default;
+
+    void resize( int64_t m, int64_t n, int64_t p );
+
+    int64_t factor_B( scalar_t const* B, int64_t ldb );
+    int64_t factor_A( scalar_t const* A, int64_t lda );
+
+    void solve( int64_t nrhs,
+                scalar_t const* C, int64_t ldc,
+                scalar_t const* D, int64_t ldd,
+                scalar_t* X, int64_t ldx );
+
+    int64_t m() const { return m_; }
+    int64_t n() const { return n_; }
+    int64_t p() const { return p_; }
+
+private:
+    int64_t m_, n_, p_, lda_, ldb_, info_a_, info_b_;
+    bool a_factored_, b_factored_;
+    lapack::vector< scalar_t > A_;
+    lapack::vector< scalar_t > B_;
+    lapack::vector< scalar_t > taua_;
+    lapack::vector< scalar_t > taub_;
+    lapack::vector< scalar_t > work_;
+    lapack::vector< scalar_t > C_;
+};
+
+// -----------------------------------------------------------------------------
+/// General Gauss-Markov linear model (GLM), as solved by ggglm,
+///     $\min_{x,y} || y ||_2$ subject to $d = A x + B y$,
+/// for n-by-m A and n-by-p B, with m <= n <= m + p, when the design matrix A
+/// is fixed while B and d change. factor_A computes the QR factorization
+/// $A = Q (R; 0)$ with geqrf once. Each factor_B then forms $Q^H B$ with
+/// unmqr and its RQ factorization $Q^H B = T Z$ with gerqf, instead of
+/// ggglm refactoring both. solve handles many right-hand sides d at once
+/// with Level 3 BLAS:
+///
+///     lapack::GLM< double > glm( n, m, p );
+///     glm.factor_A( A, lda );
+///     glm.factor_B( B, ldb );
+///     glm.solve( nrhs, D, ldd, X, ldx, Y, ldy );
+///
+/// factor_A and factor_B return 0 on success, or i > 0 if $R(i,i)$,
+/// respectively $T_{22}(i,i)$, is exactly zero, i.e., A doesn't have full
+/// column rank, respectively $(A, B)$ doesn't have full row rank, as for
+/// ggglm's info = 2 and 1. solve throws Error if there is no successful
+/// factorization.
+/// @ingroup ggls
+template <typename scalar_t>
+class GLM {
+public:
+    using real_t = blas::real_type< scalar_t >;
+
+    GLM();
+    GLM( int64_t n, int64_t m, int64_t p );
+
+    GLM( GLM const& ) = delete;
+    GLM& operator = ( GLM const& ) = delete;
+    GLM( GLM&& ) = default;
+    GLM& operator = ( GLM&& ) = default;
+
+    void resize( int64_t n, int64_t m, int64_t p );
+
+    int64_t factor_A( scalar_t const* A, int64_t lda );
+    int64_t factor_B( scalar_t const* B, int64_t ldb );
+
+    void solve( int64_t nrhs,
+                scalar_t const* D, int64_t ldd,
+                scalar_t* X, int64_t ldx,
+                scalar_t* Y, int64_t ldy );
+
+    int64_t n() const { return n_; }
+    int64_t m() const { return m_; }
+    int64_t p() const { return p_; }
+
+private:
+    int64_t n_, m_, p_, lda_, info_a_, info_b_;
+    bool a_factored_, b_factored_;
+    lapack::vector< scalar_t > A_;
+    lapack::vector< scalar_t > B_;
+    lapack::vector< scalar_t > taua_;
+    lapack::vector< scalar_t > taub_;
+    lapack::vector< scalar_t > work_;
+    lapack::vector< scalar_t > C_;
+};
+
+}  // namespace lapack
+
+#endif // LAPACK_FACTOR_HH
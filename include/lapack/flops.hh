@@ -9,6 +9,7 @@
 #include "lapack.hh"
 #include "blas/flops.hh"
 
+#include <algorithm>
 #include <complex>
 
 namespace lapack {
@@ -73,6 +74,15 @@ inline double fmuls_potrs(double n, double nrhs)
 inline double fadds_potrs(double n, double nrhs)
     { return nrhs*n*(n - 1); }
 
+//------------------------------------------------------------ gbtrf
+// Approximate, ignoring end effects: each of min(m, n) columns scales kl
+// entries and updates a kl-by-(kl + ku) block, since U fills in to kl + ku.
+inline double fmuls_gbtrf(double m, double n, double kl, double ku)
+    { return std::min(m, n) * kl * (kl + ku + 1); }
+
+inline double fadds_gbtrf(double m, double n, double kl, double ku)
+    { return std::min(m, n) * kl * (kl + ku); }
+
 //------------------------------------------------------------ pbtrf
 inline double fmuls_pbtrf(double n, double k)
     { return n*(1./2.*k*k + 3./2.*k + 1) - 1./3.*k*k*k - k*k - 2./3.*k; }
@@ -319,11 +329,45 @@ inline double fadds_lanhe(lapack::Norm norm, double n)
 // template class. Example:
 // gbyte< float >::gemv( m, n ) yields bytes transferred for sgemv.
 // gbyte< std::complex<float> >::gemv( m, n ) yields bytes transferred for cgemv.
+// LAPACK routines count compulsory traffic: each matrix entry is read once,
+// and written once if it is overwritten.
 //==============================================================================
 template< typename T >
 class Gbyte:
     public blas::Gbyte<T>
 {
+public:
+    // LU
+    static double getrf(double m, double n)
+        { return 1e-9 * (2*m*n) * sizeof(T); }
+
+    static double getrs(double n, double nrhs)
+        { return 1e-9 * (n*n + 2*n*nrhs) * sizeof(T); }
+
+    // band LU, with (2 kl + ku + 1)-by-n band storage
+    static double gbtrf(double m, double n, double kl, double ku)
+        { return 1e-9 * (2*(2*kl + ku + 1)*n) * sizeof(T); }
+
+    // Cholesky
+    static double potrf(double n)
+        { return 1e-9 * (n*(n + 1)) * sizeof(T); }
+
+    static double potrs(double n, double nrhs)
+        { return 1e-9 * (n*(n + 1)/2 + 2*n*nrhs) * sizeof(T); }
+
+    // QR
+    static double geqrf(double m, double n)
+        { return 1e-9 * (2*m*n) * sizeof(T); }
+
+    // norm
+    static double lange(double m, double n)
+        { return 1e-9 * (m*n) * sizeof(T); }
+
+    static double lanhe(double n)
+        { return 1e-9 * (n*(n + 1)/2) * sizeof(T); }
+
+    static double lansy(double n)
+        { return lanhe(n); }
 };
 
 //==============================================================================
@@ -343,6 +387,9 @@ public:
     static double gesv(double n, double nrhs)
         { return getrf(n, n) + getrs(n, nrhs); }
 
+    static double gbtrf(double m, double n, double kl, double ku)
+        { return 1e-9 * (mul_ops*fmuls_gbtrf(m, n, kl, ku) + add_ops*fadds_gbtrf(m, n, kl, ku)); }
+
     static double getrf(double m, double n)
         { return 1e-9 * (mul_ops*fmuls_getrf(m, n) + add_ops*fadds_getrf(m, n)); }
 
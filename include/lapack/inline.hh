@@ -0,0 +1,499 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_INLINE_HH
+#define LAPACK_INLINE_HH
+
+// -----------------------------------------------------------------------------
+// Inline definitions of thin wrappers: lacpy, lapy2, lapy3, larfg, larfgp,
+// lartg, laset. Out-of-line, each call pays a call into liblapackpp on top of
+// the Fortran call. Inline, the compiler can fold argument conversions and
+// overflow checks into the caller, leaving just the Fortran call.
+//
+// Opt in by defining LAPACK_INLINE_WRAPPERS before including lapack.hh,
+// or with CMake -Dinline_wrappers=yes, which adds it to the lapackpp
+// target's interface. Then lapack::lartg, etc., are these inline versions,
+// and wrappers.hh omits its declarations of them. They live in namespace
+// lapack::inlined, which is inline only in that mode, so their symbols never
+// collide with the out-of-line versions that liblapackpp always provides.
+// Without LAPACK_INLINE_WRAPPERS, this header may still be included to call
+// lapack::inlined::lartg, etc., explicitly.
+//
+// The out-of-line versions in liblapackpp call these, so semantics, including
+// exceptions, are identical; see them for documentation.
+
+#include "lapack/util.hh"
+#include "lapack/fortran.h"
+
+#include <cstdlib>
+#include <limits>
+
+namespace lapack {
+
+#ifdef LAPACK_INLINE_WRAPPERS
+inline
+#endif
+namespace inlined {
+
+// -----------------------------------------------------------------------------
+inline void lacpy(
+    lapack::MatrixType matrixtype, int64_t m, int64_t n,
+    float const* A, int64_t lda,
+    float* B, int64_t ldb )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+    }
+    char matrixtype_ = matrixtype2char( matrixtype );
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+
+    LAPACK_slacpy(
+        &matrixtype_, &m_, &n_,
+        A, &lda_,
+        B, &ldb_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+    );
+}
+
+// -----------------------------------------------------------------------------
+inline void lacpy(
+    lapack::MatrixType matrixtype, int64_t m, int64_t n,
+    double const* A, int64_t lda,
+    double* B, int64_t ldb )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+    }
+    char matrixtype_ = matrixtype2char( matrixtype );
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+
+    LAPACK_dlacpy(
+        &matrixtype_, &m_, &n_,
+        A, &lda_,
+        B, &ldb_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+    );
+}
+
+// -----------------------------------------------------------------------------
+inline void lacpy(
+    lapack::MatrixType matrixtype, int64_t m, int64_t n,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+    }
+    char matrixtype_ = matrixtype2char( matrixtype );
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+
+    LAPACK_clacpy(
+        &matrixtype_, &m_, &n_,
+        (lapack_complex_float*) A, &lda_,
+        (lapack_complex_float*) B, &ldb_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+    );
+}
+
+// -----------------------------------------------------------------------------
+inline void lacpy(
+    lapack::MatrixType matrixtype, int64_t m, int64_t n,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+    }
+    char matrixtype_ = matrixtype2char( matrixtype );
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+
+    LAPACK_zlacpy(
+        &matrixtype_, &m_, &n_,
+        (lapack_complex_double*) A, &lda_,
+        (lapack_complex_double*) B, &ldb_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+    );
+}
+
+// -----------------------------------------------------------------------------
+inline float lapy2(
+    float x, float y )
+{
+    return LAPACK_slapy2( &x, &y );
+}
+
+// -----------------------------------------------------------------------------
+inline double lapy2(
+    double x, double y )
+{
+    return LAPACK_dlapy2( &x, &y );
+}
+
+// -----------------------------------------------------------------------------
+inline float lapy3(
+    float x, float y, float z )
+{
+    return LAPACK_slapy3( &x, &y, &z );
+}
+
+// -----------------------------------------------------------------------------
+inline double lapy3(
+    double x, double y, double z )
+{
+    return LAPACK_dlapy3( &x, &y, &z );
+}
+
+// -----------------------------------------------------------------------------
+inline void larfg(
+    int64_t n,
+    float* alpha,
+    float* X, int64_t incx,
+    float* tau )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(incx) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int n_ = (lapack_int) n;
+    lapack_int incx_ = (lapack_int) incx;
+
+    LAPACK_slarfg(
+        &n_, alpha,
+        X, &incx_, tau );
+}
+
+// -----------------------------------------------------------------------------
+inline void larfg(
+    int64_t n,
+    double* alpha,
+    double* X, int64_t incx,
+    double* tau )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(incx) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int n_ = (lapack_int) n;
+    lapack_int incx_ = (lapack_int) incx;
+
+    LAPACK_dlarfg(
+        &n_, alpha,
+        X, &incx_, tau );
+}
+
+// -----------------------------------------------------------------------------
+inline void larfg(
+    int64_t n,
+    std::complex<float>* alpha,
+    std::complex<float>* X, int64_t incx,
+    std::complex<float>* tau )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(incx) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int n_ = (lapack_int) n;
+    lapack_int incx_ = (lapack_int) incx;
+
+    LAPACK_clarfg(
+        &n_, (lapack_complex_float*) alpha,
+        (lapack_complex_float*) X, &incx_, (lapack_complex_float*) tau );
+}
+
+// -----------------------------------------------------------------------------
+inline void larfg(
+    int64_t n,
+    std::complex<double>* alpha,
+    std::complex<double>* X, int64_t incx,
+    std::complex<double>* tau )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(incx) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int n_ = (lapack_int) n;
+    lapack_int incx_ = (lapack_int) incx;
+
+    LAPACK_zlarfg(
+        &n_, (lapack_complex_double*) alpha,
+        (lapack_complex_double*) X, &incx_, (lapack_complex_double*) tau );
+}
+
+// -----------------------------------------------------------------------------
+inline void larfgp(
+    int64_t n,
+    float* alpha,
+    float* X, int64_t incx,
+    float* tau )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(incx) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int n_ = (lapack_int) n;
+    lapack_int incx_ = (lapack_int) incx;
+
+    LAPACK_slarfgp(
+        &n_, alpha,
+        X, &incx_, tau );
+}
+
+// -----------------------------------------------------------------------------
+inline void larfgp(
+    int64_t n,
+    double* alpha,
+    double* X, int64_t incx,
+    double* tau )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(incx) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int n_ = (lapack_int) n;
+    lapack_int incx_ = (lapack_int) incx;
+
+    LAPACK_dlarfgp(
+        &n_, alpha,
+        X, &incx_, tau );
+}
+
+// -----------------------------------------------------------------------------
+inline void larfgp(
+    int64_t n,
+    std::complex<float>* alpha,
+    std::complex<float>* X, int64_t incx,
+    std::complex<float>* tau )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(incx) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int n_ = (lapack_int) n;
+    lapack_int incx_ = (lapack_int) incx;
+
+    LAPACK_clarfgp(
+        &n_, (lapack_complex_float*) alpha,
+        (lapack_complex_float*) X, &incx_, (lapack_complex_float*) tau );
+}
+
+// -----------------------------------------------------------------------------
+inline void larfgp(
+    int64_t n,
+    std::complex<double>* alpha,
+    std::complex<double>* X, int64_t incx,
+    std::complex<double>* tau )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(incx) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int n_ = (lapack_int) n;
+    lapack_int incx_ = (lapack_int) incx;
+
+    LAPACK_zlarfgp(
+        &n_, (lapack_complex_double*) alpha,
+        (lapack_complex_double*) X, &incx_, (lapack_complex_double*) tau );
+}
+
+// -----------------------------------------------------------------------------
+inline void lartg(
+    float f, float g,
+    float* cs,
+    float* sn,
+    float* r )
+{
+    LAPACK_slartg(
+        &f, &g, cs, sn, r );
+}
+
+// -----------------------------------------------------------------------------
+inline void lartg(
+    double f, double g,
+    double* cs,
+    double* sn,
+    double* r )
+{
+    LAPACK_dlartg(
+        &f, &g, cs, sn, r );
+}
+
+// -----------------------------------------------------------------------------
+inline void lartg(
+    std::complex<float> f, std::complex<float> g,
+    float* cs,
+    std::complex<float>* sn,
+    std::complex<float>* r )
+{
+    LAPACK_clartg(
+        (lapack_complex_float*) &f,
+        (lapack_complex_float*) &g,
+        cs,
+        (lapack_complex_float*) sn,
+        (lapack_complex_float*) r );
+}
+
+// -----------------------------------------------------------------------------
+inline void lartg(
+    std::complex<double> f, std::complex<double> g,
+    double* cs,
+    std::complex<double>* sn,
+    std::complex<double>* r )
+{
+    LAPACK_zlartg(
+        (lapack_complex_double*) &f,
+        (lapack_complex_double*) &g,
+        cs,
+        (lapack_complex_double*) sn,
+        (lapack_complex_double*) r );
+}
+
+// -----------------------------------------------------------------------------
+inline void laset(
+    lapack::MatrixType matrixtype, int64_t m, int64_t n, float offdiag, float diag,
+    float* A, int64_t lda )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+    }
+    char matrixtype_ = matrixtype2char( matrixtype );
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+
+    LAPACK_slaset(
+        &matrixtype_, &m_, &n_, &offdiag, &diag,
+        A, &lda_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+    );
+}
+
+// -----------------------------------------------------------------------------
+inline void laset(
+    lapack::MatrixType matrixtype, int64_t m, int64_t n, double offdiag, double diag,
+    double* A, int64_t lda )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+    }
+    char matrixtype_ = matrixtype2char( matrixtype );
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+
+    LAPACK_dlaset(
+        &matrixtype_, &m_, &n_, &offdiag, &diag,
+        A, &lda_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+    );
+}
+
+// -----------------------------------------------------------------------------
+inline void laset(
+    lapack::MatrixType matrixtype, int64_t m, int64_t n, std::complex<float> offdiag, std::complex<float> diag,
+    std::complex<float>* A, int64_t lda )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+    }
+    char matrixtype_ = matrixtype2char( matrixtype );
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+
+    LAPACK_claset(
+        &matrixtype_, &m_, &n_, (lapack_complex_float*) &offdiag, (lapack_complex_float*) &diag,
+        (lapack_complex_float*) A, &lda_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+    );
+}
+
+// -----------------------------------------------------------------------------
+inline void laset(
+    lapack::MatrixType matrixtype, int64_t m, int64_t n, std::complex<double> offdiag, std::complex<double> diag,
+    std::complex<double>* A, int64_t lda )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+    }
+    char matrixtype_ = matrixtype2char( matrixtype );
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+
+    LAPACK_zlaset(
+        &matrixtype_, &m_, &n_, (lapack_complex_double*) &offdiag, (lapack_complex_double*) &diag,
+        (lapack_complex_double*) A, &lda_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+    );
+}
+
+}  // namespace inlined
+}  // namespace lapack
+
+#endif // LAPACK_INLINE_HH
@@ -0,0 +1,3029 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_NOTHROW_HH
+#define LAPACK_NOTHROW_HH
+
+// Non-throwing, header-only variants of frequently called routines,
+// for tight loops where the lapack:: wrappers' exceptions, workspace
+// queries, and allocation are too costly. They call the Fortran routine
+// directly and return LAPACK's info rather than throwing:
+// info = -i means argument i was invalid or, unless called with
+// Check::None, doesn't fit in lapack_int. Unlike the lapack:: wrappers,
+// the caller provides workspace, and pivots are lapack_int, as in LAPACK,
+// so non-ILP64 builds don't copy them. E.g.,
+//
+//     #include "lapack/nothrow.hh"
+//     std::vector< lapack_int > ipiv( n );
+//     for (int64_t i = 0; i < batch; ++i) {
+//         int64_t info = lapack::nothrow::getrf(
+//             n, n, A[ i ], lda, ipiv.data(), lapack::nothrow::Check::None );
+//         ...
+//     }
+
+#include "lapack/util.hh"
+#include "lapack/fortran.h"
+
+#include <cstdlib>
+#include <limits>
+
+namespace lapack {
+namespace nothrow {
+
+// -----------------------------------------------------------------------------
+/// Whether to check that int64_t arguments fit in lapack_int.
+/// Check::None is for callers that guarantee small sizes; then the checks,
+/// and their branches at each call site, compile away.
+enum class Check {
+    Overflow,
+    None,
+};
+
+namespace internal {
+
+// -----------------------------------------------------------------------------
+/// @return true if x fits in lapack_int; always true for ILP64.
+inline bool fits( int64_t x ) noexcept
+{
+    return sizeof(int64_t) <= sizeof(lapack_int)
+           || std::abs( x ) <= std::numeric_limits<lapack_int>::max();
+}
+
+}  // namespace internal
+
+// -----------------------------------------------------------------------------
+/// LU factorization; see lapack::getrf.
+/// @ingroup gesv_computational
+inline int64_t getrf(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    lapack_int* ipiv,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( m )) return -1;
+        if (! internal::fits( n )) return -2;
+        if (! internal::fits( lda )) return -4;
+    }
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int info_ = 0;
+    LAPACK_sgetrf( &m_, &n_, A, &lda_, ipiv, &info_ );
+    return info_;
+}
+
+inline int64_t getrf(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    lapack_int* ipiv,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( m )) return -1;
+        if (! internal::fits( n )) return -2;
+        if (! internal::fits( lda )) return -4;
+    }
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int info_ = 0;
+    LAPACK_dgetrf( &m_, &n_, A, &lda_, ipiv, &info_ );
+    return info_;
+}
+
+inline int64_t getrf(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    lapack_int* ipiv,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( m )) return -1;
+        if (! internal::fits( n )) return -2;
+        if (! internal::fits( lda )) return -4;
+    }
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int info_ = 0;
+    LAPACK_cgetrf( &m_, &n_, (lapack_complex_float*) A, &lda_, ipiv, &info_ );
+    return info_;
+}
+
+inline int64_t getrf(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    lapack_int* ipiv,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( m )) return -1;
+        if (! internal::fits( n )) return -2;
+        if (! internal::fits( lda )) return -4;
+    }
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int info_ = 0;
+    LAPACK_zgetrf( &m_, &n_, (lapack_complex_double*) A, &lda_, ipiv, &info_ );
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// Solves using LU factorization from getrf; see lapack::getrs.
+/// @ingroup gesv_computational
+inline int64_t getrs(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    float const* A, int64_t lda,
+    lapack_int const* ipiv,
+    float* B, int64_t ldb,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( n )) return -2;
+        if (! internal::fits( nrhs )) return -3;
+        if (! internal::fits( lda )) return -5;
+        if (! internal::fits( ldb )) return -8;
+    }
+    char trans_ = op2char( trans );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int nrhs_ = (lapack_int) nrhs;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int info_ = 0;
+    LAPACK_sgetrs(
+        &trans_, &n_, &nrhs_, A, &lda_, ipiv, B, &ldb_, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+        );
+    return info_;
+}
+
+inline int64_t getrs(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    double const* A, int64_t lda,
+    lapack_int const* ipiv,
+    double* B, int64_t ldb,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( n )) return -2;
+        if (! internal::fits( nrhs )) return -3;
+        if (! internal::fits( lda )) return -5;
+        if (! internal::fits( ldb )) return -8;
+    }
+    char trans_ = op2char( trans );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int nrhs_ = (lapack_int) nrhs;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int info_ = 0;
+    LAPACK_dgetrs(
+        &trans_, &n_, &nrhs_, A, &lda_, ipiv, B, &ldb_, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+        );
+    return info_;
+}
+
+inline int64_t getrs(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    std::complex<float> const* A, int64_t lda,
+    lapack_int const* ipiv,
+    std::complex<float>* B, int64_t ldb,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( n )) return -2;
+        if (! internal::fits( nrhs )) return -3;
+        if (! internal::fits( lda )) return -5;
+        if (! internal::fits( ldb )) return -8;
+    }
+    char trans_ = op2char( trans );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int nrhs_ = (lapack_int) nrhs;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int info_ = 0;
+    LAPACK_cgetrs(
+        &trans_, &n_, &nrhs_, (lapack_complex_float*) A, &lda_, ipiv, (lapack_complex_float*) B, &ldb_, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+        );
+    return info_;
+}
+
+inline int64_t getrs(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    std::complex<double> const* A, int64_t lda,
+    lapack_int const* ipiv,
+    std::complex<double>* B, int64_t ldb,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( n )) return -2;
+        if (! internal::fits( nrhs )) return -3;
+        if (! internal::fits( lda )) return -5;
+        if (! internal::fits( ldb )) return -8;
+    }
+    char trans_ = op2char( trans );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int nrhs_ = (lapack_int) nrhs;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int info_ = 0;
+    LAPACK_zgetrs(
+        &trans_, &n_, &nrhs_, (lapack_complex_double*) A, &lda_, ipiv, (lapack_complex_double*) B, &ldb_, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+        );
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// Estimates reciprocal condition number of an LU factorization from
+/// getrf; see lapack::gecon. The caller provides workspace: work of
+/// length 4n for real types, 2n for complex types; rwork of length 2n,
+/// used only for complex types; iwork of length n, used only for real
+/// types.
+/// @ingroup gesv_computational
+inline int64_t gecon(
+    lapack::Norm norm, int64_t n,
+    float const* A, int64_t lda,
+    float anorm, float* rcond,
+    float* work, float* /* rwork */, lapack_int* iwork,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( n )) return -2;
+        if (! internal::fits( lda )) return -4;
+    }
+    char norm_ = norm2char( norm );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int info_ = 0;
+    LAPACK_sgecon(
+        &norm_, &n_, A, &lda_, &anorm, rcond,
+        work, iwork, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+        );
+    return info_;
+}
+
+inline int64_t gecon(
+    lapack::Norm norm, int64_t n,
+    double const* A, int64_t lda,
+    double anorm, double* rcond,
+    double* work, double* /* rwork */, lapack_int* iwork,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( n )) return -2;
+        if (! internal::fits( lda )) return -4;
+    }
+    char norm_ = norm2char( norm );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int info_ = 0;
+    LAPACK_dgecon(
+        &norm_, &n_, A, &lda_, &anorm, rcond,
+        work, iwork, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+        );
+    return info_;
+}
+
+inline int64_t gecon(
+    lapack::Norm norm, int64_t n,
+    std::complex<float> const* A, int64_t lda,
+    float anorm, float* rcond,
+    std::complex<float>* work, float* rwork, lapack_int* /* iwork */,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( n )) return -2;
+        if (! internal::fits( lda )) return -4;
+    }
+    char norm_ = norm2char( norm );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int info_ = 0;
+    LAPACK_cgecon(
+        &norm_, &n_, (lapack_complex_float*) A, &lda_, &anorm, rcond,
+        (lapack_complex_float*) work, rwork, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+        );
+    return info_;
+}
+
+inline int64_t gecon(
+    lapack::Norm norm, int64_t n,
+    std::complex<double> const* A, int64_t lda,
+    double anorm, double* rcond,
+    std::complex<double>* work, double* rwork, lapack_int* /* iwork */,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( n )) return -2;
+        if (! internal::fits( lda )) return -4;
+    }
+    char norm_ = norm2char( norm );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int info_ = 0;
+    LAPACK_zgecon(
+        &norm_, &n_, (lapack_complex_double*) A, &lda_, &anorm, rcond,
+        (lapack_complex_double*) work, rwork, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+        );
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// Cholesky factorization; see lapack::potrf.
+/// @ingroup posv_computational
+inline int64_t potrf(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( n )) return -2;
+        if (! internal::fits( lda )) return -4;
+    }
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int info_ = 0;
+    LAPACK_spotrf(
+        &uplo_, &n_, A, &lda_, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+        );
+    return info_;
+}
+
+inline int64_t potrf(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( n )) return -2;
+        if (! internal::fits( lda )) return -4;
+    }
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int info_ = 0;
+    LAPACK_dpotrf(
+        &uplo_, &n_, A, &lda_, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+        );
+    return info_;
+}
+
+inline int64_t potrf(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( n )) return -2;
+        if (! internal::fits( lda )) return -4;
+    }
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int info_ = 0;
+    LAPACK_cpotrf(
+        &uplo_, &n_, (lapack_complex_float*) A, &lda_, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+        );
+    return info_;
+}
+
+inline int64_t potrf(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( n )) return -2;
+        if (! internal::fits( lda )) return -4;
+    }
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int info_ = 0;
+    LAPACK_zpotrf(
+        &uplo_, &n_, (lapack_complex_double*) A, &lda_, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+        );
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// Solves using Cholesky factorization from potrf; see lapack::potrs.
+/// @ingroup posv_computational
+inline int64_t potrs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* A, int64_t lda,
+    float* B, int64_t ldb,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( n )) return -2;
+        if (! internal::fits( nrhs )) return -3;
+        if (! internal::fits( lda )) return -5;
+        if (! internal::fits( ldb )) return -7;
+    }
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int nrhs_ = (lapack_int) nrhs;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int info_ = 0;
+    LAPACK_spotrs(
+        &uplo_, &n_, &nrhs_, A, &lda_, B, &ldb_, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+        );
+    return info_;
+}
+
+inline int64_t potrs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* A, int64_t lda,
+    double* B, int64_t ldb,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( n )) return -2;
+        if (! internal::fits( nrhs )) return -3;
+        if (! internal::fits( lda )) return -5;
+        if (! internal::fits( ldb )) return -7;
+    }
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int nrhs_ = (lapack_int) nrhs;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int info_ = 0;
+    LAPACK_dpotrs(
+        &uplo_, &n_, &nrhs_, A, &lda_, B, &ldb_, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+        );
+    return info_;
+}
+
+inline int64_t potrs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( n )) return -2;
+        if (! internal::fits( nrhs )) return -3;
+        if (! internal::fits( lda )) return -5;
+        if (! internal::fits( ldb )) return -7;
+    }
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int nrhs_ = (lapack_int) nrhs;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int info_ = 0;
+    LAPACK_cpotrs(
+        &uplo_, &n_, &nrhs_, (lapack_complex_float*) A, &lda_, (lapack_complex_float*) B, &ldb_, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+        );
+    return info_;
+}
+
+inline int64_t potrs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( n )) return -2;
+        if (! internal::fits( nrhs )) return -3;
+        if (! internal::fits( lda )) return -5;
+        if (! internal::fits( ldb )) return -7;
+    }
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int nrhs_ = (lapack_int) nrhs;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int info_ = 0;
+    LAPACK_zpotrs(
+        &uplo_, &n_, &nrhs_, (lapack_complex_double*) A, &lda_, (lapack_complex_double*) B, &ldb_, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+        );
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// Estimates reciprocal condition number of a Cholesky factorization
+/// from potrf; see lapack::pocon. The caller provides workspace: work of
+/// length 3n for real types, 2n for complex types; rwork of length n,
+/// used only for complex types; iwork of length n, used only for real
+/// types.
+/// @ingroup posv_computational
+inline int64_t pocon(
+    lapack::Uplo uplo, int64_t n,
+    float const* A, int64_t lda,
+    float anorm, float* rcond,
+    float* work, float* /* rwork */, lapack_int* iwork,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( n )) return -2;
+        if (! internal::fits( lda )) return -4;
+    }
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int info_ = 0;
+    LAPACK_spocon(
+        &uplo_, &n_, A, &lda_, &anorm, rcond,
+        work, iwork, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+        );
+    return info_;
+}
+
+inline int64_t pocon(
+    lapack::Uplo uplo, int64_t n,
+    double const* A, int64_t lda,
+    double anorm, double* rcond,
+    double* work, double* /* rwork */, lapack_int* iwork,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( n )) return -2;
+        if (! internal::fits( lda )) return -4;
+    }
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int info_ = 0;
+    LAPACK_dpocon(
+        &uplo_, &n_, A, &lda_, &anorm, rcond,
+        work, iwork, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+        );
+    return info_;
+}
+
+inline int64_t pocon(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float> const* A, int64_t lda,
+    float anorm, float* rcond,
+    std::complex<float>* work, float* rwork, lapack_int* /* iwork */,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( n )) return -2;
+        if (! internal::fits( lda )) return -4;
+    }
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int info_ = 0;
+    LAPACK_cpocon(
+        &uplo_, &n_, (lapack_complex_float*) A, &lda_, &anorm, rcond,
+        (lapack_complex_float*) work, rwork, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+        );
+    return info_;
+}
+
+inline int64_t pocon(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double> const* A, int64_t lda,
+    double anorm, double* rcond,
+    std::complex<double>* work, double* rwork, lapack_int* /* iwork */,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( n )) return -2;
+        if (! internal::fits( lda )) return -4;
+    }
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int info_ = 0;
+    LAPACK_zpocon(
+        &uplo_, &n_, (lapack_complex_double*) A, &lda_, &anorm, rcond,
+        (lapack_complex_double*) work, rwork, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+        );
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// Symmetric indefinite factorization (sytrf for real types);
+/// see lapack::hetrf. The caller provides workspace; lwork = -1 queries
+/// its optimal size, returned in work[ 0 ].
+/// @ingroup hesv_computational
+inline int64_t hetrf(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    lapack_int* ipiv,
+    float* work, int64_t lwork,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( n )) return -2;
+        if (! internal::fits( lda )) return -4;
+        if (! internal::fits( lwork )) return -7;
+    }
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+    LAPACK_ssytrf(
+        &uplo_, &n_, A, &lda_, ipiv, work, &lwork_, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+        );
+    return info_;
+}
+
+inline int64_t hetrf(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    lapack_int* ipiv,
+    double* work, int64_t lwork,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( n )) return -2;
+        if (! internal::fits( lda )) return -4;
+        if (! internal::fits( lwork )) return -7;
+    }
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+    LAPACK_dsytrf(
+        &uplo_, &n_, A, &lda_, ipiv, work, &lwork_, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+        );
+    return info_;
+}
+
+inline int64_t hetrf(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    lapack_int* ipiv,
+    std::complex<float>* work, int64_t lwork,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( n )) return -2;
+        if (! internal::fits( lda )) return -4;
+        if (! internal::fits( lwork )) return -7;
+    }
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+    LAPACK_chetrf(
+        &uplo_, &n_, (lapack_complex_float*) A, &lda_, ipiv, (lapack_complex_float*) work, &lwork_, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+        );
+    return info_;
+}
+
+inline int64_t hetrf(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    lapack_int* ipiv,
+    std::complex<double>* work, int64_t lwork,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( n )) return -2;
+        if (! internal::fits( lda )) return -4;
+        if (! internal::fits( lwork )) return -7;
+    }
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+    LAPACK_zhetrf(
+        &uplo_, &n_, (lapack_complex_double*) A, &lda_, ipiv, (lapack_complex_double*) work, &lwork_, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+        );
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// Solves using the factorization from hetrf (sytrs for real types);
+/// see lapack::hetrs.
+/// @ingroup hesv_computational
+inline int64_t hetrs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* A, int64_t lda,
+    lapack_int const* ipiv,
+    float* B, int64_t ldb,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( n )) return -2;
+        if (! internal::fits( nrhs )) return -3;
+        if (! internal::fits( lda )) return -5;
+        if (! internal::fits( ldb )) return -8;
+    }
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int nrhs_ = (lapack_int) nrhs;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int info_ = 0;
+    LAPACK_ssytrs(
+        &uplo_, &n_, &nrhs_, A, &lda_, ipiv, B, &ldb_, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+        );
+    return info_;
+}
+
+inline int64_t hetrs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* A, int64_t lda,
+    lapack_int const* ipiv,
+    double* B, int64_t ldb,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( n )) return -2;
+        if (! internal::fits( nrhs )) return -3;
+        if (! internal::fits( lda )) return -5;
+        if (! internal::fits( ldb )) return -8;
+    }
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int nrhs_ = (lapack_int) nrhs;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int info_ = 0;
+    LAPACK_dsytrs(
+        &uplo_, &n_, &nrhs_, A, &lda_, ipiv, B, &ldb_, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+        );
+    return info_;
+}
+
+inline int64_t hetrs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float> const* A, int64_t lda,
+    lapack_int const* ipiv,
+    std::complex<float>* B, int64_t ldb,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( n )) return -2;
+        if (! internal::fits( nrhs )) return -3;
+        if (! internal::fits( lda )) return -5;
+        if (! internal::fits( ldb )) return -8;
+    }
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int nrhs_ = (lapack_int) nrhs;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int info_ = 0;
+    LAPACK_chetrs(
+        &uplo_, &n_, &nrhs_, (lapack_complex_float*) A, &lda_, ipiv, (lapack_complex_float*) B, &ldb_, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+        );
+    return info_;
+}
+
+inline int64_t hetrs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double> const* A, int64_t lda,
+    lapack_int const* ipiv,
+    std::complex<double>* B, int64_t ldb,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( n )) return -2;
+        if (! internal::fits( nrhs )) return -3;
+        if (! internal::fits( lda )) return -5;
+        if (! internal::fits( ldb )) return -8;
+    }
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int nrhs_ = (lapack_int) nrhs;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int info_ = 0;
+    LAPACK_zhetrs(
+        &uplo_, &n_, &nrhs_, (lapack_complex_double*) A, &lda_, ipiv, (lapack_complex_double*) B, &ldb_, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+        );
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// Estimates reciprocal condition number of the factorization from
+/// hetrf (sycon for real types); see lapack::hecon. The caller provides
+/// workspace: work of length 2n; iwork of length n, used only for real
+/// types.
+/// @ingroup hesv_computational
+inline int64_t hecon(
+    lapack::Uplo uplo, int64_t n,
+    float const* A, int64_t lda,
+    lapack_int const* ipiv,
+    float anorm, float* rcond,
+    float* work, lapack_int* iwork,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( n )) return -2;
+        if (! internal::fits( lda )) return -4;
+    }
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int info_ = 0;
+    LAPACK_ssycon(
+        &uplo_, &n_, A, &lda_, ipiv, &anorm, rcond,
+        work, iwork, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+        );
+    return info_;
+}
+
+inline int64_t hecon(
+    lapack::Uplo uplo, int64_t n,
+    double const* A, int64_t lda,
+    lapack_int const* ipiv,
+    double anorm, double* rcond,
+    double* work, lapack_int* iwork,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( n )) return -2;
+        if (! internal::fits( lda )) return -4;
+    }
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int info_ = 0;
+    LAPACK_dsycon(
+        &uplo_, &n_, A, &lda_, ipiv, &anorm, rcond,
+        work, iwork, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+        );
+    return info_;
+}
+
+inline int64_t hecon(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float> const* A, int64_t lda,
+    lapack_int const* ipiv,
+    float anorm, float* rcond,
+    std::complex<float>* work, lapack_int* /* iwork */,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( n )) return -2;
+        if (! internal::fits( lda )) return -4;
+    }
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int info_ = 0;
+    LAPACK_checon(
+        &uplo_, &n_, (lapack_complex_float*) A, &lda_, ipiv, &anorm, rcond,
+        (lapack_complex_float*) work, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+        );
+    return info_;
+}
+
+inline int64_t hecon(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double> const* A, int64_t lda,
+    lapack_int const* ipiv,
+    double anorm, double* rcond,
+    std::complex<double>* work, lapack_int* /* iwork */,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( n )) return -2;
+        if (! internal::fits( lda )) return -4;
+    }
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int info_ = 0;
+    LAPACK_zhecon(
+        &uplo_, &n_, (lapack_complex_double*) A, &lda_, ipiv, &anorm, rcond,
+        (lapack_complex_double*) work, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+        );
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// QR factorization; see lapack::geqrf. The caller provides workspace;
+/// lwork = -1 queries its optimal size, returned in work[ 0 ].
+/// @ingroup geqrf
+inline int64_t geqrf(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* tau,
+    float* work, int64_t lwork,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( m )) return -1;
+        if (! internal::fits( n )) return -2;
+        if (! internal::fits( lda )) return -4;
+        if (! internal::fits( lwork )) return -7;
+    }
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+    LAPACK_sgeqrf(
+        &m_, &n_, A, &lda_, tau, work, &lwork_, &info_ );
+    return info_;
+}
+
+inline int64_t geqrf(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* tau,
+    double* work, int64_t lwork,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( m )) return -1;
+        if (! internal::fits( n )) return -2;
+        if (! internal::fits( lda )) return -4;
+        if (! internal::fits( lwork )) return -7;
+    }
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+    LAPACK_dgeqrf(
+        &m_, &n_, A, &lda_, tau, work, &lwork_, &info_ );
+    return info_;
+}
+
+inline int64_t geqrf(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* tau,
+    std::complex<float>* work, int64_t lwork,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( m )) return -1;
+        if (! internal::fits( n )) return -2;
+        if (! internal::fits( lda )) return -4;
+        if (! internal::fits( lwork )) return -7;
+    }
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+    LAPACK_cgeqrf(
+        &m_, &n_, (lapack_complex_float*) A, &lda_, (lapack_complex_float*) tau, (lapack_complex_float*) work, &lwork_, &info_ );
+    return info_;
+}
+
+inline int64_t geqrf(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* tau,
+    std::complex<double>* work, int64_t lwork,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( m )) return -1;
+        if (! internal::fits( n )) return -2;
+        if (! internal::fits( lda )) return -4;
+        if (! internal::fits( lwork )) return -7;
+    }
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+    LAPACK_zgeqrf(
+        &m_, &n_, (lapack_complex_double*) A, &lda_, (lapack_complex_double*) tau, (lapack_complex_double*) work, &lwork_, &info_ );
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// Multiplies by Q from geqrf (ormqr for real types); see lapack::unmqr.
+/// For real types, trans = ConjTrans means Trans.
+/// The caller provides workspace; lwork = -1 queries its optimal
+/// size, returned in work[ 0 ].
+/// @ingroup geqrf
+inline int64_t unmqr(
+    lapack::Side side, lapack::Op trans,
+    int64_t m, int64_t n, int64_t k,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc,
+    float* work, int64_t lwork,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( m )) return -3;
+        if (! internal::fits( n )) return -4;
+        if (! internal::fits( k )) return -5;
+        if (! internal::fits( lda )) return -7;
+        if (! internal::fits( ldc )) return -10;
+        if (! internal::fits( lwork )) return -12;
+    }
+    char side_ = side2char( side );
+    char trans_ = op2char( trans );
+    if (trans_ == 'C')
+        trans_ = 'T';
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int k_ = (lapack_int) k;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldc_ = (lapack_int) ldc;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+    LAPACK_sormqr(
+        &side_, &trans_, &m_, &n_, &k_, A, &lda_, tau,
+        C, &ldc_, work, &lwork_, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1, 1
+        #endif
+        );
+    return info_;
+}
+
+inline int64_t unmqr(
+    lapack::Side side, lapack::Op trans,
+    int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc,
+    double* work, int64_t lwork,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( m )) return -3;
+        if (! internal::fits( n )) return -4;
+        if (! internal::fits( k )) return -5;
+        if (! internal::fits( lda )) return -7;
+        if (! internal::fits( ldc )) return -10;
+        if (! internal::fits( lwork )) return -12;
+    }
+    char side_ = side2char( side );
+    char trans_ = op2char( trans );
+    if (trans_ == 'C')
+        trans_ = 'T';
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int k_ = (lapack_int) k;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldc_ = (lapack_int) ldc;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+    LAPACK_dormqr(
+        &side_, &trans_, &m_, &n_, &k_, A, &lda_, tau,
+        C, &ldc_, work, &lwork_, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1, 1
+        #endif
+        );
+    return info_;
+}
+
+inline int64_t unmqr(
+    lapack::Side side, lapack::Op trans,
+    int64_t m, int64_t n, int64_t k,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* tau,
+    std::complex<float>* C, int64_t ldc,
+    std::complex<float>* work, int64_t lwork,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( m )) return -3;
+        if (! internal::fits( n )) return -4;
+        if (! internal::fits( k )) return -5;
+        if (! internal::fits( lda )) return -7;
+        if (! internal::fits( ldc )) return -10;
+        if (! internal::fits( lwork )) return -12;
+    }
+    char side_ = side2char( side );
+    char trans_ = op2char( trans );
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int k_ = (lapack_int) k;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldc_ = (lapack_int) ldc;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+    LAPACK_cunmqr(
+        &side_, &trans_, &m_, &n_, &k_, (lapack_complex_float*) A, &lda_, (lapack_complex_float*) tau,
+        (lapack_complex_float*) C, &ldc_, (lapack_complex_float*) work, &lwork_, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1, 1
+        #endif
+        );
+    return info_;
+}
+
+inline int64_t unmqr(
+    lapack::Side side, lapack::Op trans,
+    int64_t m, int64_t n, int64_t k,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* tau,
+    std::complex<double>* C, int64_t ldc,
+    std::complex<double>* work, int64_t lwork,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( m )) return -3;
+        if (! internal::fits( n )) return -4;
+        if (! internal::fits( k )) return -5;
+        if (! internal::fits( lda )) return -7;
+        if (! internal::fits( ldc )) return -10;
+        if (! internal::fits( lwork )) return -12;
+    }
+    char side_ = side2char( side );
+    char trans_ = op2char( trans );
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int k_ = (lapack_int) k;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldc_ = (lapack_int) ldc;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+    LAPACK_zunmqr(
+        &side_, &trans_, &m_, &n_, &k_, (lapack_complex_double*) A, &lda_, (lapack_complex_double*) tau,
+        (lapack_complex_double*) C, &ldc_, (lapack_complex_double*) work, &lwork_, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1, 1
+        #endif
+        );
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// RQ factorization; see lapack::gerqf. The caller provides workspace;
+/// lwork = -1 queries its optimal size, returned in work[ 0 ].
+/// @ingroup gerqf
+inline int64_t gerqf(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* tau,
+    float* work, int64_t lwork,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( m )) return -1;
+        if (! internal::fits( n )) return -2;
+        if (! internal::fits( lda )) return -4;
+        if (! internal::fits( lwork )) return -7;
+    }
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+    LAPACK_sgerqf(
+        &m_, &n_, A, &lda_, tau, work, &lwork_, &info_
+        );
+    return info_;
+}
+
+inline int64_t gerqf(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* tau,
+    double* work, int64_t lwork,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( m )) return -1;
+        if (! internal::fits( n )) return -2;
+        if (! internal::fits( lda )) return -4;
+        if (! internal::fits( lwork )) return -7;
+    }
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+    LAPACK_dgerqf(
+        &m_, &n_, A, &lda_, tau, work, &lwork_, &info_
+        );
+    return info_;
+}
+
+inline int64_t gerqf(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* tau,
+    std::complex<float>* work, int64_t lwork,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( m )) return -1;
+        if (! internal::fits( n )) return -2;
+        if (! internal::fits( lda )) return -4;
+        if (! internal::fits( lwork )) return -7;
+    }
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+    LAPACK_cgerqf(
+        &m_, &n_, (lapack_complex_float*) A, &lda_, (lapack_complex_float*) tau, (lapack_complex_float*) work, &lwork_, &info_
+        );
+    return info_;
+}
+
+inline int64_t gerqf(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* tau,
+    std::complex<double>* work, int64_t lwork,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( m )) return -1;
+        if (! internal::fits( n )) return -2;
+        if (! internal::fits( lda )) return -4;
+        if (! internal::fits( lwork )) return -7;
+    }
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+    LAPACK_zgerqf(
+        &m_, &n_, (lapack_complex_double*) A, &lda_, (lapack_complex_double*) tau, (lapack_complex_double*) work, &lwork_, &info_
+        );
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// Multiplies by Q from gerqf (ormrq for real types); see lapack::unmrq.
+/// For real types, trans = ConjTrans means Trans.
+/// The caller provides workspace; lwork = -1 queries its optimal
+/// size, returned in work[ 0 ].
+/// @ingroup gerqf
+inline int64_t unmrq(
+    lapack::Side side, lapack::Op trans,
+    int64_t m, int64_t n, int64_t k,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc,
+    float* work, int64_t lwork,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( m )) return -3;
+        if (! internal::fits( n )) return -4;
+        if (! internal::fits( k )) return -5;
+        if (! internal::fits( lda )) return -7;
+        if (! internal::fits( ldc )) return -10;
+        if (! internal::fits( lwork )) return -12;
+    }
+    char side_ = side2char( side );
+    char trans_ = op2char( trans );
+    if (trans_ == 'C')
+        trans_ = 'T';
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int k_ = (lapack_int) k;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldc_ = (lapack_int) ldc;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+    LAPACK_sormrq(
+        &side_, &trans_, &m_, &n_, &k_, A, &lda_, tau,
+        C, &ldc_, work, &lwork_, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1, 1
+        #endif
+        );
+    return info_;
+}
+
+inline int64_t unmrq(
+    lapack::Side side, lapack::Op trans,
+    int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc,
+    double* work, int64_t lwork,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( m )) return -3;
+        if (! internal::fits( n )) return -4;
+        if (! internal::fits( k )) return -5;
+        if (! internal::fits( lda )) return -7;
+        if (! internal::fits( ldc )) return -10;
+        if (! internal::fits( lwork )) return -12;
+    }
+    char side_ = side2char( side );
+    char trans_ = op2char( trans );
+    if (trans_ == 'C')
+        trans_ = 'T';
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int k_ = (lapack_int) k;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldc_ = (lapack_int) ldc;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+    LAPACK_dormrq(
+        &side_, &trans_, &m_, &n_, &k_, A, &lda_, tau,
+        C, &ldc_, work, &lwork_, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1, 1
+        #endif
+        );
+    return info_;
+}
+
+inline int64_t unmrq(
+    lapack::Side side, lapack::Op trans,
+    int64_t m, int64_t n, int64_t k,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* tau,
+    std::complex<float>* C, int64_t ldc,
+    std::complex<float>* work, int64_t lwork,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( m )) return -3;
+        if (! internal::fits( n )) return -4;
+        if (! internal::fits( k )) return -5;
+        if (! internal::fits( lda )) return -7;
+        if (! internal::fits( ldc )) return -10;
+        if (! internal::fits( lwork )) return -12;
+    }
+    char side_ = side2char( side );
+    char trans_ = op2char( trans );
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int k_ = (lapack_int) k;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldc_ = (lapack_int) ldc;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+    LAPACK_cunmrq(
+        &side_, &trans_, &m_, &n_, &k_, (lapack_complex_float*) A, &lda_, (lapack_complex_float*) tau,
+        (lapack_complex_float*) C, &ldc_, (lapack_complex_float*) work, &lwork_, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1, 1
+        #endif
+        );
+    return info_;
+}
+
+inline int64_t unmrq(
+    lapack::Side side, lapack::Op trans,
+    int64_t m, int64_t n, int64_t k,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* tau,
+    std::complex<double>* C, int64_t ldc,
+    std::complex<double>* work, int64_t lwork,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( m )) return -3;
+        if (! internal::fits( n )) return -4;
+        if (! internal::fits( k )) return -5;
+        if (! internal::fits( lda )) return -7;
+        if (! internal::fits( ldc )) return -10;
+        if (! internal::fits( lwork )) return -12;
+    }
+    char side_ = side2char( side );
+    char trans_ = op2char( trans );
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int k_ = (lapack_int) k;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldc_ = (lapack_int) ldc;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+    LAPACK_zunmrq(
+        &side_, &trans_, &m_, &n_, &k_, (lapack_complex_double*) A, &lda_, (lapack_complex_double*) tau,
+        (lapack_complex_double*) C, &ldc_, (lapack_complex_double*) work, &lwork_, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1, 1
+        #endif
+        );
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// Hessenberg reduction; see lapack::gehrd. The caller provides
+/// workspace; lwork = -1 queries its optimal size, returned in work[ 0 ].
+/// @ingroup geev_computational
+inline int64_t gehrd(
+    int64_t n, int64_t ilo, int64_t ihi,
+    float* A, int64_t lda,
+    float* tau,
+    float* work, int64_t lwork,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( n )) return -1;
+        if (! internal::fits( ilo )) return -2;
+        if (! internal::fits( ihi )) return -3;
+        if (! internal::fits( lda )) return -5;
+        if (! internal::fits( lwork )) return -8;
+    }
+    lapack_int n_ = (lapack_int) n;
+    lapack_int ilo_ = (lapack_int) ilo;
+    lapack_int ihi_ = (lapack_int) ihi;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+    LAPACK_sgehrd(
+        &n_, &ilo_, &ihi_, A, &lda_, tau, work, &lwork_, &info_
+        );
+    return info_;
+}
+
+inline int64_t gehrd(
+    int64_t n, int64_t ilo, int64_t ihi,
+    double* A, int64_t lda,
+    double* tau,
+    double* work, int64_t lwork,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( n )) return -1;
+        if (! internal::fits( ilo )) return -2;
+        if (! internal::fits( ihi )) return -3;
+        if (! internal::fits( lda )) return -5;
+        if (! internal::fits( lwork )) return -8;
+    }
+    lapack_int n_ = (lapack_int) n;
+    lapack_int ilo_ = (lapack_int) ilo;
+    lapack_int ihi_ = (lapack_int) ihi;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+    LAPACK_dgehrd(
+        &n_, &ilo_, &ihi_, A, &lda_, tau, work, &lwork_, &info_
+        );
+    return info_;
+}
+
+inline int64_t gehrd(
+    int64_t n, int64_t ilo, int64_t ihi,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* tau,
+    std::complex<float>* work, int64_t lwork,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( n )) return -1;
+        if (! internal::fits( ilo )) return -2;
+        if (! internal::fits( ihi )) return -3;
+        if (! internal::fits( lda )) return -5;
+        if (! internal::fits( lwork )) return -8;
+    }
+    lapack_int n_ = (lapack_int) n;
+    lapack_int ilo_ = (lapack_int) ilo;
+    lapack_int ihi_ = (lapack_int) ihi;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+    LAPACK_cgehrd(
+        &n_, &ilo_, &ihi_, (lapack_complex_float*) A, &lda_, (lapack_complex_float*) tau, (lapack_complex_float*) work, &lwork_, &info_
+        );
+    return info_;
+}
+
+inline int64_t gehrd(
+    int64_t n, int64_t ilo, int64_t ihi,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* tau,
+    std::complex<double>* work, int64_t lwork,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( n )) return -1;
+        if (! internal::fits( ilo )) return -2;
+        if (! internal::fits( ihi )) return -3;
+        if (! internal::fits( lda )) return -5;
+        if (! internal::fits( lwork )) return -8;
+    }
+    lapack_int n_ = (lapack_int) n;
+    lapack_int ilo_ = (lapack_int) ilo;
+    lapack_int ihi_ = (lapack_int) ihi;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+    LAPACK_zgehrd(
+        &n_, &ilo_, &ihi_, (lapack_complex_double*) A, &lda_, (lapack_complex_double*) tau, (lapack_complex_double*) work, &lwork_, &info_
+        );
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// Generates Q from gehrd (orghr for real types); see lapack::unghr.
+/// The caller provides workspace; lwork = -1 queries its optimal size,
+/// returned in work[ 0 ].
+/// @ingroup geev_computational
+inline int64_t unghr(
+    int64_t n, int64_t ilo, int64_t ihi,
+    float* A, int64_t lda,
+    float const* tau,
+    float* work, int64_t lwork,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( n )) return -1;
+        if (! internal::fits( ilo )) return -2;
+        if (! internal::fits( ihi )) return -3;
+        if (! internal::fits( lda )) return -5;
+        if (! internal::fits( lwork )) return -8;
+    }
+    lapack_int n_ = (lapack_int) n;
+    lapack_int ilo_ = (lapack_int) ilo;
+    lapack_int ihi_ = (lapack_int) ihi;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+    LAPACK_sorghr(
+        &n_, &ilo_, &ihi_, A, &lda_, tau, work, &lwork_, &info_
+        );
+    return info_;
+}
+
+inline int64_t unghr(
+    int64_t n, int64_t ilo, int64_t ihi,
+    double* A, int64_t lda,
+    double const* tau,
+    double* work, int64_t lwork,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( n )) return -1;
+        if (! internal::fits( ilo )) return -2;
+        if (! internal::fits( ihi )) return -3;
+        if (! internal::fits( lda )) return -5;
+        if (! internal::fits( lwork )) return -8;
+    }
+    lapack_int n_ = (lapack_int) n;
+    lapack_int ilo_ = (lapack_int) ilo;
+    lapack_int ihi_ = (lapack_int) ihi;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+    LAPACK_dorghr(
+        &n_, &ilo_, &ihi_, A, &lda_, tau, work, &lwork_, &info_
+        );
+    return info_;
+}
+
+inline int64_t unghr(
+    int64_t n, int64_t ilo, int64_t ihi,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float> const* tau,
+    std::complex<float>* work, int64_t lwork,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( n )) return -1;
+        if (! internal::fits( ilo )) return -2;
+        if (! internal::fits( ihi )) return -3;
+        if (! internal::fits( lda )) return -5;
+        if (! internal::fits( lwork )) return -8;
+    }
+    lapack_int n_ = (lapack_int) n;
+    lapack_int ilo_ = (lapack_int) ilo;
+    lapack_int ihi_ = (lapack_int) ihi;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+    LAPACK_cunghr(
+        &n_, &ilo_, &ihi_, (lapack_complex_float*) A, &lda_, (lapack_complex_float*) tau, (lapack_complex_float*) work, &lwork_, &info_
+        );
+    return info_;
+}
+
+inline int64_t unghr(
+    int64_t n, int64_t ilo, int64_t ihi,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double> const* tau,
+    std::complex<double>* work, int64_t lwork,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( n )) return -1;
+        if (! internal::fits( ilo )) return -2;
+        if (! internal::fits( ihi )) return -3;
+        if (! internal::fits( lda )) return -5;
+        if (! internal::fits( lwork )) return -8;
+    }
+    lapack_int n_ = (lapack_int) n;
+    lapack_int ilo_ = (lapack_int) ilo;
+    lapack_int ihi_ = (lapack_int) ihi;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+    LAPACK_zunghr(
+        &n_, &ilo_, &ihi_, (lapack_complex_double*) A, &lda_, (lapack_complex_double*) tau, (lapack_complex_double*) work, &lwork_, &info_
+        );
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// Tridiagonal reduction (sytrd for real types); see lapack::hetrd.
+/// The caller provides workspace; lwork = -1 queries its optimal size,
+/// returned in work[ 0 ].
+/// @ingroup heev_computational
+inline int64_t hetrd(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* D,
+    float* E,
+    float* tau,
+    float* work, int64_t lwork,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( n )) return -2;
+        if (! internal::fits( lda )) return -4;
+        if (! internal::fits( lwork )) return -9;
+    }
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+    LAPACK_ssytrd(
+        &uplo_, &n_, A, &lda_, D, E, tau, work, &lwork_, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+        );
+    return info_;
+}
+
+inline int64_t hetrd(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* D,
+    double* E,
+    double* tau,
+    double* work, int64_t lwork,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( n )) return -2;
+        if (! internal::fits( lda )) return -4;
+        if (! internal::fits( lwork )) return -9;
+    }
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+    LAPACK_dsytrd(
+        &uplo_, &n_, A, &lda_, D, E, tau, work, &lwork_, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+        );
+    return info_;
+}
+
+inline int64_t hetrd(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* D,
+    float* E,
+    std::complex<float>* tau,
+    std::complex<float>* work, int64_t lwork,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( n )) return -2;
+        if (! internal::fits( lda )) return -4;
+        if (! internal::fits( lwork )) return -9;
+    }
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+    LAPACK_chetrd(
+        &uplo_, &n_, (lapack_complex_float*) A, &lda_, D, E, (lapack_complex_float*) tau, (lapack_complex_float*) work, &lwork_, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+        );
+    return info_;
+}
+
+inline int64_t hetrd(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* D,
+    double* E,
+    std::complex<double>* tau,
+    std::complex<double>* work, int64_t lwork,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( n )) return -2;
+        if (! internal::fits( lda )) return -4;
+        if (! internal::fits( lwork )) return -9;
+    }
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+    LAPACK_zhetrd(
+        &uplo_, &n_, (lapack_complex_double*) A, &lda_, D, E, (lapack_complex_double*) tau, (lapack_complex_double*) work, &lwork_, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+        );
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// Generates Q from hetrd (orgtr for real types); see lapack::ungtr.
+/// The caller provides workspace; lwork = -1 queries its optimal size,
+/// returned in work[ 0 ].
+/// @ingroup heev_computational
+inline int64_t ungtr(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float const* tau,
+    float* work, int64_t lwork,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( n )) return -2;
+        if (! internal::fits( lda )) return -4;
+        if (! internal::fits( lwork )) return -7;
+    }
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+    LAPACK_sorgtr(
+        &uplo_, &n_, A, &lda_, tau, work, &lwork_, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+        );
+    return info_;
+}
+
+inline int64_t ungtr(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double const* tau,
+    double* work, int64_t lwork,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( n )) return -2;
+        if (! internal::fits( lda )) return -4;
+        if (! internal::fits( lwork )) return -7;
+    }
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+    LAPACK_dorgtr(
+        &uplo_, &n_, A, &lda_, tau, work, &lwork_, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+        );
+    return info_;
+}
+
+inline int64_t ungtr(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float> const* tau,
+    std::complex<float>* work, int64_t lwork,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( n )) return -2;
+        if (! internal::fits( lda )) return -4;
+        if (! internal::fits( lwork )) return -7;
+    }
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+    LAPACK_cungtr(
+        &uplo_, &n_, (lapack_complex_float*) A, &lda_, (lapack_complex_float*) tau, (lapack_complex_float*) work, &lwork_, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+        );
+    return info_;
+}
+
+inline int64_t ungtr(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double> const* tau,
+    std::complex<double>* work, int64_t lwork,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( n )) return -2;
+        if (! internal::fits( lda )) return -4;
+        if (! internal::fits( lwork )) return -7;
+    }
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+    LAPACK_zungtr(
+        &uplo_, &n_, (lapack_complex_double*) A, &lda_, (lapack_complex_double*) tau, (lapack_complex_double*) work, &lwork_, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+        );
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// Solves a tridiagonal system; see lapack::gtsv.
+/// @ingroup gtsv
+inline int64_t gtsv(
+    int64_t n, int64_t nrhs,
+    float* DL,
+    float* D,
+    float* DU,
+    float* B, int64_t ldb,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( n )) return -1;
+        if (! internal::fits( nrhs )) return -2;
+        if (! internal::fits( ldb )) return -7;
+    }
+    lapack_int n_ = (lapack_int) n;
+    lapack_int nrhs_ = (lapack_int) nrhs;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int info_ = 0;
+    LAPACK_sgtsv(
+        &n_, &nrhs_, DL, D, DU, B, &ldb_, &info_
+        );
+    return info_;
+}
+
+inline int64_t gtsv(
+    int64_t n, int64_t nrhs,
+    double* DL,
+    double* D,
+    double* DU,
+    double* B, int64_t ldb,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( n )) return -1;
+        if (! internal::fits( nrhs )) return -2;
+        if (! internal::fits( ldb )) return -7;
+    }
+    lapack_int n_ = (lapack_int) n;
+    lapack_int nrhs_ = (lapack_int) nrhs;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int info_ = 0;
+    LAPACK_dgtsv(
+        &n_, &nrhs_, DL, D, DU, B, &ldb_, &info_
+        );
+    return info_;
+}
+
+inline int64_t gtsv(
+    int64_t n, int64_t nrhs,
+    std::complex<float>* DL,
+    std::complex<float>* D,
+    std::complex<float>* DU,
+    std::complex<float>* B, int64_t ldb,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( n )) return -1;
+        if (! internal::fits( nrhs )) return -2;
+        if (! internal::fits( ldb )) return -7;
+    }
+    lapack_int n_ = (lapack_int) n;
+    lapack_int nrhs_ = (lapack_int) nrhs;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int info_ = 0;
+    LAPACK_cgtsv(
+        &n_, &nrhs_, (lapack_complex_float*) DL, (lapack_complex_float*) D, (lapack_complex_float*) DU, (lapack_complex_float*) B, &ldb_, &info_
+        );
+    return info_;
+}
+
+inline int64_t gtsv(
+    int64_t n, int64_t nrhs,
+    std::complex<double>* DL,
+    std::complex<double>* D,
+    std::complex<double>* DU,
+    std::complex<double>* B, int64_t ldb,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( n )) return -1;
+        if (! internal::fits( nrhs )) return -2;
+        if (! internal::fits( ldb )) return -7;
+    }
+    lapack_int n_ = (lapack_int) n;
+    lapack_int nrhs_ = (lapack_int) nrhs;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int info_ = 0;
+    LAPACK_zgtsv(
+        &n_, &nrhs_, (lapack_complex_double*) DL, (lapack_complex_double*) D, (lapack_complex_double*) DU, (lapack_complex_double*) B, &ldb_, &info_
+        );
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// Reduces a generalized Hermitian-definite eigenproblem to standard
+/// form, using the Cholesky factor of B from potrf (sygst for real
+/// types); see lapack::hegst.
+/// @ingroup hygv
+inline int64_t hegst(
+    int64_t itype, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float const* B, int64_t ldb,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( itype )) return -1;
+        if (! internal::fits( n )) return -3;
+        if (! internal::fits( lda )) return -5;
+        if (! internal::fits( ldb )) return -7;
+    }
+    char uplo_ = uplo2char( uplo );
+    lapack_int itype_ = (lapack_int) itype;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int info_ = 0;
+    LAPACK_ssygst(
+        &itype_, &uplo_, &n_, A, &lda_, B, &ldb_, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+        );
+    return info_;
+}
+
+inline int64_t hegst(
+    int64_t itype, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double const* B, int64_t ldb,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( itype )) return -1;
+        if (! internal::fits( n )) return -3;
+        if (! internal::fits( lda )) return -5;
+        if (! internal::fits( ldb )) return -7;
+    }
+    char uplo_ = uplo2char( uplo );
+    lapack_int itype_ = (lapack_int) itype;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int info_ = 0;
+    LAPACK_dsygst(
+        &itype_, &uplo_, &n_, A, &lda_, B, &ldb_, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+        );
+    return info_;
+}
+
+inline int64_t hegst(
+    int64_t itype, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float> const* B, int64_t ldb,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( itype )) return -1;
+        if (! internal::fits( n )) return -3;
+        if (! internal::fits( lda )) return -5;
+        if (! internal::fits( ldb )) return -7;
+    }
+    char uplo_ = uplo2char( uplo );
+    lapack_int itype_ = (lapack_int) itype;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int info_ = 0;
+    LAPACK_chegst(
+        &itype_, &uplo_, &n_, (lapack_complex_float*) A, &lda_, (lapack_complex_float*) B, &ldb_, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+        );
+    return info_;
+}
+
+inline int64_t hegst(
+    int64_t itype, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double> const* B, int64_t ldb,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( itype )) return -1;
+        if (! internal::fits( n )) return -3;
+        if (! internal::fits( lda )) return -5;
+        if (! internal::fits( ldb )) return -7;
+    }
+    char uplo_ = uplo2char( uplo );
+    lapack_int itype_ = (lapack_int) itype;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int info_ = 0;
+    LAPACK_zhegst(
+        &itype_, &uplo_, &n_, (lapack_complex_double*) A, &lda_, (lapack_complex_double*) B, &ldb_, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+        );
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// Solves a triangular system; see lapack::trtrs.
+/// @ingroup trsv_computational
+inline int64_t trtrs(
+    lapack::Uplo uplo, lapack::Op trans, lapack::Diag diag,
+    int64_t n, int64_t nrhs,
+    float const* A, int64_t lda,
+    float* B, int64_t ldb,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( n )) return -4;
+        if (! internal::fits( nrhs )) return -5;
+        if (! internal::fits( lda )) return -7;
+        if (! internal::fits( ldb )) return -9;
+    }
+    char uplo_ = uplo2char( uplo );
+    char trans_ = op2char( trans );
+    char diag_ = diag2char( diag );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int nrhs_ = (lapack_int) nrhs;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int info_ = 0;
+    LAPACK_strtrs(
+        &uplo_, &trans_, &diag_, &n_, &nrhs_, A, &lda_,
+        B, &ldb_, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1, 1, 1
+        #endif
+        );
+    return info_;
+}
+
+inline int64_t trtrs(
+    lapack::Uplo uplo, lapack::Op trans, lapack::Diag diag,
+    int64_t n, int64_t nrhs,
+    double const* A, int64_t lda,
+    double* B, int64_t ldb,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( n )) return -4;
+        if (! internal::fits( nrhs )) return -5;
+        if (! internal::fits( lda )) return -7;
+        if (! internal::fits( ldb )) return -9;
+    }
+    char uplo_ = uplo2char( uplo );
+    char trans_ = op2char( trans );
+    char diag_ = diag2char( diag );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int nrhs_ = (lapack_int) nrhs;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int info_ = 0;
+    LAPACK_dtrtrs(
+        &uplo_, &trans_, &diag_, &n_, &nrhs_, A, &lda_,
+        B, &ldb_, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1, 1, 1
+        #endif
+        );
+    return info_;
+}
+
+inline int64_t trtrs(
+    lapack::Uplo uplo, lapack::Op trans, lapack::Diag diag,
+    int64_t n, int64_t nrhs,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( n )) return -4;
+        if (! internal::fits( nrhs )) return -5;
+        if (! internal::fits( lda )) return -7;
+        if (! internal::fits( ldb )) return -9;
+    }
+    char uplo_ = uplo2char( uplo );
+    char trans_ = op2char( trans );
+    char diag_ = diag2char( diag );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int nrhs_ = (lapack_int) nrhs;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int info_ = 0;
+    LAPACK_ctrtrs(
+        &uplo_, &trans_, &diag_, &n_, &nrhs_, (lapack_complex_float*) A, &lda_,
+        (lapack_complex_float*) B, &ldb_, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1, 1, 1
+        #endif
+        );
+    return info_;
+}
+
+inline int64_t trtrs(
+    lapack::Uplo uplo, lapack::Op trans, lapack::Diag diag,
+    int64_t n, int64_t nrhs,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( n )) return -4;
+        if (! internal::fits( nrhs )) return -5;
+        if (! internal::fits( lda )) return -7;
+        if (! internal::fits( ldb )) return -9;
+    }
+    char uplo_ = uplo2char( uplo );
+    char trans_ = op2char( trans );
+    char diag_ = diag2char( diag );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int nrhs_ = (lapack_int) nrhs;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int info_ = 0;
+    LAPACK_ztrtrs(
+        &uplo_, &trans_, &diag_, &n_, &nrhs_, (lapack_complex_double*) A, &lda_,
+        (lapack_complex_double*) B, &ldb_, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1, 1, 1
+        #endif
+        );
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// Estimates reciprocal condition number of a triangular matrix;
+/// see lapack::trcon. The caller provides workspace: work of length 3n
+/// for real types, 2n for complex types; rwork of length n, used only
+/// for complex types; iwork of length n, used only for real types.
+/// @ingroup trsv_computational
+inline int64_t trcon(
+    lapack::Norm norm, lapack::Uplo uplo, lapack::Diag diag,
+    int64_t n,
+    float const* A, int64_t lda,
+    float* rcond,
+    float* work, float* /* rwork */, lapack_int* iwork,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( n )) return -4;
+        if (! internal::fits( lda )) return -6;
+    }
+    char norm_ = norm2char( norm );
+    char uplo_ = uplo2char( uplo );
+    char diag_ = diag2char( diag );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int info_ = 0;
+    LAPACK_strcon(
+        &norm_, &uplo_, &diag_, &n_, A, &lda_, rcond,
+        work, iwork, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1, 1, 1
+        #endif
+        );
+    return info_;
+}
+
+inline int64_t trcon(
+    lapack::Norm norm, lapack::Uplo uplo, lapack::Diag diag,
+    int64_t n,
+    double const* A, int64_t lda,
+    double* rcond,
+    double* work, double* /* rwork */, lapack_int* iwork,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( n )) return -4;
+        if (! internal::fits( lda )) return -6;
+    }
+    char norm_ = norm2char( norm );
+    char uplo_ = uplo2char( uplo );
+    char diag_ = diag2char( diag );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int info_ = 0;
+    LAPACK_dtrcon(
+        &norm_, &uplo_, &diag_, &n_, A, &lda_, rcond,
+        work, iwork, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1, 1, 1
+        #endif
+        );
+    return info_;
+}
+
+inline int64_t trcon(
+    lapack::Norm norm, lapack::Uplo uplo, lapack::Diag diag,
+    int64_t n,
+    std::complex<float> const* A, int64_t lda,
+    float* rcond,
+    std::complex<float>* work, float* rwork, lapack_int* /* iwork */,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( n )) return -4;
+        if (! internal::fits( lda )) return -6;
+    }
+    char norm_ = norm2char( norm );
+    char uplo_ = uplo2char( uplo );
+    char diag_ = diag2char( diag );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int info_ = 0;
+    LAPACK_ctrcon(
+        &norm_, &uplo_, &diag_, &n_, (lapack_complex_float*) A, &lda_, rcond,
+        (lapack_complex_float*) work, rwork, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1, 1, 1
+        #endif
+        );
+    return info_;
+}
+
+inline int64_t trcon(
+    lapack::Norm norm, lapack::Uplo uplo, lapack::Diag diag,
+    int64_t n,
+    std::complex<double> const* A, int64_t lda,
+    double* rcond,
+    std::complex<double>* work, double* rwork, lapack_int* /* iwork */,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( n )) return -4;
+        if (! internal::fits( lda )) return -6;
+    }
+    char norm_ = norm2char( norm );
+    char uplo_ = uplo2char( uplo );
+    char diag_ = diag2char( diag );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int info_ = 0;
+    LAPACK_ztrcon(
+        &norm_, &uplo_, &diag_, &n_, (lapack_complex_double*) A, &lda_, rcond,
+        (lapack_complex_double*) work, rwork, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1, 1, 1
+        #endif
+        );
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// Generates elementary reflector; see lapack::larfg.
+/// @ingroup auxiliary
+inline int64_t larfg(
+    int64_t n,
+    float* alpha,
+    float* X, int64_t incx,
+    float* tau,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( n )) return -1;
+        if (! internal::fits( incx )) return -4;
+    }
+    lapack_int n_ = (lapack_int) n;
+    lapack_int incx_ = (lapack_int) incx;
+    LAPACK_slarfg( &n_, alpha, X, &incx_, tau );
+    return 0;
+}
+
+inline int64_t larfg(
+    int64_t n,
+    double* alpha,
+    double* X, int64_t incx,
+    double* tau,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( n )) return -1;
+        if (! internal::fits( incx )) return -4;
+    }
+    lapack_int n_ = (lapack_int) n;
+    lapack_int incx_ = (lapack_int) incx;
+    LAPACK_dlarfg( &n_, alpha, X, &incx_, tau );
+    return 0;
+}
+
+inline int64_t larfg(
+    int64_t n,
+    std::complex<float>* alpha,
+    std::complex<float>* X, int64_t incx,
+    std::complex<float>* tau,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( n )) return -1;
+        if (! internal::fits( incx )) return -4;
+    }
+    lapack_int n_ = (lapack_int) n;
+    lapack_int incx_ = (lapack_int) incx;
+    LAPACK_clarfg( &n_, (lapack_complex_float*) alpha, (lapack_complex_float*) X, &incx_, (lapack_complex_float*) tau );
+    return 0;
+}
+
+inline int64_t larfg(
+    int64_t n,
+    std::complex<double>* alpha,
+    std::complex<double>* X, int64_t incx,
+    std::complex<double>* tau,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( n )) return -1;
+        if (! internal::fits( incx )) return -4;
+    }
+    lapack_int n_ = (lapack_int) n;
+    lapack_int incx_ = (lapack_int) incx;
+    LAPACK_zlarfg( &n_, (lapack_complex_double*) alpha, (lapack_complex_double*) X, &incx_, (lapack_complex_double*) tau );
+    return 0;
+}
+
+// -----------------------------------------------------------------------------
+/// Copies all or part of a matrix; see lapack::lacpy.
+/// @ingroup auxiliary
+inline int64_t lacpy(
+    lapack::MatrixType matrixtype, int64_t m, int64_t n,
+    float const* A, int64_t lda,
+    float* B, int64_t ldb,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( m )) return -2;
+        if (! internal::fits( n )) return -3;
+        if (! internal::fits( lda )) return -5;
+        if (! internal::fits( ldb )) return -7;
+    }
+    char matrixtype_ = matrixtype2char( matrixtype );
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    LAPACK_slacpy(
+        &matrixtype_, &m_, &n_, A, &lda_, B, &ldb_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+        );
+    return 0;
+}
+
+inline int64_t lacpy(
+    lapack::MatrixType matrixtype, int64_t m, int64_t n,
+    double const* A, int64_t lda,
+    double* B, int64_t ldb,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( m )) return -2;
+        if (! internal::fits( n )) return -3;
+        if (! internal::fits( lda )) return -5;
+        if (! internal::fits( ldb )) return -7;
+    }
+    char matrixtype_ = matrixtype2char( matrixtype );
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    LAPACK_dlacpy(
+        &matrixtype_, &m_, &n_, A, &lda_, B, &ldb_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+        );
+    return 0;
+}
+
+inline int64_t lacpy(
+    lapack::MatrixType matrixtype, int64_t m, int64_t n,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( m )) return -2;
+        if (! internal::fits( n )) return -3;
+        if (! internal::fits( lda )) return -5;
+        if (! internal::fits( ldb )) return -7;
+    }
+    char matrixtype_ = matrixtype2char( matrixtype );
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    LAPACK_clacpy(
+        &matrixtype_, &m_, &n_, (lapack_complex_float*) A, &lda_, (lapack_complex_float*) B, &ldb_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+        );
+    return 0;
+}
+
+inline int64_t lacpy(
+    lapack::MatrixType matrixtype, int64_t m, int64_t n,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( m )) return -2;
+        if (! internal::fits( n )) return -3;
+        if (! internal::fits( lda )) return -5;
+        if (! internal::fits( ldb )) return -7;
+    }
+    char matrixtype_ = matrixtype2char( matrixtype );
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    LAPACK_zlacpy(
+        &matrixtype_, &m_, &n_, (lapack_complex_double*) A, &lda_, (lapack_complex_double*) B, &ldb_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+        );
+    return 0;
+}
+
+// -----------------------------------------------------------------------------
+/// Matrix norm; see lapack::lange. The caller provides workspace
+/// of length m for norm = Inf. Returns -1 if an argument overflows.
+/// @ingroup norm
+inline float lange(
+    lapack::Norm norm, int64_t m, int64_t n,
+    float const* A, int64_t lda,
+    float* work,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( m ) || ! internal::fits( n )
+            || ! internal::fits( lda ))
+            return -1;
+    }
+    char norm_ = norm2char( norm );
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    return LAPACK_slange(
+        &norm_, &m_, &n_, A, &lda_, work
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+        );
+}
+
+inline double lange(
+    lapack::Norm norm, int64_t m, int64_t n,
+    double const* A, int64_t lda,
+    double* work,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( m ) || ! internal::fits( n )
+            || ! internal::fits( lda ))
+            return -1;
+    }
+    char norm_ = norm2char( norm );
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    return LAPACK_dlange(
+        &norm_, &m_, &n_, A, &lda_, work
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+        );
+}
+
+inline float lange(
+    lapack::Norm norm, int64_t m, int64_t n,
+    std::complex<float> const* A, int64_t lda,
+    float* work,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( m ) || ! internal::fits( n )
+            || ! internal::fits( lda ))
+            return -1;
+    }
+    char norm_ = norm2char( norm );
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    return LAPACK_clange(
+        &norm_, &m_, &n_, (lapack_complex_float*) A, &lda_, work
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+        );
+}
+
+inline double lange(
+    lapack::Norm norm, int64_t m, int64_t n,
+    std::complex<double> const* A, int64_t lda,
+    double* work,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( m ) || ! internal::fits( n )
+            || ! internal::fits( lda ))
+            return -1;
+    }
+    char norm_ = norm2char( norm );
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    return LAPACK_zlange(
+        &norm_, &m_, &n_, (lapack_complex_double*) A, &lda_, work
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+        );
+}
+
+// -----------------------------------------------------------------------------
+/// Hermitian matrix norm (lansy for real types); see lapack::lanhe.
+/// The caller provides workspace of length n for norm = One or Inf.
+/// Returns -1 if an argument overflows.
+/// @ingroup norm
+inline float lanhe(
+    lapack::Norm norm, lapack::Uplo uplo, int64_t n,
+    float const* A, int64_t lda,
+    float* work,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( n ) || ! internal::fits( lda ))
+            return -1;
+    }
+    char norm_ = norm2char( norm );
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    return LAPACK_slansy(
+        &norm_, &uplo_, &n_, A, &lda_, work
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1, 1
+        #endif
+        );
+}
+
+inline double lanhe(
+    lapack::Norm norm, lapack::Uplo uplo, int64_t n,
+    double const* A, int64_t lda,
+    double* work,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( n ) || ! internal::fits( lda ))
+            return -1;
+    }
+    char norm_ = norm2char( norm );
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    return LAPACK_dlansy(
+        &norm_, &uplo_, &n_, A, &lda_, work
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1, 1
+        #endif
+        );
+}
+
+inline float lanhe(
+    lapack::Norm norm, lapack::Uplo uplo, int64_t n,
+    std::complex<float> const* A, int64_t lda,
+    float* work,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( n ) || ! internal::fits( lda ))
+            return -1;
+    }
+    char norm_ = norm2char( norm );
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    return LAPACK_clanhe(
+        &norm_, &uplo_, &n_, (lapack_complex_float*) A, &lda_, work
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1, 1
+        #endif
+        );
+}
+
+inline double lanhe(
+    lapack::Norm norm, lapack::Uplo uplo, int64_t n,
+    std::complex<double> const* A, int64_t lda,
+    double* work,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( n ) || ! internal::fits( lda ))
+            return -1;
+    }
+    char norm_ = norm2char( norm );
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    return LAPACK_zlanhe(
+        &norm_, &uplo_, &n_, (lapack_complex_double*) A, &lda_, work
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1, 1
+        #endif
+        );
+}
+
+// -----------------------------------------------------------------------------
+/// Hermitian eigenvalues (syev for real types); see lapack::heev.
+/// The caller provides workspace; lwork = -1 queries its optimal size,
+/// returned in work[ 0 ]. For complex types, rwork has length
+/// max( 1, 3n - 2 ).
+/// @ingroup heev
+inline int64_t heev(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* W,
+    float* work, int64_t lwork,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( n )) return -3;
+        if (! internal::fits( lda )) return -5;
+        if (! internal::fits( lwork )) return -8;
+    }
+    char jobz_ = job2char( jobz );
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+    LAPACK_ssyev(
+        &jobz_, &uplo_, &n_, A, &lda_, W,
+        work, &lwork_, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1, 1
+        #endif
+        );
+    return info_;
+}
+
+inline int64_t heev(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* W,
+    double* work, int64_t lwork,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( n )) return -3;
+        if (! internal::fits( lda )) return -5;
+        if (! internal::fits( lwork )) return -8;
+    }
+    char jobz_ = job2char( jobz );
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+    LAPACK_dsyev(
+        &jobz_, &uplo_, &n_, A, &lda_, W,
+        work, &lwork_, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1, 1
+        #endif
+        );
+    return info_;
+}
+
+inline int64_t heev(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* W,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( n )) return -3;
+        if (! internal::fits( lda )) return -5;
+        if (! internal::fits( lwork )) return -8;
+    }
+    char jobz_ = job2char( jobz );
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+    LAPACK_cheev(
+        &jobz_, &uplo_, &n_, (lapack_complex_float*) A, &lda_, W,
+        (lapack_complex_float*) work, &lwork_, rwork, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1, 1
+        #endif
+        );
+    return info_;
+}
+
+inline int64_t heev(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* W,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( n )) return -3;
+        if (! internal::fits( lda )) return -5;
+        if (! internal::fits( lwork )) return -8;
+    }
+    char jobz_ = job2char( jobz );
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+    LAPACK_zheev(
+        &jobz_, &uplo_, &n_, (lapack_complex_double*) A, &lda_, W,
+        (lapack_complex_double*) work, &lwork_, rwork, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1, 1
+        #endif
+        );
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// Hermitian eigenvalues by divide and conquer (syevd for real types);
+/// see lapack::heevd. The caller provides workspace; lwork = lrwork =
+/// liwork = -1 queries their optimal sizes, returned in work[ 0 ],
+/// rwork[ 0 ], and iwork[ 0 ]. rwork is used only for complex types.
+/// @ingroup heev
+inline int64_t heevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* W,
+    float* work, int64_t lwork,
+    float* /* rwork */, int64_t /* lrwork */,
+    lapack_int* iwork, int64_t liwork,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( n )) return -3;
+        if (! internal::fits( lda )) return -5;
+        if (! internal::fits( lwork )) return -8;
+        if (! internal::fits( liwork )) return -10;
+    }
+    char jobz_ = job2char( jobz );
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int liwork_ = (lapack_int) liwork;
+    lapack_int info_ = 0;
+    LAPACK_ssyevd(
+        &jobz_, &uplo_, &n_, A, &lda_, W,
+        work, &lwork_, iwork, &liwork_, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1, 1
+        #endif
+        );
+    return info_;
+}
+
+inline int64_t heevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* W,
+    double* work, int64_t lwork,
+    double* /* rwork */, int64_t /* lrwork */,
+    lapack_int* iwork, int64_t liwork,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( n )) return -3;
+        if (! internal::fits( lda )) return -5;
+        if (! internal::fits( lwork )) return -8;
+        if (! internal::fits( liwork )) return -10;
+    }
+    char jobz_ = job2char( jobz );
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int liwork_ = (lapack_int) liwork;
+    lapack_int info_ = 0;
+    LAPACK_dsyevd(
+        &jobz_, &uplo_, &n_, A, &lda_, W,
+        work, &lwork_, iwork, &liwork_, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1, 1
+        #endif
+        );
+    return info_;
+}
+
+inline int64_t heevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* W,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork,
+    lapack_int* iwork, int64_t liwork,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( n )) return -3;
+        if (! internal::fits( lda )) return -5;
+        if (! internal::fits( lwork )) return -8;
+        if (! internal::fits( lrwork )) return -10;
+        if (! internal::fits( liwork )) return -12;
+    }
+    char jobz_ = job2char( jobz );
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int lrwork_ = (lapack_int) lrwork;
+    lapack_int liwork_ = (lapack_int) liwork;
+    lapack_int info_ = 0;
+    LAPACK_cheevd(
+        &jobz_, &uplo_, &n_, (lapack_complex_float*) A, &lda_, W,
+        (lapack_complex_float*) work, &lwork_, rwork, &lrwork_, iwork, &liwork_, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1, 1
+        #endif
+        );
+    return info_;
+}
+
+inline int64_t heevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* W,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork,
+    lapack_int* iwork, int64_t liwork,
+    Check check = Check::Overflow ) noexcept
+{
+    if (check == Check::Overflow) {
+        if (! internal::fits( n )) return -3;
+        if (! internal::fits( lda )) return -5;
+        if (! internal::fits( lwork )) return -8;
+        if (! internal::fits( lrwork )) return -10;
+        if (! internal::fits( liwork )) return -12;
+    }
+    char jobz_ = job2char( jobz );
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int lrwork_ = (lapack_int) lrwork;
+    lapack_int liwork_ = (lapack_int) liwork;
+    lapack_int info_ = 0;
+    LAPACK_zheevd(
+        &jobz_, &uplo_, &n_, (lapack_complex_double*) A, &lda_, W,
+        (lapack_complex_double*) work, &lwork_, rwork, &lrwork_, iwork, &liwork_, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1, 1
+        #endif
+        );
+    return info_;
+}
+
+}  // namespace nothrow
+}  // namespace lapack
+
+#endif // LAPACK_NOTHROW_HH
@@ -0,0 +1,55 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_THREADS_HH
+#define LAPACK_THREADS_HH
+
+namespace lapack {
+
+// -----------------------------------------------------------------------------
+// Number of threads used by the BLAS and LAPACK backend: MKL, OpenBLAS,
+// or OpenMP, as detected at configure time; see thread_backend.
+// With other backends, set_num_threads does nothing and get_num_threads
+// returns 1.
+void set_num_threads( int nthreads );
+int get_num_threads();
+
+const char* thread_backend();
+
+// -----------------------------------------------------------------------------
+/// Limits the BLAS and LAPACK backend to nthreads threads for the lifetime
+/// of the scope, restoring the previous setting on exit, e.g., to avoid
+/// oversubscription when calling LAPACK++ from inside a parallel region:
+///
+///     #pragma omp parallel for
+///     for (int64_t i = 0; i < batch; ++i) {
+///         lapack::ThreadScope scope( 1 );
+///         lapack::potrf( uplo, n, A[ i ], lda );
+///     }
+///
+/// With MKL and OpenMP, the setting applies only to the calling thread.
+/// OpenBLAS has only a process-wide setting, so while any scopes are
+/// active, it uses the fewest threads any of them requested, and the
+/// original setting is restored when the last scope exits.
+///
+class ThreadScope {
+public:
+    explicit ThreadScope( int nthreads );
+    ~ThreadScope();
+
+    ThreadScope( ThreadScope const& ) = delete;
+    ThreadScope& operator = ( ThreadScope const& ) = delete;
+
+    /// @return number of threads requested by this scope.
+    int nthreads() const { return nthreads_; }
+
+private:
+    int nthreads_;
+    int saved_;
+};
+
+}  // namespace lapack
+
+#endif // LAPACK_THREADS_HH
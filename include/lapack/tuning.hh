@@ -0,0 +1,238 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_TUNING_HH
+#define LAPACK_TUNING_HH
+
+#include "lapack/util.hh"
+
+#include <complex>
+#include <string>
+#include <vector>
+
+namespace lapack {
+
+// -----------------------------------------------------------------------------
+/// Drivers that eig_auto chooses among. ev, evd, evr, evx are
+/// heev, heevd, heevr, heevx (syev, ... for real types).
+/// The 2-stage variants compute only eigenvalues (jobz = NoVec).
+enum class EigDriver {
+    Auto = 0,       ///< use tuning table, or built-in default
+    ev,
+    evd,
+    evr,
+    evx,
+    ev_2stage,
+    evd_2stage,
+    evr_2stage,
+    evx_2stage,
+};
+
+/// Drivers that svd_auto chooses among.
+enum class SvdDriver {
+    Auto = 0,       ///< use tuning table, or built-in default
+    gesvd,
+    gesdd,
+    gesvdx,
+};
+
+const char* eigdriver2str( lapack::EigDriver driver );
+lapack::EigDriver str2eigdriver( const char* driver );
+
+const char* svddriver2str( lapack::SvdDriver driver );
+lapack::SvdDriver str2svddriver( const char* driver );
+
+// -----------------------------------------------------------------------------
+// Override API. Forces eig_auto or svd_auto to use the given driver,
+// process-wide, where the driver supports the requested job;
+// Auto reverts to the tuning table.
+void set_eig_driver( lapack::EigDriver driver );
+lapack::EigDriver get_eig_driver();
+
+void set_svd_driver( lapack::SvdDriver driver );
+lapack::SvdDriver get_svd_driver();
+
+// -----------------------------------------------------------------------------
+// Tuning table, mapping problem shape to the fastest measured driver.
+// Written by `tester autotune-eig autotune-svd --tuning file`
+// (`make autotune`); read at first use from $LAPACKPP_TUNING_FILE, if set.
+void load_tuning_table( std::string const& filename );
+void save_tuning_table( std::string const& filename );
+void clear_tuning_table();
+
+void set_eig_tuning(
+    char type, lapack::Job jobz, int64_t n, int64_t nwanted,
+    lapack::EigDriver driver );
+
+void set_svd_tuning(
+    char type, lapack::Job jobz, int64_t m, int64_t n, int64_t nwanted,
+    lapack::SvdDriver driver );
+
+lapack::EigDriver select_eig_driver(
+    char type, lapack::Job jobz, int64_t n, int64_t nwanted );
+
+lapack::SvdDriver select_svd_driver(
+    char type, lapack::Job jobz, int64_t m, int64_t n, int64_t nwanted );
+
+// -----------------------------------------------------------------------------
+// Block sizes returned by LAPACK++'s ilaenv override, which replaces the
+// backend's ilaenv when built with CMake -Dilaenv_override=yes.
+// Entries are also saved in and loaded from the tuning table;
+// `tester autotune-nb-*` searches for the fastest.
+void set_block_size(
+    std::string const& routine, int64_t nb, int64_t nx=-1, int64_t n=-1 );
+
+int64_t get_block_size(
+    std::string const& routine, int64_t n, int64_t* nx=nullptr );
+
+bool ilaenv_override_enabled();
+int64_t ilaenv_override_calls();
+
+// -----------------------------------------------------------------------------
+// Runtime dispatch among LAPACK libraries, when built with CMake
+// -Ddispatch=yes. add_backend names a library to dlopen; set_backend routes
+// a routine, e.g., "dgetrf", or "getrf" for all types, to a backend instead
+// of the LAPACK linked at build time, named "default". Backends and routes
+// are saved in and loaded from the tuning table;
+// `tester autotune-backend-*` searches for the fastest.
+void add_backend( std::string const& name, std::string const& path );
+std::vector< std::string > get_backends();
+
+void set_backend(
+    std::string const& routine, std::string const& backend, int64_t n=-1 );
+
+std::string get_backend( std::string const& routine, int64_t n );
+
+bool dispatch_enabled();
+
+// -----------------------------------------------------------------------------
+lapack::EigDriver default_eig_driver(
+    lapack::Job jobz, int64_t n, int64_t nwanted );
+
+lapack::SvdDriver default_svd_driver(
+    lapack::Job jobz, int64_t m, int64_t n, int64_t nwanted );
+
+// -----------------------------------------------------------------------------
+// All eigenvalues; same arguments and results as heev.
+int64_t eig_auto(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* W );
+
+int64_t eig_auto(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* W );
+
+int64_t eig_auto(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* W );
+
+int64_t eig_auto(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* W );
+
+// -----------------------------------------------------------------------------
+// Eigenvalues il, ..., iu; same arguments and results as heevr
+// with range = Index.
+int64_t eig_auto(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, int64_t il, int64_t iu,
+    int64_t* nfound,
+    float* W,
+    float* Z, int64_t ldz );
+
+int64_t eig_auto(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, int64_t il, int64_t iu,
+    int64_t* nfound,
+    double* W,
+    double* Z, int64_t ldz );
+
+int64_t eig_auto(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda, int64_t il, int64_t iu,
+    int64_t* nfound,
+    float* W,
+    std::complex<float>* Z, int64_t ldz );
+
+int64_t eig_auto(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda, int64_t il, int64_t iu,
+    int64_t* nfound,
+    double* W,
+    std::complex<double>* Z, int64_t ldz );
+
+// -----------------------------------------------------------------------------
+// All singular values; same arguments and results as gesvd,
+// except jobu, jobvt = OverwriteVec is not supported.
+int64_t svd_auto(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* S,
+    float* U, int64_t ldu,
+    float* VT, int64_t ldvt );
+
+int64_t svd_auto(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* S,
+    double* U, int64_t ldu,
+    double* VT, int64_t ldvt );
+
+int64_t svd_auto(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* S,
+    std::complex<float>* U, int64_t ldu,
+    std::complex<float>* VT, int64_t ldvt );
+
+int64_t svd_auto(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* S,
+    std::complex<double>* U, int64_t ldu,
+    std::complex<double>* VT, int64_t ldvt );
+
+// -----------------------------------------------------------------------------
+// Singular values il, ..., iu, in descending order; same arguments and
+// results as gesvdx with range = Index.
+int64_t svd_auto(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    float* A, int64_t lda, int64_t il, int64_t iu,
+    int64_t* nfound,
+    float* S,
+    float* U, int64_t ldu,
+    float* VT, int64_t ldvt );
+
+int64_t svd_auto(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    double* A, int64_t lda, int64_t il, int64_t iu,
+    int64_t* nfound,
+    double* S,
+    double* U, int64_t ldu,
+    double* VT, int64_t ldvt );
+
+int64_t svd_auto(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda, int64_t il, int64_t iu,
+    int64_t* nfound,
+    float* S,
+    std::complex<float>* U, int64_t ldu,
+    std::complex<float>* VT, int64_t ldvt );
+
+int64_t svd_auto(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda, int64_t il, int64_t iu,
+    int64_t* nfound,
+    double* S,
+    std::complex<double>* U, int64_t ldu,
+    std::complex<double>* VT, int64_t ldvt );
+
+}  // namespace lapack
+
+#endif // LAPACK_TUNING_HH
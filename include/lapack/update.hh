@@ -0,0 +1,220 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_UPDATE_HH
+#define LAPACK_UPDATE_HH
+
+#include "lapack/util.hh"
+
+#include <complex>
+
+namespace lapack {
+
+// -----------------------------------------------------------------------------
+// Low-rank updates of existing factorizations, in O(k n^2) instead of
+// refactoring in O(n^3).
+
+// -----------------------------------------------------------------------------
+// Cholesky update, A + X X^H, and downdate, A - X X^H.
+int64_t potrf_update(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    float* A, int64_t lda,
+    float* X, int64_t ldx );
+
+int64_t potrf_update(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    double* A, int64_t lda,
+    double* X, int64_t ldx );
+
+int64_t potrf_update(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* X, int64_t ldx );
+
+int64_t potrf_update(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* X, int64_t ldx );
+
+int64_t potrf_downdate(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    float* A, int64_t lda,
+    float* X, int64_t ldx );
+
+int64_t potrf_downdate(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    double* A, int64_t lda,
+    double* X, int64_t ldx );
+
+int64_t potrf_downdate(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* X, int64_t ldx );
+
+int64_t potrf_downdate(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* X, int64_t ldx );
+
+// -----------------------------------------------------------------------------
+// QR updates of full m-by-m Q and m-by-n R, A + u v^H,
+// and inserting or deleting a column or row of A.
+void qr_update(
+    int64_t m, int64_t n,
+    float* Q, int64_t ldq,
+    float* R, int64_t ldr,
+    float const* u, float const* v );
+
+void qr_update(
+    int64_t m, int64_t n,
+    double* Q, int64_t ldq,
+    double* R, int64_t ldr,
+    double const* u, double const* v );
+
+void qr_update(
+    int64_t m, int64_t n,
+    std::complex<float>* Q, int64_t ldq,
+    std::complex<float>* R, int64_t ldr,
+    std::complex<float> const* u, std::complex<float> const* v );
+
+void qr_update(
+    int64_t m, int64_t n,
+    std::complex<double>* Q, int64_t ldq,
+    std::complex<double>* R, int64_t ldr,
+    std::complex<double> const* u, std::complex<double> const* v );
+
+void qr_insert_col(
+    int64_t m, int64_t n,
+    float* Q, int64_t ldq,
+    float* R, int64_t ldr,
+    int64_t j, float const* x );
+
+void qr_insert_col(
+    int64_t m, int64_t n,
+    double* Q, int64_t ldq,
+    double* R, int64_t ldr,
+    int64_t j, double const* x );
+
+void qr_insert_col(
+    int64_t m, int64_t n,
+    std::complex<float>* Q, int64_t ldq,
+    std::complex<float>* R, int64_t ldr,
+    int64_t j, std::complex<float> const* x );
+
+void qr_insert_col(
+    int64_t m, int64_t n,
+    std::complex<double>* Q, int64_t ldq,
+    std::complex<double>* R, int64_t ldr,
+    int64_t j, std::complex<double> const* x );
+
+void qr_delete_col(
+    int64_t m, int64_t n,
+    float* Q, int64_t ldq,
+    float* R, int64_t ldr,
+    int64_t j );
+
+void qr_delete_col(
+    int64_t m, int64_t n,
+    double* Q, int64_t ldq,
+    double* R, int64_t ldr,
+    int64_t j );
+
+void qr_delete_col(
+    int64_t m, int64_t n,
+    std::complex<float>* Q, int64_t ldq,
+    std::complex<float>* R, int64_t ldr,
+    int64_t j );
+
+void qr_delete_col(
+    int64_t m, int64_t n,
+    std::complex<double>* Q, int64_t ldq,
+    std::complex<double>* R, int64_t ldr,
+    int64_t j );
+
+void qr_insert_row(
+    int64_t m, int64_t n,
+    float* Q, int64_t ldq,
+    float* R, int64_t ldr,
+    int64_t i, float const* x );
+
+void qr_insert_row(
+    int64_t m, int64_t n,
+    double* Q, int64_t ldq,
+    double* R, int64_t ldr,
+    int64_t i, double const* x );
+
+void qr_insert_row(
+    int64_t m, int64_t n,
+    std::complex<float>* Q, int64_t ldq,
+    std::complex<float>* R, int64_t ldr,
+    int64_t i, std::complex<float> const* x );
+
+void qr_insert_row(
+    int64_t m, int64_t n,
+    std::complex<double>* Q, int64_t ldq,
+    std::complex<double>* R, int64_t ldr,
+    int64_t i, std::complex<double> const* x );
+
+void qr_delete_row(
+    int64_t m, int64_t n,
+    float* Q, int64_t ldq,
+    float* R, int64_t ldr,
+    int64_t i );
+
+void qr_delete_row(
+    int64_t m, int64_t n,
+    double* Q, int64_t ldq,
+    double* R, int64_t ldr,
+    int64_t i );
+
+void qr_delete_row(
+    int64_t m, int64_t n,
+    std::complex<float>* Q, int64_t ldq,
+    std::complex<float>* R, int64_t ldr,
+    int64_t i );
+
+void qr_delete_row(
+    int64_t m, int64_t n,
+    std::complex<double>* Q, int64_t ldq,
+    std::complex<double>* R, int64_t ldr,
+    int64_t i );
+
+// -----------------------------------------------------------------------------
+// All n roots of the secular equation for D + rho z z^T, as laed4 finds one.
+int64_t laed4_all(
+    int64_t n,
+    float const* d,
+    float const* z,
+    float* delta, int64_t lddelta,
+    float rho,
+    float* lambda );
+
+int64_t laed4_all(
+    int64_t n,
+    double const* d,
+    double const* z,
+    double* delta, int64_t lddelta,
+    double rho,
+    double* lambda );
+
+// -----------------------------------------------------------------------------
+// Symmetric eigendecomposition update, A + rho z z^T.
+int64_t syev_update(
+    lapack::Job jobz, int64_t n,
+    float* D,
+    float* Q, int64_t ldq,
+    float rho,
+    float const* z );
+
+int64_t syev_update(
+    lapack::Job jobz, int64_t n,
+    double* D,
+    double* Q, int64_t ldq,
+    double rho,
+    double const* z );
+
+}  // namespace lapack
+
+#endif // LAPACK_UPDATE_HH
@@ -3591,6 +3591,7 @@ void lacp2(
     double const* A, int64_t lda,
     std::complex<double>* B, int64_t ldb );
 
+#ifndef LAPACK_INLINE_WRAPPERS  // see lapack/inline.hh
 // -----------------------------------------------------------------------------
 void lacpy(
     lapack::MatrixType matrixtype, int64_t m, int64_t n,
@@ -3611,6 +3612,7 @@ void lacpy(
     lapack::MatrixType matrixtype, int64_t m, int64_t n,
     std::complex<double> const* A, int64_t lda,
     std::complex<double>* B, int64_t ldb );
+#endif
 
 // -----------------------------------------------------------------------------
 int64_t laed4(
@@ -4059,6 +4061,7 @@ void lapmt(
     std::complex<double>* X, int64_t ldx,
     int64_t* K );
 
+#ifndef LAPACK_INLINE_WRAPPERS  // see lapack/inline.hh
 // -----------------------------------------------------------------------------
 float lapy2(
     float x, float y );
@@ -4072,6 +4075,7 @@ float lapy3(
 
 double lapy3(
     double x, double y, double z );
+#endif
 
 // -----------------------------------------------------------------------------
 void larf(
@@ -4119,6 +4123,7 @@ void larfb(
     std::complex<double> const* T, int64_t ldt,
     std::complex<double>* C, int64_t ldc );
 
+#ifndef LAPACK_INLINE_WRAPPERS  // see lapack/inline.hh
 // -----------------------------------------------------------------------------
 void larfg(
     int64_t n,
@@ -4168,6 +4173,7 @@ void larfgp(
     std::complex<double>* alpha,
     std::complex<double>* X, int64_t incx,
     std::complex<double>* tau );
+#endif
 
 // -----------------------------------------------------------------------------
 void larft(
@@ -4257,6 +4263,7 @@ void larnv(
     int64_t* iseed, int64_t n,
     std::complex<double>* X );
 
+#ifndef LAPACK_INLINE_WRAPPERS  // see lapack/inline.hh
 // -----------------------------------------------------------------------------
 void lartg(
     float f, float g,
@@ -4281,6 +4288,7 @@ void lartg(
     double* cs,
     std::complex<double>* sn,
     std::complex<double>* r );
+#endif
 
 // -----------------------------------------------------------------------------
 void lartgp(
@@ -4323,6 +4331,7 @@ int64_t lascl(
     lapack::MatrixType type, int64_t kl, int64_t ku, double cfrom, double cto, int64_t m, int64_t n,
     std::complex<double>* A, int64_t lda );
 
+#ifndef LAPACK_INLINE_WRAPPERS  // see lapack/inline.hh
 // -----------------------------------------------------------------------------
 void laset(
     lapack::MatrixType matrixtype, int64_t m, int64_t n,
@@ -4343,6 +4352,7 @@ void laset(
     lapack::MatrixType matrixtype, int64_t m, int64_t n,
     std::complex<double> offdiag, std::complex<double> diag,
     std::complex<double>* A, int64_t lda );
+#endif
 
 // -----------------------------------------------------------------------------
 void lassq(
@@ -0,0 +1,124 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "dispatch.hh"
+
+#include <map>
+#include <mutex>
+#include <string>
+
+#ifdef LAPACK_DISPATCH
+    #include <dlfcn.h>
+#endif
+
+namespace lapack {
+
+namespace {
+
+//------------------------------------------------------------------------------
+// Backend library opened with dlopen, and symbols resolved in it so far,
+// including null for symbols it lacks.
+struct Library {
+    void* handle = nullptr;
+    std::map< std::string, void* > symbols;
+};
+
+// Libraries by path. Never closed, since pointers to their routines
+// may be in use by other threads.
+std::map< std::string, Library > s_libraries;
+std::mutex s_libraries_mutex;
+
+//------------------------------------------------------------------------------
+// Returns library at path, opening it on first use, or retrying if it
+// previously failed. Assumes s_libraries_mutex is locked.
+// @throws Error if library can't be opened.
+Library& open_library( std::string const& path )
+{
+    Library& library = s_libraries[ path ];
+    if (library.handle != nullptr)
+        return library;
+
+    #ifdef LAPACK_DISPATCH
+        // RTLD_LOCAL keeps the backend's symbols from replacing the linked
+        // LAPACK's; RTLD_DEEPBIND makes the backend's routines call their
+        // own subroutines (e.g., dgetrf2 from dgetrf) rather than the
+        // linked LAPACK's.
+        int flags = RTLD_LAZY | RTLD_LOCAL;
+        #ifdef RTLD_DEEPBIND
+            flags |= RTLD_DEEPBIND;
+        #endif
+        library.handle = dlopen( path.c_str(), flags );
+        if (library.handle == nullptr) {
+            const char* msg = dlerror();
+            throw Error( "can't open LAPACK backend " + path + ": "
+                         + (msg ? msg : "unknown error") );
+        }
+        return library;
+    #else
+        throw Error( "LAPACK backend " + path + " requires LAPACK++ built"
+                     " with dispatch" );
+    #endif
+}
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+/// @return true if LAPACK++ was built with runtime dispatch among LAPACK
+/// backends (CMake -Ddispatch=yes), so set_backend can take effect.
+///
+bool dispatch_enabled()
+{
+    #ifdef LAPACK_DISPATCH
+        return true;
+    #else
+        return false;
+    #endif
+}
+
+namespace internal {
+
+//------------------------------------------------------------------------------
+// Opens library at path, if not already open.
+// @throws Error if library can't be opened.
+void backend_open( std::string const& path )
+{
+    std::lock_guard< std::mutex > lock( s_libraries_mutex );
+    open_library( path );
+}
+
+//------------------------------------------------------------------------------
+// Returns symbol from library at path, resolving it on first use, or null
+// if the library can't be opened or lacks the symbol. A library that
+// failed to open isn't retried here, only by backend_open.
+void* backend_symbol( std::string const& path, char const* symbol )
+{
+    std::lock_guard< std::mutex > lock( s_libraries_mutex );
+    auto found = s_libraries.find( path );
+    if (found != s_libraries.end() && found->second.handle == nullptr)
+        return nullptr;
+
+    Library* library;
+    try {
+        library = &open_library( path );
+    }
+    catch (Error const&) {
+        return nullptr;
+    }
+
+    auto iter = library->symbols.find( symbol );
+    if (iter != library->symbols.end())
+        return iter->second;
+
+    void* func = nullptr;
+    #ifdef LAPACK_DISPATCH
+        func = dlsym( library->handle, symbol );
+    #endif
+    library->symbols[ symbol ] = func;
+    return func;
+}
+
+}  // namespace internal
+}  // namespace lapack
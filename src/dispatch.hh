@@ -0,0 +1,54 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_DISPATCH_HH
+#define LAPACK_DISPATCH_HH
+
+#include <stdint.h>
+#include <string>
+
+namespace lapack {
+namespace internal {
+
+//------------------------------------------------------------------------------
+// Backend libraries, opened with dlopen. Defined in backend.cc.
+void backend_open( std::string const& path );
+void* backend_symbol( std::string const& path, char const* symbol );
+
+//------------------------------------------------------------------------------
+// Returns symbol, e.g., "dgetrf_", from the backend that the tuning table
+// routes its routine to for problems of size n, or null to use the LAPACK
+// linked at build time. Defined in tuning.cc.
+void* dispatch_symbol( char const* symbol, int64_t n );
+
+//------------------------------------------------------------------------------
+// Returns the function to call for LAPACK routine func, either func itself
+// or the same routine in a backend library set with lapack::set_backend.
+// Without LAPACK_DISPATCH, this is just func.
+template <typename func_t>
+inline func_t* dispatch( func_t* func, char const* symbol, int64_t n )
+{
+    #ifdef LAPACK_DISPATCH
+        void* backend_func = dispatch_symbol( symbol, n );
+        if (backend_func != nullptr)
+            return reinterpret_cast< func_t* >( backend_func );
+    #endif
+    return func;
+}
+
+}  // namespace internal
+}  // namespace lapack
+
+#define LAPACK_DISPATCH_STR_( x ) #x
+#define LAPACK_DISPATCH_STR( x ) LAPACK_DISPATCH_STR_( x )
+
+//------------------------------------------------------------------------------
+// Use in place of the Fortran routine, e.g.,
+//     lapack_dispatch( LAPACK_dgetrf, max( m, n ) )( &m_, &n_, ... );
+// n is the problem size used to look up routes in the tuning table.
+#define lapack_dispatch( func, n ) \
+    lapack::internal::dispatch( func, LAPACK_DISPATCH_STR( func ), n )
+
+#endif // LAPACK_DISPATCH_HH
@@ -0,0 +1,288 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "NoConstructAllocator.hh"
+
+namespace lapack {
+
+using blas::max;
+
+namespace {
+
+inline char type_char( float* )                { return 's'; }
+inline char type_char( double* )               { return 'd'; }
+inline char type_char( std::complex<float>* )  { return 'c'; }
+inline char type_char( std::complex<double>* ) { return 'z'; }
+
+//------------------------------------------------------------------------------
+// Whether driver can compute the requested job in this LAPACK.
+bool eig_supported( EigDriver driver, Job jobz )
+{
+    switch (driver) {
+        case EigDriver::ev:
+        case EigDriver::evd:
+        case EigDriver::evr:
+        case EigDriver::evx:
+            return true;
+
+        // LAPACK's 2-stage drivers don't yet compute eigenvectors
+        case EigDriver::ev_2stage:
+        case EigDriver::evd_2stage:
+        case EigDriver::evr_2stage:
+        case EigDriver::evx_2stage:
+            #if LAPACK_VERSION >= 30700  // >= 3.7
+                return jobz == Job::NoVec;
+            #else
+                return false;
+            #endif
+
+        case EigDriver::Auto:
+            break;
+    }
+    return false;
+}
+
+//------------------------------------------------------------------------------
+// Chooses driver: override, tuning table, or default; falling back
+// to the default if the chosen driver doesn't support jobz.
+EigDriver choose_eig(
+    char type, Job jobz, int64_t n, int64_t nwanted )
+{
+    EigDriver driver = select_eig_driver( type, jobz, n, nwanted );
+    if (! eig_supported( driver, jobz ))
+        driver = default_eig_driver( jobz, n, nwanted );
+    return driver;
+}
+
+//------------------------------------------------------------------------------
+// Calls an all-eigenvalue driver: ev, evd, or their 2-stage variants.
+template <typename scalar_t>
+int64_t eig_all(
+    EigDriver driver, Job jobz, Uplo uplo, int64_t n,
+    scalar_t* A, int64_t lda, blas::real_type<scalar_t>* W )
+{
+    switch (driver) {
+        case EigDriver::evd:
+            return heevd( jobz, uplo, n, A, lda, W );
+
+        #if LAPACK_VERSION >= 30700  // >= 3.7
+        case EigDriver::ev_2stage:
+            return heev_2stage( jobz, uplo, n, A, lda, W );
+
+        case EigDriver::evd_2stage:
+            return heevd_2stage( jobz, uplo, n, A, lda, W );
+        #endif
+
+        default:
+            return heev( jobz, uplo, n, A, lda, W );
+    }
+}
+
+//------------------------------------------------------------------------------
+// Calls a subset driver: evr, evx, or their 2-stage variants.
+template <typename scalar_t>
+int64_t eig_range(
+    EigDriver driver, Job jobz, Range range, Uplo uplo, int64_t n,
+    scalar_t* A, int64_t lda, int64_t il, int64_t iu,
+    int64_t* nfound, blas::real_type<scalar_t>* W,
+    scalar_t* Z, int64_t ldz )
+{
+    using real_t = blas::real_type<scalar_t>;
+    real_t vl = 0, vu = 0, abstol = 0;  // abstol = 0 uses default tolerance
+
+    // isuppz for evr is 2*n; ifail for evx is n
+    lapack::vector< int64_t > iwork( max( 1, 2*n ) );
+
+    switch (driver) {
+        case EigDriver::evx:
+            return heevx( jobz, range, uplo, n, A, lda, vl, vu, il, iu,
+                          abstol, nfound, W, Z, ldz, &iwork[0] );
+
+        #if LAPACK_VERSION >= 30700  // >= 3.7
+        case EigDriver::evr_2stage:
+            return heevr_2stage( jobz, range, uplo, n, A, lda, vl, vu, il, iu,
+                                 abstol, nfound, W, Z, ldz, &iwork[0] );
+
+        case EigDriver::evx_2stage:
+            return heevx_2stage( jobz, range, uplo, n, A, lda, vl, vu, il, iu,
+                                 abstol, nfound, W, Z, ldz, &iwork[0] );
+        #endif
+
+        default:
+            return heevr( jobz, range, uplo, n, A, lda, vl, vu, il, iu,
+                          abstol, nfound, W, Z, ldz, &iwork[0] );
+    }
+}
+
+//------------------------------------------------------------------------------
+bool is_range_driver( EigDriver driver )
+{
+    return driver == EigDriver::evr || driver == EigDriver::evx
+        || driver == EigDriver::evr_2stage || driver == EigDriver::evx_2stage;
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+int64_t eig_auto_all(
+    Job jobz, Uplo uplo, int64_t n,
+    scalar_t* A, int64_t lda,
+    blas::real_type<scalar_t>* W )
+{
+    lapack_error_if( jobz != Job::NoVec && jobz != Job::Vec );
+    lapack_error_if( n < 0 );
+    lapack_error_if( lda < max( 1, n ) );
+
+    EigDriver driver = choose_eig( type_char( A ), jobz, n, n );
+    if (! is_range_driver( driver ))
+        return eig_all( driver, jobz, uplo, n, A, lda, W );
+
+    // evr and evx return vectors in separate Z; copy back to A
+    int64_t ldz = (jobz == Job::Vec ? max( 1, n ) : 1);
+    lapack::vector< scalar_t > Z( jobz == Job::Vec ? ldz*n : 1 );
+    int64_t nfound = 0;
+    int64_t info = eig_range( driver, jobz, Range::All, uplo, n, A, lda, 1, n,
+                              &nfound, W, &Z[0], ldz );
+    if (info == 0 && jobz == Job::Vec)
+        lacpy( MatrixType::General, n, n, &Z[0], ldz, A, lda );
+    return info;
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+int64_t eig_auto_index(
+    Job jobz, Uplo uplo, int64_t n,
+    scalar_t* A, int64_t lda, int64_t il, int64_t iu,
+    int64_t* nfound,
+    blas::real_type<scalar_t>* W,
+    scalar_t* Z, int64_t ldz )
+{
+    lapack_error_if( jobz != Job::NoVec && jobz != Job::Vec );
+    lapack_error_if( n < 0 );
+    lapack_error_if( lda < max( 1, n ) );
+    lapack_error_if( n > 0 && (il < 1 || il > n) );
+    lapack_error_if( n > 0 && (iu < il || iu > n) );
+    lapack_error_if( n == 0 && (il != 1 || iu != 0) );
+    lapack_error_if( ldz < 1 || (jobz == Job::Vec && ldz < n) );
+
+    int64_t nwanted = (n > 0 ? iu - il + 1 : 0);
+    EigDriver driver = choose_eig( type_char( A ), jobz, n, nwanted );
+    if (is_range_driver( driver )) {
+        return eig_range( driver, jobz, Range::Index, uplo, n, A, lda, il, iu,
+                          nfound, W, Z, ldz );
+    }
+
+    // ev and evd compute all eigenpairs; extract il, ..., iu
+    int64_t info = eig_all( driver, jobz, uplo, n, A, lda, W );
+    if (info == 0) {
+        for (int64_t i = 0; i < nwanted; ++i)
+            W[ i ] = W[ il - 1 + i ];
+        if (jobz == Job::Vec) {
+            lacpy( MatrixType::General, n, nwanted,
+                   &A[ (il - 1)*lda ], lda, Z, ldz );
+        }
+        *nfound = nwanted;
+    }
+    return info;
+}
+
+}  // namespace
+
+// -----------------------------------------------------------------------------
+/// Computes all eigenvalues and, optionally, eigenvectors of a
+/// Hermitian matrix A, using whichever of
+/// heev, heevd, heevr, heevx, or their 2-stage variants
+/// the tuning table says is fastest for this size. See select_eig_driver.
+/// Arguments and results are the same as heev.
+///
+/// @ingroup heev
+int64_t eig_auto(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* W )
+{
+    return eig_auto_all( jobz, uplo, n, A, lda, W );
+}
+
+/// @ingroup heev
+int64_t eig_auto(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* W )
+{
+    return eig_auto_all( jobz, uplo, n, A, lda, W );
+}
+
+/// @ingroup heev
+int64_t eig_auto(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* W )
+{
+    return eig_auto_all( jobz, uplo, n, A, lda, W );
+}
+
+/// @ingroup heev
+int64_t eig_auto(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* W )
+{
+    return eig_auto_all( jobz, uplo, n, A, lda, W );
+}
+
+// -----------------------------------------------------------------------------
+/// Computes eigenvalues il, ..., iu (1-based, ascending) and, optionally,
+/// eigenvectors of a Hermitian matrix A, using whichever driver the tuning
+/// table says is fastest for this size and number of wanted eigenvalues.
+/// Arguments and results are the same as heevr with range = Index:
+/// W has length n, and on exit, its first nfound = iu - il + 1 entries
+/// hold the eigenvalues; Z is n-by-nfound. A is destroyed.
+///
+/// @ingroup heev
+int64_t eig_auto(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, int64_t il, int64_t iu,
+    int64_t* nfound,
+    float* W,
+    float* Z, int64_t ldz )
+{
+    return eig_auto_index( jobz, uplo, n, A, lda, il, iu, nfound, W, Z, ldz );
+}
+
+/// @ingroup heev
+int64_t eig_auto(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, int64_t il, int64_t iu,
+    int64_t* nfound,
+    double* W,
+    double* Z, int64_t ldz )
+{
+    return eig_auto_index( jobz, uplo, n, A, lda, il, iu, nfound, W, Z, ldz );
+}
+
+/// @ingroup heev
+int64_t eig_auto(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda, int64_t il, int64_t iu,
+    int64_t* nfound,
+    float* W,
+    std::complex<float>* Z, int64_t ldz )
+{
+    return eig_auto_index( jobz, uplo, n, A, lda, il, iu, nfound, W, Z, ldz );
+}
+
+/// @ingroup heev
+int64_t eig_auto(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda, int64_t il, int64_t iu,
+    int64_t* nfound,
+    double* W,
+    std::complex<double>* Z, int64_t ldz )
+{
+    return eig_auto_index( jobz, uplo, n, A, lda, il, iu, nfound, W, Z, ldz );
+}
+
+}  // namespace lapack
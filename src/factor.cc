@@ -0,0 +1,1943 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack/factor.hh"
+#include "lapack/threads.hh"
+#include "lapack/nothrow.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#ifdef _OPENMP
+    #include <omp.h>
+#endif
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+using blas::real;
+using nothrow::Check;
+
+namespace {
+
+//------------------------------------------------------------------------------
+// Checks that dimension or leading dimension x is non-negative and fits
+// in lapack_int, since it is passed to LAPACK with Check::None.
+// @throws Error if not.
+inline void check_dim( int64_t x, char const* func )
+{
+    internal::throw_if( x < 0, "dimension < 0", func );
+    internal::throw_if( x > std::numeric_limits<lapack_int>::max(),
+                        "dimension exceeds lapack_int", func );
+}
+
+//------------------------------------------------------------------------------
+// @return MatrixType for lacpy to copy the uplo triangle.
+inline lapack::MatrixType uplo2matrixtype( lapack::Uplo uplo )
+{
+    return lapack::MatrixType( uplo2char( uplo ) );
+}
+
+//------------------------------------------------------------------------------
+// Checks that factor() was called and succeeded.
+// @throws Error if not.
+inline void check_factored( bool factored, int64_t info, char const* func )
+{
+    internal::throw_if( ! factored, "factor() not called", func );
+    internal::throw_if( info != 0, "info != 0", func,
+                        "factorization failed, info = %lld", (long long) info );
+}
+
+//------------------------------------------------------------------------------
+// @return sign of x: x / |x| for complex, +-1 for real.
+template <typename real_t>
+inline real_t unit( real_t x, real_t /* absx */ )
+{
+    return x < 0 ? -1 : 1;
+}
+
+template <typename real_t>
+inline std::complex<real_t> unit( std::complex<real_t> x, real_t absx )
+{
+    return x / absx;
+}
+
+//------------------------------------------------------------------------------
+// @return upper bound on the number of threads in a parallel region with
+// if (parallel), so per-thread workspace can be allocated before entering
+// it; an exception such as bad_alloc can't propagate out of the region.
+inline int64_t region_threads( bool parallel )
+{
+    #ifdef _OPENMP
+        return parallel ? omp_get_max_threads() : 1;
+    #else
+        return 1;
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// @return index of the calling thread in the current parallel region.
+inline int64_t thread_index()
+{
+    #ifdef _OPENMP
+        return omp_get_thread_num();
+    #else
+        return 0;
+    #endif
+}
+
+}  // namespace
+
+//==============================================================================
+// LU
+
+//------------------------------------------------------------------------------
+/// Constructs empty LU factorization; call resize before factor.
+template <typename scalar_t>
+LU<scalar_t>::LU():
+    m_( 0 ),
+    n_( 0 ),
+    lda_( 1 ),
+    info_( 0 ),
+    factored_( false ),
+    anorm_one_( 0 ),
+    anorm_inf_( 0 )
+{}
+
+//------------------------------------------------------------------------------
+/// Constructs LU factorization for m-by-n matrices, allocating its factor,
+/// pivots, and workspace.
+template <typename scalar_t>
+LU<scalar_t>::LU( int64_t m, int64_t n ):
+    LU()
+{
+    resize( m, n );
+}
+
+//------------------------------------------------------------------------------
+/// Sets shape to m-by-n. Storage is reallocated only if it grows.
+/// Discards any factorization.
+template <typename scalar_t>
+void LU<scalar_t>::resize( int64_t m, int64_t n )
+{
+    check_dim( m, __func__ );
+    check_dim( n, __func__ );
+    m_ = m;
+    n_ = n;
+    lda_ = max( 1, m );
+    A_.resize( lda_ * n );
+    ipiv_.resize( min( m, n ) );
+    // gecon: 4n real or 2n complex work; 2n rwork. lange: m rwork.
+    work_.resize( max( 1, 4*n ) );
+    rwork_.resize( max( max( 1, m ), 2*n ) );
+    iwork_.resize( max( 1, n ) );
+    info_ = 0;
+    factored_ = false;
+}
+
+//------------------------------------------------------------------------------
+/// Copies the m-by-n matrix A into the object and factors it.
+/// @return info from getrf: 0 on success, i > 0 if $U(i,i)$ is exactly zero.
+template <typename scalar_t>
+int64_t LU<scalar_t>::factor( scalar_t const* A, int64_t lda )
+{
+    lapack_error_if( lda < max( 1, m_ ) );
+    check_dim( lda, __func__ );
+    nothrow::lacpy( MatrixType::General, m_, n_, A, lda, A_.data(), lda_,
+                    Check::None );
+    return factor();
+}
+
+//------------------------------------------------------------------------------
+/// Factors the matrix in data() in place.
+/// @return info from getrf.
+template <typename scalar_t>
+int64_t LU<scalar_t>::factor()
+{
+    // norms of A for rcond; O(mn), small next to the O(mn^2) factorization.
+    anorm_one_ = nothrow::lange( Norm::One, m_, n_, A_.data(), lda_,
+                                 rwork_.data(), Check::None );
+    anorm_inf_ = nothrow::lange( Norm::Inf, m_, n_, A_.data(), lda_,
+                                 rwork_.data(), Check::None );
+    info_ = nothrow::getrf( m_, n_, A_.data(), lda_, ipiv_.data(),
+                            Check::None );
+    factored_ = true;
+    return info_;
+}
+
+//------------------------------------------------------------------------------
+/// Solves $op(A) X = B$, overwriting the n-by-nrhs matrix B with X.
+template <typename scalar_t>
+void LU<scalar_t>::solve(
+    lapack::Op trans, int64_t nrhs, scalar_t* B, int64_t ldb ) const
+{
+    check_factored( factored_, info_, __func__ );
+    lapack_error_if( m_ != n_ );
+    check_dim( nrhs, __func__ );
+    lapack_error_if( ldb < max( 1, n_ ) );
+    check_dim( ldb, __func__ );
+    nothrow::getrs( trans, n_, nrhs, A_.data(), lda_, ipiv_.data(), B, ldb,
+                    Check::None );
+}
+
+//------------------------------------------------------------------------------
+/// @return $\log |\det(A)|$, or -infinity if A is singular.
+///
+/// @param[out] sign
+///     If not null, the sign of $\det(A)$: $\det(A) / |\det(A)|$,
+///     which is $\pm 1$ for real matrices, or 0 if A is singular.
+template <typename scalar_t>
+blas::real_type<scalar_t> LU<scalar_t>::logdet( scalar_t* sign ) const
+{
+    internal::throw_if( ! factored_, "factor() not called", __func__ );
+    lapack_error_if( m_ != n_ );
+
+    real_t logdet = 0;
+    scalar_t s = 1;
+    for (int64_t i = 0; i < n_; ++i) {
+        scalar_t u = A_[ i + i*lda_ ];
+        real_t absu = std::abs( u );
+        if (absu == 0) {
+            if (sign != nullptr)
+                *sign = 0;
+            return -std::numeric_limits<real_t>::infinity();
+        }
+        logdet += std::log( absu );
+        s *= unit( u, absu );
+        if (ipiv_[ i ] != i + 1)
+            s = -s;
+    }
+    if (sign != nullptr)
+        *sign = s;
+    return logdet;
+}
+
+//------------------------------------------------------------------------------
+/// @return estimate of the reciprocal condition number of A in the
+/// given norm, One or Inf, as from gecon; 0 if A is singular.
+template <typename scalar_t>
+blas::real_type<scalar_t> LU<scalar_t>::rcond( lapack::Norm norm )
+{
+    internal::throw_if( ! factored_, "factor() not called", __func__ );
+    lapack_error_if( m_ != n_ );
+    lapack_error_if( norm != Norm::One && norm != Norm::Inf );
+    if (info_ > 0)
+        return 0;
+
+    real_t anorm = (norm == Norm::One ? anorm_one_ : anorm_inf_);
+    real_t rcond_ = 0;
+    nothrow::gecon( norm, n_, A_.data(), lda_, anorm, &rcond_, work_.data(),
+                    rwork_.data(), iwork_.data(), Check::None );
+    return rcond_;
+}
+
+//==============================================================================
+// Cholesky
+
+//------------------------------------------------------------------------------
+/// Constructs empty Cholesky factorization; call resize before factor.
+template <typename scalar_t>
+Cholesky<scalar_t>::Cholesky( lapack::Uplo uplo ):
+    uplo_( uplo ),
+    n_( 0 ),
+    lda_( 1 ),
+    info_( 0 ),
+    factored_( false ),
+    anorm_( 0 )
+{
+    lapack_error_if( uplo != Uplo::Lower && uplo != Uplo::Upper );
+}
+
+//------------------------------------------------------------------------------
+/// Constructs Cholesky factorization for n-by-n matrices, allocating its
+/// factor and workspace.
+template <typename scalar_t>
+Cholesky<scalar_t>::Cholesky( lapack::Uplo uplo, int64_t n ):
+    Cholesky( uplo )
+{
+    resize( n );
+}
+
+//------------------------------------------------------------------------------
+/// Sets shape to n-by-n. Storage is reallocated only if it grows.
+/// Discards any factorization.
+template <typename scalar_t>
+void Cholesky<scalar_t>::resize( int64_t n )
+{
+    check_dim( n, __func__ );
+    n_ = n;
+    lda_ = max( 1, n );
+    A_.resize( lda_ * n );
+    // pocon: 3n real or 2n complex work; n rwork. lanhe: n rwork.
+    work_.resize( max( 1, 3*n ) );
+    rwork_.resize( max( 1, n ) );
+    iwork_.resize( max( 1, n ) );
+    info_ = 0;
+    factored_ = false;
+}
+
+//------------------------------------------------------------------------------
+/// Copies the n-by-n Hermitian matrix A into the object and factors it.
+/// @return info from potrf: 0 on success, i > 0 if the leading minor of
+/// order i is not positive definite.
+template <typename scalar_t>
+int64_t Cholesky<scalar_t>::factor( scalar_t const* A, int64_t lda )
+{
+    lapack_error_if( lda < max( 1, n_ ) );
+    check_dim( lda, __func__ );
+    nothrow::lacpy( uplo2matrixtype( uplo_ ), n_, n_, A, lda, A_.data(), lda_,
+                    Check::None );
+    return factor();
+}
+
+//------------------------------------------------------------------------------
+/// Factors the matrix in data() in place.
+/// @return info from potrf.
+template <typename scalar_t>
+int64_t Cholesky<scalar_t>::factor()
+{
+    anorm_ = nothrow::lanhe( Norm::One, uplo_, n_, A_.data(), lda_,
+                             rwork_.data(), Check::None );
+    info_ = nothrow::potrf( uplo_, n_, A_.data(), lda_, Check::None );
+    factored_ = true;
+    return info_;
+}
+
+//------------------------------------------------------------------------------
+/// Solves $A X = B$, overwriting the n-by-nrhs matrix B with X.
+template <typename scalar_t>
+void Cholesky<scalar_t>::solve( int64_t nrhs, scalar_t* B, int64_t ldb ) const
+{
+    check_factored( factored_, info_, __func__ );
+    check_dim( nrhs, __func__ );
+    lapack_error_if( ldb < max( 1, n_ ) );
+    check_dim( ldb, __func__ );
+    nothrow::potrs( uplo_, n_, nrhs, A_.data(), lda_, B, ldb, Check::None );
+}
+
+//------------------------------------------------------------------------------
+/// @return $\log \det(A) = 2 \sum_i \log L(i,i)$.
+template <typename scalar_t>
+blas::real_type<scalar_t> Cholesky<scalar_t>::logdet() const
+{
+    check_factored( factored_, info_, __func__ );
+    real_t logdet = 0;
+    for (int64_t i = 0; i < n_; ++i)
+        logdet += std::log( real( A_[ i + i*lda_ ] ) );
+    return 2 * logdet;
+}
+
+//------------------------------------------------------------------------------
+/// @return estimate of the reciprocal condition number of A in the 1-norm,
+/// as from pocon.
+template <typename scalar_t>
+blas::real_type<scalar_t> Cholesky<scalar_t>::rcond()
+{
+    check_factored( factored_, info_, __func__ );
+    real_t rcond_ = 0;
+    nothrow::pocon( uplo_, n_, A_.data(), lda_, anorm_, &rcond_, work_.data(),
+                    rwork_.data(), iwork_.data(), Check::None );
+    return rcond_;
+}
+
+//==============================================================================
+// LDLT
+
+//------------------------------------------------------------------------------
+/// Constructs empty LDLT factorization; call resize before factor.
+template <typename scalar_t>
+LDLT<scalar_t>::LDLT( lapack::Uplo uplo ):
+    uplo_( uplo ),
+    n_( 0 ),
+    lda_( 1 ),
+    info_( 0 ),
+    factored_( false ),
+    anorm_( 0 )
+{
+    lapack_error_if( uplo != Uplo::Lower && uplo != Uplo::Upper );
+}
+
+//------------------------------------------------------------------------------
+/// Constructs LDLT factorization for n-by-n matrices, allocating its
+/// factor, pivots, and workspace.
+template <typename scalar_t>
+LDLT<scalar_t>::LDLT( lapack::Uplo uplo, int64_t n ):
+    LDLT( uplo )
+{
+    resize( n );
+}
+
+//------------------------------------------------------------------------------
+/// Sets shape to n-by-n. Storage is reallocated only if it grows.
+/// Discards any factorization.
+template <typename scalar_t>
+void LDLT<scalar_t>::resize( int64_t n )
+{
+    check_dim( n, __func__ );
+    n_ = n;
+    lda_ = max( 1, n );
+    A_.resize( lda_ * n );
+    ipiv_.resize( max( 1, n ) );
+
+    // query hetrf's optimal workspace; hecon needs 2n.
+    scalar_t qry_work[ 1 ];
+    nothrow::hetrf( uplo_, n_, A_.data(), lda_, ipiv_.data(), qry_work, -1,
+                    Check::None );
+    int64_t lwork = max( max( 1, 2*n ), int64_t( real( qry_work[ 0 ] ) ) );
+    work_.resize( lwork );
+    rwork_.resize( max( 1, n ) );
+    iwork_.resize( max( 1, n ) );
+    info_ = 0;
+    factored_ = false;
+}
+
+//------------------------------------------------------------------------------
+/// Copies the n-by-n Hermitian matrix A into the object and factors it.
+/// @return info from hetrf: 0 on success, i > 0 if $D(i,i)$ is exactly zero.
+template <typename scalar_t>
+int64_t LDLT<scalar_t>::factor( scalar_t const* A, int64_t lda )
+{
+    lapack_error_if( lda < max( 1, n_ ) );
+    check_dim( lda, __func__ );
+    nothrow::lacpy( uplo2matrixtype( uplo_ ), n_, n_, A, lda, A_.data(), lda_,
+                    Check::None );
+    return factor();
+}
+
+//------------------------------------------------------------------------------
+/// Factors the matrix in data() in place.
+/// @return info from hetrf.
+template <typename scalar_t>
+int64_t LDLT<scalar_t>::factor()
+{
+    anorm_ = nothrow::lanhe( Norm::One, uplo_, n_, A_.data(), lda_,
+                             rwork_.data(), Check::None );
+    info_ = nothrow::hetrf( uplo_, n_, A_.data(), lda_, ipiv_.data(),
+                            work_.data(), work_.size(), Check::None );
+    factored_ = true;
+    return info_;
+}
+
+//------------------------------------------------------------------------------
+/// Solves $A X = B$, overwriting the n-by-nrhs matrix B with X.
+template <typename scalar_t>
+void LDLT<scalar_t>::solve( int64_t nrhs, scalar_t* B, int64_t ldb ) const
+{
+    check_factored( factored_, info_, __func__ );
+    check_dim( nrhs, __func__ );
+    lapack_error_if( ldb < max( 1, n_ ) );
+    check_dim( ldb, __func__ );
+    nothrow::hetrs( uplo_, n_, nrhs, A_.data(), lda_, ipiv_.data(), B, ldb,
+                    Check::None );
+}
+
+//------------------------------------------------------------------------------
+/// @return $\log |\det(A)| = \log |\det(D)|$, or -infinity if A is singular.
+///
+/// @param[out] sign
+///     If not null, the sign of $\det(A)$, $\pm 1$, or 0 if A is singular.
+template <typename scalar_t>
+blas::real_type<scalar_t> LDLT<scalar_t>::logdet( real_t* sign ) const
+{
+    internal::throw_if( ! factored_, "factor() not called", __func__ );
+
+    real_t logdet = 0;
+    real_t s = 1;
+    int64_t k = 0;
+    while (k < n_) {
+        real_t det;
+        if (ipiv_[ k ] > 0) {
+            // 1-by-1 block; Hermitian, so D(k,k) is real
+            det = real( A_[ k + k*lda_ ] );
+            k += 1;
+        }
+        else {
+            // 2-by-2 block in rows & cols k, k+1; ipiv(k) = ipiv(k+1) < 0
+            real_t d11 = real( A_[ k     + k*lda_     ] );
+            real_t d22 = real( A_[ (k+1) + (k+1)*lda_ ] );
+            scalar_t d21 = (uplo_ == Uplo::Lower
+                            ? A_[ (k+1) + k*lda_ ]
+                            : A_[ k + (k+1)*lda_ ]);
+            real_t absd21 = std::abs( d21 );
+            det = d11*d22 - absd21*absd21;
+            k += 2;
+        }
+        if (det == 0) {
+            if (sign != nullptr)
+                *sign = 0;
+            return -std::numeric_limits<real_t>::infinity();
+        }
+        logdet += std::log( std::abs( det ) );
+        if (det < 0)
+            s = -s;
+    }
+    if (sign != nullptr)
+        *sign = s;
+    return logdet;
+}
+
+//------------------------------------------------------------------------------
+/// @return estimate of the reciprocal condition number of A in the 1-norm,
+/// as from hecon; 0 if A is singular.
+template <typename scalar_t>
+blas::real_type<scalar_t> LDLT<scalar_t>::rcond()
+{
+    internal::throw_if( ! factored_, "factor() not called", __func__ );
+    if (info_ > 0)
+        return 0;
+
+    real_t rcond_ = 0;
+    nothrow::hecon( uplo_, n_, A_.data(), lda_, ipiv_.data(), anorm_, &rcond_,
+                    work_.data(), iwork_.data(), Check::None );
+    return rcond_;
+}
+
+//==============================================================================
+// QR
+
+//------------------------------------------------------------------------------
+/// Constructs empty QR factorization; call resize before factor.
+template <typename scalar_t>
+QR<scalar_t>::QR():
+    m_( 0 ),
+    n_( 0 ),
+    lda_( 1 ),
+    factored_( false )
+{}
+
+//------------------------------------------------------------------------------
+/// Constructs QR factorization for m-by-n matrices, allocating its factor,
+/// tau, and workspace.
+template <typename scalar_t>
+QR<scalar_t>::QR( int64_t m, int64_t n ):
+    QR()
+{
+    resize( m, n );
+}
+
+//------------------------------------------------------------------------------
+/// Sets shape to m-by-n. Storage is reallocated only if it grows.
+/// Discards any factorization.
+template <typename scalar_t>
+void QR<scalar_t>::resize( int64_t m, int64_t n )
+{
+    check_dim( m, __func__ );
+    check_dim( n, __func__ );
+    m_ = m;
+    n_ = n;
+    lda_ = max( 1, m );
+    A_.resize( lda_ * n );
+    tau_.resize( max( 1, min( m, n ) ) );
+
+    // query geqrf's optimal workspace; trcon needs 3n.
+    scalar_t qry_work[ 1 ];
+    nothrow::geqrf( m_, n_, A_.data(), lda_, tau_.data(), qry_work, -1,
+                    Check::None );
+    int64_t lwork = max( max( 1, 3*n ), int64_t( real( qry_work[ 0 ] ) ) );
+    work_.resize( lwork );
+    rwork_.resize( max( 1, n ) );
+    iwork_.resize( max( 1, n ) );
+    factored_ = false;
+}
+
+//------------------------------------------------------------------------------
+/// Copies the m-by-n matrix A into the object and factors it.
+/// @return info from geqrf, always 0.
+template <typename scalar_t>
+int64_t QR<scalar_t>::factor( scalar_t const* A, int64_t lda )
+{
+    lapack_error_if( lda < max( 1, m_ ) );
+    check_dim( lda, __func__ );
+    nothrow::lacpy( MatrixType::General, m_, n_, A, lda, A_.data(), lda_,
+                    Check::None );
+    return factor();
+}
+
+//------------------------------------------------------------------------------
+/// Factors the matrix in data() in place.
+/// @return info from geqrf, always 0.
+template <typename scalar_t>
+int64_t QR<scalar_t>::factor()
+{
+    int64_t info = nothrow::geqrf( m_, n_, A_.data(), lda_, tau_.data(),
+                                   work_.data(), work_.size(), Check::None );
+    factored_ = true;
+    return info;
+}
+
+//------------------------------------------------------------------------------
+/// Multiplies the mc-by-nc matrix C by Q from the left or right, as in unmqr:
+/// $C = op(Q) C$ for side = Left, where mc = m; or $C = C op(Q)$ for
+/// side = Right, where nc = m.
+/// Workspace grows on the first call with a larger C, and is then reused.
+template <typename scalar_t>
+void QR<scalar_t>::apply_Q(
+    lapack::Side side, lapack::Op trans,
+    int64_t mc, int64_t nc, scalar_t* C, int64_t ldc )
+{
+    internal::throw_if( ! factored_, "factor() not called", __func__ );
+    lapack_error_if( side != Side::Left && side != Side::Right );
+    check_dim( mc, __func__ );
+    check_dim( nc, __func__ );
+    lapack_error_if( (side == Side::Left ? mc : nc) != m_ );
+    lapack_error_if( ldc < max( 1, mc ) );
+    check_dim( ldc, __func__ );
+
+    int64_t k = min( m_, n_ );
+    scalar_t qry_work[ 1 ];
+    nothrow::unmqr( side, trans, mc, nc, k, A_.data(), lda_, tau_.data(), C,
+                    ldc, qry_work, -1, Check::None );
+    int64_t lwork = max( 1, int64_t( real( qry_work[ 0 ] ) ) );
+    if (int64_t( work_.size() ) < lwork)
+        work_.resize( lwork );
+
+    nothrow::unmqr( side, trans, mc, nc, k, A_.data(), lda_, tau_.data(), C,
+                    ldc, work_.data(), work_.size(), Check::None );
+}
+
+//------------------------------------------------------------------------------
+/// Solves the least squares problem $\min_X || A X - B ||_2$, for m >= n.
+/// On input, B is m-by-nrhs. On output, its first n rows are X, and the
+/// norm of rows n+1 to m of each column is that column's residual.
+/// @throws Error if R is exactly singular.
+template <typename scalar_t>
+void QR<scalar_t>::solve( int64_t nrhs, scalar_t* B, int64_t ldb )
+{
+    internal::throw_if( ! factored_, "factor() not called", __func__ );
+    lapack_error_if( m_ < n_ );
+    check_dim( nrhs, __func__ );
+    lapack_error_if( ldb < max( 1, m_ ) );
+    check_dim( ldb, __func__ );
+
+    apply_Q( Side::Left, Op::ConjTrans, m_, nrhs, B, ldb );
+    int64_t info = nothrow::trtrs( Uplo::Upper, Op::NoTrans, Diag::NonUnit, n_,
+                                   nrhs, A_.data(), lda_, B, ldb, Check::None );
+    internal::throw_if( info != 0, "info != 0", __func__,
+                        "R is singular, R(%lld, %lld) = 0",
+                        (long long) info, (long long) info );
+}
+
+//------------------------------------------------------------------------------
+/// @return estimate of the reciprocal condition number of R, and hence A,
+/// in the given norm, One or Inf, as from trcon, for m >= n.
+template <typename scalar_t>
+blas::real_type<scalar_t> QR<scalar_t>::rcond( lapack::Norm norm )
+{
+    internal::throw_if( ! factored_, "factor() not called", __func__ );
+    lapack_error_if( m_ < n_ );
+    lapack_error_if( norm != Norm::One && norm != Norm::Inf );
+
+    real_t rcond_ = 0;
+    nothrow::trcon( norm, Uplo::Upper, Diag::NonUnit, n_, A_.data(), lda_,
+                    &rcond_, work_.data(), rwork_.data(), iwork_.data(),
+                    Check::None );
+    return rcond_;
+}
+
+//==============================================================================
+// StreamingLS
+#if LAPACK_VERSION >= 30400  // >= 3.4: tpqrt, tpmqrt
+
+//------------------------------------------------------------------------------
+/// Constructs empty least squares problem; call resize before add.
+template <typename scalar_t>
+StreamingLS<scalar_t>::StreamingLS():
+    n_( 0 ),
+    nrhs_( 0 ),
+    nb_( 1 ),
+    chunk_( 1 ),
+    ldr_( 1 ),
+    rows_( 0 )
+{}
+
+//------------------------------------------------------------------------------
+/// Constructs least squares problem with n unknowns and nrhs right-hand
+/// sides, allocating R, $Q^H B$, and a buffer for row blocks.
+template <typename scalar_t>
+StreamingLS<scalar_t>::StreamingLS( int64_t n, int64_t nrhs ):
+    StreamingLS()
+{
+    resize( n, nrhs );
+}
+
+//------------------------------------------------------------------------------
+/// Sets the number of unknowns n and right-hand sides nrhs, and resets.
+/// Incoming row blocks are processed in chunks of max( n, 128 ) rows,
+/// so the buffer is O(n^2 + n nrhs) no matter how many rows add is given.
+template <typename scalar_t>
+void StreamingLS<scalar_t>::resize( int64_t n, int64_t nrhs )
+{
+    check_dim( n, __func__ );
+    check_dim( nrhs, __func__ );
+    n_ = n;
+    nrhs_ = nrhs;
+    nb_ = max( 1, min( n, 32 ) );
+    chunk_ = max( n, 128 );
+    ldr_ = max( 1, n );
+    R_.resize( ldr_ * n );
+    C_.resize( ldr_ * nrhs );
+    T_.resize( nb_ * n );
+    Ablk_.resize( chunk_ * n );
+    Bblk_.resize( chunk_ * nrhs );
+    sqrtw_.resize( chunk_ );
+    rnorm2_.resize( nrhs );
+    reset();
+}
+
+//------------------------------------------------------------------------------
+/// Discards all rows added, keeping n, nrhs, and storage.
+template <typename scalar_t>
+void StreamingLS<scalar_t>::reset()
+{
+    std::fill( R_.begin(), R_.end(), scalar_t( 0 ) );
+    std::fill( C_.begin(), C_.end(), scalar_t( 0 ) );
+    std::fill( rnorm2_.begin(), rnorm2_.end(), real_t( 0 ) );
+    rows_ = 0;
+}
+
+//------------------------------------------------------------------------------
+/// Adds rows to the problem: the mb-by-n block A and mb-by-nrhs block B.
+/// Neither is modified. If weights is given, it has length mb, with
+/// weights[ i ] >= 0 weighting the squared residual of row i, i.e., row i of
+/// A and B is scaled by sqrt( weights[ i ] ).
+/// Costs O(mb n (n + nrhs)).
+template <typename scalar_t>
+void StreamingLS<scalar_t>::add(
+    int64_t mb,
+    scalar_t const* A, int64_t lda,
+    scalar_t const* B, int64_t ldb,
+    real_t const* weights )
+{
+    check_dim( mb, __func__ );
+    lapack_error_if( lda < max( 1, mb ) );
+    check_dim( lda, __func__ );
+    lapack_error_if( ldb < max( 1, mb ) );
+    check_dim( ldb, __func__ );
+
+    for (int64_t i0 = 0; i0 < mb; i0 += chunk_) {
+        int64_t ib = min( chunk_, mb - i0 );
+        for (int64_t i = 0; i < ib; ++i) {
+            real_t w = (weights ? weights[ i0 + i ] : real_t( 1 ));
+            internal::throw_if( ! (w >= 0), "weights[ i ] < 0", __func__ );
+            sqrtw_[ i ] = std::sqrt( w );
+        }
+        for (int64_t j = 0; j < n_; ++j)
+            for (int64_t i = 0; i < ib; ++i)
+                Ablk_[ i + j*chunk_ ] = sqrtw_[ i ] * A[ i0 + i + j*lda ];
+        for (int64_t j = 0; j < nrhs_; ++j)
+            for (int64_t i = 0; i < ib; ++i)
+                Bblk_[ i + j*chunk_ ] = sqrtw_[ i ] * B[ i0 + i + j*ldb ];
+
+        if (n_ > 0) {
+            // [ R; Ablk ] = Q [ R_new; 0 ]
+            tpqrt( ib, n_, 0, nb_, R_.data(), ldr_, Ablk_.data(), chunk_,
+                   T_.data(), nb_ );
+            // [ C; Bblk ] = Q^H [ C; Bblk ]
+            if (nrhs_ > 0) {
+                tpmqrt( Side::Left, Op::ConjTrans, ib, nrhs_, n_, 0, nb_,
+                        Ablk_.data(), chunk_, T_.data(), nb_,
+                        C_.data(), ldr_, Bblk_.data(), chunk_ );
+            }
+        }
+        // What remains of Bblk is orthogonal to range( A ), so it is
+        // part of the least squares residual and is never touched again.
+        for (int64_t j = 0; j < nrhs_; ++j) {
+            real_t r = blas::nrm2( ib, &Bblk_[ j*chunk_ ], 1 );
+            rnorm2_[ j ] += r*r;
+        }
+    }
+    rows_ += mb;
+}
+
+//------------------------------------------------------------------------------
+/// Solves the least squares problem for the rows added so far, putting the
+/// n-by-nrhs solution in X. The object is unchanged, so more rows can be
+/// added and solve called again.
+/// @throws Error if fewer than n rows were added, or R is singular.
+template <typename scalar_t>
+void StreamingLS<scalar_t>::solve( scalar_t* X, int64_t ldx ) const
+{
+    lapack_error_if( ldx < max( 1, n_ ) );
+    check_dim( ldx, __func__ );
+    internal::throw_if( rows_ < n_, "rows() < n()", __func__ );
+
+    nothrow::lacpy( MatrixType::General, n_, nrhs_, C_.data(), ldr_, X, ldx,
+                    Check::None );
+    int64_t info = nothrow::trtrs( Uplo::Upper, Op::NoTrans, Diag::NonUnit, n_,
+                                   nrhs_, R_.data(), ldr_, X, ldx,
+                                   Check::None );
+    internal::throw_if( info != 0, "info != 0", __func__,
+                        "R is singular, R(%lld, %lld) = 0",
+                        (long long) info, (long long) info );
+}
+
+//------------------------------------------------------------------------------
+/// Gets the least squares residual norm $|| W^{1/2} (b_j - A x_j) ||_2$
+/// for each right-hand side j, for the rows added so far.
+/// @param[out] rnorm: array of length nrhs.
+template <typename scalar_t>
+void StreamingLS<scalar_t>::residual_norm( real_t* rnorm ) const
+{
+    for (int64_t j = 0; j < nrhs_; ++j)
+        rnorm[ j ] = std::sqrt( rnorm2_[ j ] );
+}
+
+#endif  // LAPACK >= 3.4
+
+//==============================================================================
+// ShiftedHessenberg
+
+namespace {
+
+//------------------------------------------------------------------------------
+// Solves $(H - \sigma I) Y = Y$ for n-by-n upper Hessenberg H, overwriting
+// the n-by-nrhs Y. Factors $H - \sigma I = P L U$ by LU with partial
+// pivoting, which only swaps adjacent rows, left-looking so each step reads
+// one column of U contiguously; then applies P and L to Y and solves with U.
+// U is n-by-n workspace; ell and swap are length n workspace, holding the
+// multipliers and row swaps.
+// @return 0, or k > 0 if U(k,k) is exactly zero.
+template <typename scalar_t>
+int64_t hessenberg_shift_solve(
+    int64_t n, scalar_t sigma,
+    scalar_t const* H, int64_t ldh,
+    int64_t nrhs, scalar_t* Y, int64_t ldy,
+    scalar_t* U, int64_t ldu, scalar_t* ell, char* swap )
+{
+    for (int64_t j = 0; j < n; ++j) {
+        // U( 0:j+1, j ) = H( 0:j+1, j ) - sigma e_j
+        scalar_t* Uj = &U[ j*ldu ];
+        int64_t iend = min( j + 2, n );
+        std::copy( &H[ j*ldh ], &H[ iend + j*ldh ], Uj );
+        Uj[ j ] -= sigma;
+
+        // apply previous row swaps and eliminations to column j
+        for (int64_t k = 0; k < j; ++k) {
+            if (swap[ k ])
+                std::swap( Uj[ k ], Uj[ k+1 ] );
+            Uj[ k+1 ] -= ell[ k ] * Uj[ k ];
+        }
+
+        // eliminate U( j+1, j )
+        if (j < n - 1) {
+            swap[ j ] = (std::abs( Uj[ j+1 ] ) > std::abs( Uj[ j ] ));
+            if (swap[ j ])
+                std::swap( Uj[ j ], Uj[ j+1 ] );
+            if (Uj[ j ] == scalar_t( 0 ))
+                return j + 1;
+            ell[ j ] = Uj[ j+1 ] / Uj[ j ];
+        }
+        else if (Uj[ j ] == scalar_t( 0 )) {
+            return j + 1;
+        }
+    }
+
+    // Y = L^{-1} P^T Y
+    for (int64_t c = 0; c < nrhs; ++c) {
+        scalar_t* Yc = &Y[ c*ldy ];
+        for (int64_t k = 0; k < n - 1; ++k) {
+            if (swap[ k ])
+                std::swap( Yc[ k ], Yc[ k+1 ] );
+            Yc[ k+1 ] -= ell[ k ] * Yc[ k ];
+        }
+    }
+    // Y = U^{-1} Y
+    blas::trsm( Layout::ColMajor, Side::Left, Uplo::Upper, Op::NoTrans,
+                Diag::NonUnit, n, nrhs, scalar_t( 1 ), U, ldu, Y, ldy );
+    return 0;
+}
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+/// Constructs empty shifted solver; call resize before factor.
+template <typename scalar_t>
+ShiftedHessenberg<scalar_t>::ShiftedHessenberg():
+    n_( 0 ),
+    lda_( 1 ),
+    factored_( false )
+{}
+
+//------------------------------------------------------------------------------
+/// Constructs shifted solver for n-by-n matrices, allocating H, Q,
+/// and workspace.
+template <typename scalar_t>
+ShiftedHessenberg<scalar_t>::ShiftedHessenberg( int64_t n ):
+    ShiftedHessenberg()
+{
+    resize( n );
+}
+
+//------------------------------------------------------------------------------
+/// Sets shape to n-by-n. Storage is reallocated only if it grows.
+/// Discards any factorization.
+template <typename scalar_t>
+void ShiftedHessenberg<scalar_t>::resize( int64_t n )
+{
+    check_dim( n, __func__ );
+    n_ = n;
+    lda_ = max( 1, n );
+    H_.resize( lda_ * n );
+    Q_.resize( lda_ * n );
+    U_.resize( lda_ * n );
+    tau_.resize( max( 1, n - 1 ) );
+    ell_.resize( max( 1, n ) );
+    swap_.resize( max( 1, n ) );
+
+    // query gehrd's and unghr's optimal workspace
+    int64_t ihi = max( 1, n );
+    scalar_t qry_work[ 1 ];
+    nothrow::gehrd( n_, 1, ihi, H_.data(), lda_, tau_.data(), qry_work, -1,
+                    Check::None );
+    int64_t lwork = max( 1, int64_t( real( qry_work[ 0 ] ) ) );
+    nothrow::unghr( n_, 1, ihi, Q_.data(), lda_, tau_.data(), qry_work, -1,
+                    Check::None );
+    lwork = max( lwork, int64_t( real( qry_work[ 0 ] ) ) );
+    work_.resize( lwork );
+    factored_ = false;
+}
+
+//------------------------------------------------------------------------------
+/// Copies the n-by-n matrix A into the object and reduces it to Hessenberg
+/// form.
+/// @return info from gehrd, always 0.
+template <typename scalar_t>
+int64_t ShiftedHessenberg<scalar_t>::factor( scalar_t const* A, int64_t lda )
+{
+    lapack_error_if( lda < max( 1, n_ ) );
+    check_dim( lda, __func__ );
+    nothrow::lacpy( MatrixType::General, n_, n_, A, lda, H_.data(), lda_,
+                    Check::None );
+    return factor();
+}
+
+//------------------------------------------------------------------------------
+/// Reduces the matrix in data() in place to Hessenberg form, $A = Q H Q^H$,
+/// and forms Q.
+/// @return info from gehrd, always 0.
+template <typename scalar_t>
+int64_t ShiftedHessenberg<scalar_t>::factor()
+{
+    int64_t ihi = max( 1, n_ );
+    int64_t info = nothrow::gehrd( n_, 1, ihi, H_.data(), lda_, tau_.data(),
+                                   work_.data(), work_.size(), Check::None );
+    nothrow::lacpy( MatrixType::General, n_, n_, H_.data(), lda_, Q_.data(),
+                    lda_, Check::None );
+    nothrow::unghr( n_, 1, ihi, Q_.data(), lda_, tau_.data(), work_.data(),
+                    work_.size(), Check::None );
+    factored_ = true;
+    return info;
+}
+
+//------------------------------------------------------------------------------
+/// Solves $(A - \sigma I) X = B$ for one shift, overwriting the n-by-nrhs
+/// matrix B with X. Costs O(n^2 (1 + nrhs)).
+/// Workspace grows on the first call with a larger nrhs, and is then reused.
+/// @throws Error if $H - \sigma I$ is exactly singular.
+template <typename scalar_t>
+void ShiftedHessenberg<scalar_t>::solve(
+    scalar_t sigma, int64_t nrhs, scalar_t* B, int64_t ldb )
+{
+    internal::throw_if( ! factored_, "factor() not called", __func__ );
+    check_dim( nrhs, __func__ );
+    lapack_error_if( ldb < max( 1, n_ ) );
+    check_dim( ldb, __func__ );
+    if (n_ == 0 || nrhs == 0)
+        return;
+
+    if (int64_t( C_.size() ) < n_ * nrhs)
+        C_.resize( n_ * nrhs );
+
+    // C = Q^H B; solve ( H - sigma I ) C = C; B = Q C
+    const scalar_t one = 1, zero = 0;
+    blas::gemm( Layout::ColMajor, Op::ConjTrans, Op::NoTrans, n_, nrhs, n_,
+                one, Q_.data(), lda_, B, ldb, zero, C_.data(), n_ );
+    int64_t info = hessenberg_shift_solve(
+        n_, sigma, H_.data(), lda_, nrhs, C_.data(), n_,
+        U_.data(), lda_, ell_.data(), swap_.data() );
+    internal::throw_if( info != 0, "info != 0", __func__,
+                        "H - sigma I is singular, U(%lld, %lld) = 0",
+                        (long long) info, (long long) info );
+    blas::gemm( Layout::ColMajor, Op::NoTrans, Op::NoTrans, n_, nrhs, n_,
+                one, Q_.data(), lda_, C_.data(), n_, zero, B, ldb );
+}
+
+//------------------------------------------------------------------------------
+/// Solves $(A - \sigma_s I) X_s = B$ for each of nshift shifts, with the
+/// same n-by-nrhs B. X is n-by-(nshift nrhs), with $X_s$ in columns
+/// s nrhs to (s + 1) nrhs - 1, for 0 <= s < nshift. $Q^H B$ is computed
+/// once. With OpenMP, shifts are solved in parallel, each with one
+/// BLAS thread and its own O(n^2) workspace.
+/// @throws Error if $H - \sigma_s I$ is exactly singular for any shift;
+/// the other shifts' solutions are still computed.
+template <typename scalar_t>
+void ShiftedHessenberg<scalar_t>::solve(
+    int64_t nshift, scalar_t const* sigma,
+    int64_t nrhs, scalar_t const* B, int64_t ldb,
+    scalar_t* X, int64_t ldx )
+{
+    internal::throw_if( ! factored_, "factor() not called", __func__ );
+    check_dim( nshift, __func__ );
+    check_dim( nrhs, __func__ );
+    lapack_error_if( ldb < max( 1, n_ ) );
+    check_dim( ldb, __func__ );
+    lapack_error_if( ldx < max( 1, n_ ) );
+    check_dim( ldx, __func__ );
+    if (n_ == 0 || nrhs == 0 || nshift == 0)
+        return;
+
+    if (int64_t( C_.size() ) < n_ * nrhs)
+        C_.resize( n_ * nrhs );
+
+    // C = Q^H B, shared by all shifts
+    const scalar_t one = 1, zero = 0;
+    blas::gemm( Layout::ColMajor, Op::ConjTrans, Op::NoTrans, n_, nrhs, n_,
+                one, Q_.data(), lda_, B, ldb, zero, C_.data(), n_ );
+
+    // per-thread workspace, allocated outside the parallel region
+    int64_t nthreads = region_threads( nshift > 1 );
+    int64_t ldu = lda_ * n_, ldy = n_ * nrhs;
+    lapack::vector< scalar_t > U( nthreads * ldu ), Y( nthreads * ldy ),
+                               ell( nthreads * n_ );
+    lapack::vector< char > swap( nthreads * n_ );
+
+    int64_t first_singular = nshift;
+    #ifdef _OPENMP
+    #pragma omp parallel if (nshift > 1)
+    #endif
+    {
+        #ifdef _OPENMP
+            // avoid oversubscription by a threaded BLAS
+            ThreadScope scope( omp_get_num_threads() > 1 ? 1
+                                                         : get_num_threads() );
+        #endif
+        int64_t t = thread_index();
+        scalar_t* Ut = &U[ t*ldu ];
+        scalar_t* Yt = &Y[ t*ldy ];
+        scalar_t* ellt = &ell[ t*n_ ];
+        char* swapt = &swap[ t*n_ ];
+
+        #ifdef _OPENMP
+        #pragma omp for schedule( dynamic ) reduction( min:first_singular )
+        #endif
+        for (int64_t s = 0; s < nshift; ++s) {
+            // Y = C; solve ( H - sigma_s I ) Y = Y; X_s = Q Y
+            std::copy( C_.begin(), C_.begin() + ldy, Yt );
+            int64_t info = hessenberg_shift_solve(
+                n_, sigma[ s ], H_.data(), lda_, nrhs, Yt, n_,
+                Ut, lda_, ellt, swapt );
+            if (info != 0) {
+                first_singular = min( first_singular, s );
+                continue;
+            }
+            blas::gemm( Layout::ColMajor, Op::NoTrans, Op::NoTrans,
+                        n_, nrhs, n_,
+                        one, Q_.data(), lda_, Yt, n_,
+                        zero, &X[ s*nrhs*ldx ], ldx );
+        }
+    }
+    internal::throw_if( first_singular < nshift, "info != 0", __func__,
+                        "H - sigma[ %lld ] I is singular",
+                        (long long) first_singular );
+}
+
+//==============================================================================
+// ShiftedHermitian
+
+namespace {
+
+//------------------------------------------------------------------------------
+// Solves $(T - \sigma I) Y = Y$ for n-by-n real symmetric tridiagonal T with
+// diagonal D and off-diagonal E, overwriting the n-by-nrhs Y, with gtsv.
+// tridiag is 3n workspace for gtsv's sub-, main, and super-diagonals.
+// @return info from gtsv: 0, or k > 0 if U(k,k) is exactly zero.
+template <typename scalar_t>
+int64_t tridiag_shift_solve(
+    int64_t n, scalar_t sigma,
+    blas::real_type< scalar_t > const* D,
+    blas::real_type< scalar_t > const* E,
+    int64_t nrhs, scalar_t* Y, int64_t ldy, scalar_t* tridiag )
+{
+    scalar_t* dl = tridiag;
+    scalar_t* d  = tridiag + n;
+    scalar_t* du = tridiag + 2*n;
+    for (int64_t i = 0; i < n; ++i)
+        d[ i ] = D[ i ] - sigma;
+    for (int64_t i = 0; i < n - 1; ++i) {
+        dl[ i ] = E[ i ];
+        du[ i ] = E[ i ];
+    }
+    return nothrow::gtsv( n, nrhs, dl, d, du, Y, ldy, Check::None );
+}
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+/// Constructs empty shifted solver; call resize before factor.
+template <typename scalar_t>
+ShiftedHermitian<scalar_t>::ShiftedHermitian( lapack::Uplo uplo ):
+    uplo_( uplo ),
+    n_( 0 ),
+    lda_( 1 ),
+    factored_( false )
+{
+    lapack_error_if( uplo != Uplo::Lower && uplo != Uplo::Upper );
+}
+
+//------------------------------------------------------------------------------
+/// Constructs shifted solver for n-by-n matrices, allocating the
+/// reduction, Q, and workspace.
+template <typename scalar_t>
+ShiftedHermitian<scalar_t>::ShiftedHermitian( lapack::Uplo uplo, int64_t n ):
+    ShiftedHermitian( uplo )
+{
+    resize( n );
+}
+
+//------------------------------------------------------------------------------
+/// Sets shape to n-by-n. Storage is reallocated only if it grows.
+/// Discards any factorization.
+template <typename scalar_t>
+void ShiftedHermitian<scalar_t>::resize( int64_t n )
+{
+    check_dim( n, __func__ );
+    n_ = n;
+    lda_ = max( 1, n );
+    A_.resize( lda_ * n );
+    Q_.resize( lda_ * n );
+    D_.resize( max( 1, n ) );
+    E_.resize( max( 1, n - 1 ) );
+    tau_.resize( max( 1, n - 1 ) );
+    tridiag_.resize( max( 1, 3*n ) );
+
+    // query hetrd's and ungtr's optimal workspace
+    scalar_t qry_work[ 1 ];
+    nothrow::hetrd( uplo_, n_, A_.data(), lda_, D_.data(), E_.data(),
+                    tau_.data(), qry_work, -1, Check::None );
+    int64_t lwork = max( 1, int64_t( real( qry_work[ 0 ] ) ) );
+    nothrow::ungtr( uplo_, n_, Q_.data(), lda_, tau_.data(), qry_work, -1,
+                    Check::None );
+    lwork = max( lwork, int64_t( real( qry_work[ 0 ] ) ) );
+    work_.resize( lwork );
+    factored_ = false;
+}
+
+//------------------------------------------------------------------------------
+/// Copies the uplo triangle of the n-by-n matrix A into the object and
+/// reduces it to tridiagonal form.
+/// @return info from hetrd, always 0.
+template <typename scalar_t>
+int64_t ShiftedHermitian<scalar_t>::factor( scalar_t const* A, int64_t lda )
+{
+    lapack_error_if( lda < max( 1, n_ ) );
+    check_dim( lda, __func__ );
+    nothrow::lacpy( uplo2matrixtype( uplo_ ), n_, n_, A, lda, A_.data(), lda_,
+                    Check::None );
+    return factor();
+}
+
+//------------------------------------------------------------------------------
+/// Reduces the matrix in data() in place to tridiagonal form,
+/// $A = Q T Q^H$, and forms Q.
+/// @return info from hetrd, always 0.
+template <typename scalar_t>
+int64_t ShiftedHermitian<scalar_t>::factor()
+{
+    int64_t info = nothrow::hetrd( uplo_, n_, A_.data(), lda_, D_.data(),
+                                   E_.data(), tau_.data(), work_.data(),
+                                   work_.size(), Check::None );
+    nothrow::lacpy( uplo2matrixtype( uplo_ ), n_, n_, A_.data(), lda_,
+                    Q_.data(), lda_, Check::None );
+    nothrow::ungtr( uplo_, n_, Q_.data(), lda_, tau_.data(), work_.data(),
+                    work_.size(), Check::None );
+    factored_ = true;
+    return info;
+}
+
+//------------------------------------------------------------------------------
+/// Solves $(A - \sigma I) X = B$ for one shift, overwriting the n-by-nrhs
+/// matrix B with X. Costs O(n^2 nrhs), for applying Q.
+/// Workspace grows on the first call with a larger nrhs, and is then reused.
+/// @throws Error if $T - \sigma I$ is exactly singular.
+template <typename scalar_t>
+void ShiftedHermitian<scalar_t>::solve(
+    scalar_t sigma, int64_t nrhs, scalar_t* B, int64_t ldb )
+{
+    internal::throw_if( ! factored_, "factor() not called", __func__ );
+    check_dim( nrhs, __func__ );
+    lapack_error_if( ldb < max( 1, n_ ) );
+    check_dim( ldb, __func__ );
+    if (n_ == 0 || nrhs == 0)
+        return;
+
+    if (int64_t( C_.size() ) < n_ * nrhs)
+        C_.resize( n_ * nrhs );
+
+    // C = Q^H B; solve ( T - sigma I ) C = C; B = Q C
+    const scalar_t one = 1, zero = 0;
+    blas::gemm( Layout::ColMajor, Op::ConjTrans, Op::NoTrans, n_, nrhs, n_,
+                one, Q_.data(), lda_, B, ldb, zero, C_.data(), n_ );
+    int64_t info = tridiag_shift_solve(
+        n_, sigma, D_.data(), E_.data(), nrhs, C_.data(), n_,
+        tridiag_.data() );
+    internal::throw_if( info != 0, "info != 0", __func__,
+                        "T - sigma I is singular, U(%lld, %lld) = 0",
+                        (long long) info, (long long) info );
+    blas::gemm( Layout::ColMajor, Op::NoTrans, Op::NoTrans, n_, nrhs, n_,
+                one, Q_.data(), lda_, C_.data(), n_, zero, B, ldb );
+}
+
+//------------------------------------------------------------------------------
+/// Solves $(A - \sigma_s I) X_s = B$ for each of nshift shifts, with the
+/// same n-by-nrhs B. X is n-by-(nshift nrhs), with $X_s$ in columns
+/// s nrhs to (s + 1) nrhs - 1, for 0 <= s < nshift. $Q^H B$ is computed
+/// once. Shifts are taken in blocks of about 256 columns: with OpenMP, the
+/// block's tridiagonal solves run in parallel, then one gemm applies Q to
+/// the whole block.
+/// Workspace grows on the first call with a larger nrhs, and is then reused.
+/// @throws Error if $T - \sigma_s I$ is exactly singular for any shift;
+/// the other shifts' solutions are still computed.
+template <typename scalar_t>
+void ShiftedHermitian<scalar_t>::solve(
+    int64_t nshift, scalar_t const* sigma,
+    int64_t nrhs, scalar_t const* B, int64_t ldb,
+    scalar_t* X, int64_t ldx )
+{
+    internal::throw_if( ! factored_, "factor() not called", __func__ );
+    check_dim( nshift, __func__ );
+    check_dim( nrhs, __func__ );
+    lapack_error_if( ldb < max( 1, n_ ) );
+    check_dim( ldb, __func__ );
+    lapack_error_if( ldx < max( 1, n_ ) );
+    check_dim( ldx, __func__ );
+    if (n_ == 0 || nrhs == 0 || nshift == 0)
+        return;
+
+    // shifts per block
+    int64_t sb = min( nshift, max( 1, 256 / nrhs ) );
+    int64_t ldy = n_;
+    if (int64_t( C_.size() ) < n_ * nrhs)
+        C_.resize( n_ * nrhs );
+    if (int64_t( Y_.size() ) < ldy * nrhs * sb)
+        Y_.resize( ldy * nrhs * sb );
+
+    // C = Q^H B, shared by all shifts
+    const scalar_t one = 1, zero = 0;
+    blas::gemm( Layout::ColMajor, Op::ConjTrans, Op::NoTrans, n_, nrhs, n_,
+                one, Q_.data(), lda_, B, ldb, zero, C_.data(), n_ );
+
+    // per-thread workspace, allocated outside the parallel region
+    lapack::vector< scalar_t > tridiag( region_threads( sb > 1 ) * 3*n_ );
+
+    int64_t first_singular = nshift;
+    for (int64_t s0 = 0; s0 < nshift; s0 += sb) {
+        int64_t sn = min( sb, nshift - s0 );
+
+        // Y_s = ( T - sigma_s I )^{-1} C, for shifts in this block
+        #ifdef _OPENMP
+        #pragma omp parallel if (sn > 1)
+        #endif
+        {
+            scalar_t* tridiag_t = &tridiag[ thread_index() * 3*n_ ];
+
+            #ifdef _OPENMP
+            #pragma omp for schedule( static ) reduction( min:first_singular )
+            #endif
+            for (int64_t s = 0; s < sn; ++s) {
+                scalar_t* Ys = &Y_[ s*nrhs*ldy ];
+                nothrow::lacpy( MatrixType::General, n_, nrhs, C_.data(), n_,
+                                Ys, ldy, Check::None );
+                int64_t info = tridiag_shift_solve(
+                    n_, sigma[ s0 + s ], D_.data(), E_.data(), nrhs, Ys, ldy,
+                    tridiag_t );
+                if (info != 0)
+                    first_singular = min( first_singular, s0 + s );
+            }
+        }
+
+        // X_block = Q Y, for all shifts in this block
+        blas::gemm( Layout::ColMajor, Op::NoTrans, Op::NoTrans,
+                    n_, sn*nrhs, n_,
+                    one, Q_.data(), lda_, Y_.data(), ldy,
+                    zero, &X[ s0*nrhs*ldx ], ldx );
+    }
+    internal::throw_if( first_singular < nshift, "info != 0", __func__,
+                        "T - sigma[ %lld ] I is singular",
+                        (long long) first_singular );
+}
+
+//==============================================================================
+// GeneralizedEigen
+
+namespace {
+
+//------------------------------------------------------------------------------
+// Solves the generalized eigenproblem for A, given the Cholesky factor of B,
+// as hegvd does after potrf: reduces A to standard form with hegst, solves
+// it with heevd, and back-transforms the eigenvectors in A.
+// @return info from heevd: 0, or i > 0 if it failed to converge.
+template <typename scalar_t>
+int64_t generalized_eigen_solve(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    scalar_t const* B, int64_t ldb,
+    scalar_t* A, int64_t lda, blas::real_type< scalar_t >* W,
+    scalar_t* work, int64_t lwork,
+    blas::real_type< scalar_t >* rwork, int64_t lrwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    nothrow::hegst( itype, uplo, n, A, lda, B, ldb, Check::None );
+    int64_t info = nothrow::heevd( jobz, uplo, n, A, lda, W, work, lwork, rwork,
+                                   lrwork, iwork, liwork, Check::None );
+    if (jobz == Job::Vec && info == 0) {
+        // itype 1, 2: x = L^{-H} y or U^{-1} y; itype 3: x = L y or U^H y.
+        const scalar_t one = 1;
+        if (itype == 1 || itype == 2) {
+            Op trans = (uplo == Uplo::Upper ? Op::NoTrans : Op::ConjTrans);
+            blas::trsm( Layout::ColMajor, Side::Left, uplo, trans,
+                        Diag::NonUnit, n, n, one, B, ldb, A, lda );
+        }
+        else {
+            Op trans = (uplo == Uplo::Upper ? Op::ConjTrans : Op::NoTrans);
+            blas::trmm( Layout::ColMajor, Side::Left, uplo, trans,
+                        Diag::NonUnit, n, n, one, B, ldb, A, lda );
+        }
+    }
+    return info;
+}
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+/// Constructs empty generalized eigensolver; call resize before factor.
+template <typename scalar_t>
+GeneralizedEigen<scalar_t>::GeneralizedEigen(
+    int64_t itype, lapack::Uplo uplo
+):
+    itype_( itype ),
+    uplo_( uplo ),
+    n_( 0 ),
+    lda_( 1 ),
+    info_( 0 ),
+    factored_( false )
+{
+    lapack_error_if( itype < 1 || itype > 3 );
+    lapack_error_if( uplo != Uplo::Lower && uplo != Uplo::Upper );
+}
+
+//------------------------------------------------------------------------------
+/// Constructs generalized eigensolver for n-by-n matrices, allocating the
+/// factor of B and workspace.
+template <typename scalar_t>
+GeneralizedEigen<scalar_t>::GeneralizedEigen(
+    int64_t itype, lapack::Uplo uplo, int64_t n
+):
+    GeneralizedEigen( itype, uplo )
+{
+    resize( n );
+}
+
+//------------------------------------------------------------------------------
+/// Sets shape to n-by-n. Storage is reallocated only if it grows.
+/// Discards any factorization.
+template <typename scalar_t>
+void GeneralizedEigen<scalar_t>::resize( int64_t n )
+{
+    check_dim( n, __func__ );
+    n_ = n;
+    lda_ = max( 1, n );
+    B_.resize( lda_ * n );
+
+    // query heevd's workspace for eigenvectors, which covers eigenvalues only.
+    // Real syevd has no rwork, so it doesn't set qry_rwork.
+    scalar_t qry_work[ 1 ] = { 0 };
+    real_t qry_rwork[ 1 ] = { 0 }, qry_W[ 1 ];
+    lapack_int qry_iwork[ 1 ] = { 0 };
+    nothrow::heevd( Job::Vec, uplo_, n_, B_.data(), lda_, qry_W, qry_work,
+                    -1, qry_rwork, -1, qry_iwork, -1, Check::None );
+    work_.resize( max( 1, int64_t( real( qry_work[ 0 ] ) ) ) );
+    if (blas::is_complex< scalar_t >::value)
+        rwork_.resize( max( 1, int64_t( qry_rwork[ 0 ] ) ) );
+    else
+        rwork_.resize( 1 );
+    iwork_.resize( max( 1, int64_t( qry_iwork[ 0 ] ) ) );
+    info_ = 0;
+    factored_ = false;
+}
+
+//------------------------------------------------------------------------------
+/// Copies the uplo triangle of the n-by-n Hermitian positive definite
+/// matrix B into the object and factors it.
+/// @return info from potrf: 0 on success, i > 0 if the leading minor of
+/// order i is not positive definite.
+template <typename scalar_t>
+int64_t GeneralizedEigen<scalar_t>::factor( scalar_t const* B, int64_t ldb )
+{
+    lapack_error_if( ldb < max( 1, n_ ) );
+    check_dim( ldb, __func__ );
+    nothrow::lacpy( uplo2matrixtype( uplo_ ), n_, n_, B, ldb, B_.data(), lda_,
+                    Check::None );
+    return factor();
+}
+
+//------------------------------------------------------------------------------
+/// Factors the matrix in data() in place.
+/// @return info from potrf.
+template <typename scalar_t>
+int64_t GeneralizedEigen<scalar_t>::factor()
+{
+    info_ = nothrow::potrf( uplo_, n_, B_.data(), lda_, Check::None );
+    factored_ = true;
+    return info_;
+}
+
+//------------------------------------------------------------------------------
+/// Copies the uplo triangle of an existing Cholesky factor of B, as computed
+/// by potrf with the same uplo, e.g., from Cholesky::data(), into the
+/// object, without refactoring B.
+template <typename scalar_t>
+void GeneralizedEigen<scalar_t>::set_factor( scalar_t const* L, int64_t ldl )
+{
+    lapack_error_if( ldl < max( 1, n_ ) );
+    check_dim( ldl, __func__ );
+    nothrow::lacpy( uplo2matrixtype( uplo_ ), n_, n_, L, ldl, B_.data(), lda_,
+                    Check::None );
+    info_ = 0;
+    factored_ = true;
+}
+
+//------------------------------------------------------------------------------
+/// Computes the eigenvalues, and optionally eigenvectors, of the n-by-n
+/// Hermitian A with the factored B, as hegvd does, but without refactoring B.
+/// On exit, W holds the eigenvalues in ascending order. If jobz = Vec, A
+/// holds the eigenvectors Z, normalized as $Z^H B Z = I$ for itype 1, 2, or
+/// $Z^H B^{-1} Z = I$ for itype 3; otherwise, A's uplo triangle is destroyed.
+/// Doesn't allocate.
+/// @return info from heevd: 0 on success, i > 0 if it failed to converge.
+template <typename scalar_t>
+int64_t GeneralizedEigen<scalar_t>::solve(
+    lapack::Job jobz, scalar_t* A, int64_t lda, real_t* W )
+{
+    check_factored( factored_, info_, __func__ );
+    lapack_error_if( jobz != Job::NoVec && jobz != Job::Vec );
+    lapack_error_if( lda < max( 1, n_ ) );
+    check_dim( lda, __func__ );
+    return generalized_eigen_solve(
+        itype_, jobz, uplo_, n_, B_.data(), lda_,
+        A, lda, W, work_.data(), work_.size(), rwork_.data(), rwork_.size(),
+        iwork_.data(), iwork_.size() );
+}
+
+//------------------------------------------------------------------------------
+/// Solves the problem for each of batch matrices Aarray[ i ], each n-by-n
+/// with leading dimension lda, as solve( jobz, Aarray[ i ], lda, W_i ) does,
+/// with eigenvalues $W_i$ in column i of the n-by-batch W. With OpenMP,
+/// matrices are solved in parallel, each with one BLAS thread and its own
+/// heevd workspace.
+/// @return = 0: success.
+/// @return > 0: if return value = i, heevd failed to converge for
+///              Aarray[ i - 1 ]; the other matrices are still solved.
+template <typename scalar_t>
+int64_t GeneralizedEigen<scalar_t>::solve(
+    lapack::Job jobz, int64_t batch,
+    scalar_t* const* Aarray, int64_t lda,
+    real_t* W, int64_t ldw )
+{
+    check_factored( factored_, info_, __func__ );
+    lapack_error_if( jobz != Job::NoVec && jobz != Job::Vec );
+    check_dim( batch, __func__ );
+    lapack_error_if( lda < max( 1, n_ ) );
+    check_dim( lda, __func__ );
+    lapack_error_if( ldw < max( 1, n_ ) );
+    check_dim( ldw, __func__ );
+
+    // per-thread workspace, allocated outside the parallel region
+    int64_t nthreads = region_threads( batch > 1 );
+    int64_t lwork  = work_.size();
+    int64_t lrwork = rwork_.size();
+    int64_t liwork = iwork_.size();
+    lapack::vector< scalar_t > work( nthreads * lwork );
+    lapack::vector< real_t > rwork( nthreads * lrwork );
+    lapack::vector< lapack_int > iwork( nthreads * liwork );
+
+    int64_t first_fail = batch;
+    #ifdef _OPENMP
+    #pragma omp parallel if (batch > 1)
+    #endif
+    {
+        #ifdef _OPENMP
+            // avoid oversubscription by a threaded BLAS
+            ThreadScope scope( omp_get_num_threads() > 1 ? 1
+                                                         : get_num_threads() );
+        #endif
+        int64_t t = thread_index();
+        scalar_t* work_t = &work[ t*lwork ];
+        real_t* rwork_t = &rwork[ t*lrwork ];
+        lapack_int* iwork_t = &iwork[ t*liwork ];
+
+        #ifdef _OPENMP
+        #pragma omp for schedule( dynamic ) reduction( min:first_fail )
+        #endif
+        for (int64_t i = 0; i < batch; ++i) {
+            int64_t info = generalized_eigen_solve(
+                itype_, jobz, uplo_, n_, B_.data(), lda_,
+                Aarray[ i ], lda, &W[ i*ldw ],
+                work_t, lwork, rwork_t, lrwork, iwork_t, liwork );
+            if (info != 0)
+                first_fail = min( first_fail, i );
+        }
+    }
+    return (first_fail < batch ? first_fail + 1 : 0);
+}
+
+//==============================================================================
+// LSE and GLM
+
+namespace {
+
+//------------------------------------------------------------------------------
+// @return 0, or i > 0 if T(i,i) of the n-by-n triangular T is exactly zero,
+// as trtrs checks.
+template <typename scalar_t>
+int64_t zero_diagonal( int64_t n, scalar_t const* T, int64_t ldt )
+{
+    for (int64_t i = 0; i < n; ++i) {
+        if (T[ i + i*ldt ] == scalar_t( 0 ))
+            return i + 1;
+    }
+    return 0;
+}
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+/// Constructs empty LSE problem; call resize before factor_B.
+template <typename scalar_t>
+LSE<scalar_t>::LSE():
+    m_( 0 ),
+    n_( 0 ),
+    p_( 0 ),
+    lda_( 1 ),
+    ldb_( 1 ),
+    info_a_( 0 ),
+    info_b_( 0 ),
+    a_factored_( false ),
+    b_factored_( false )
+{}
+
+//------------------------------------------------------------------------------
+/// Constructs LSE problem for m-by-n A and p-by-n B, allocating the
+/// factors and workspace.
+template <typename scalar_t>
+LSE<scalar_t>::LSE( int64_t m, int64_t n, int64_t p ):
+    LSE()
+{
+    resize( m, n, p );
+}
+
+//------------------------------------------------------------------------------
+/// Sets shape to m-by-n A and p-by-n B, with p <= n <= m + p.
+/// Storage is reallocated only if it grows. Discards any factorization.
+template <typename scalar_t>
+void LSE<scalar_t>::resize( int64_t m, int64_t n, int64_t p )
+{
+    check_dim( m, __func__ );
+    check_dim( n, __func__ );
+    check_dim( p, __func__ );
+    lapack_error_if( p > n || n > m + p );
+    m_ = m;
+    n_ = n;
+    p_ = p;
+    lda_ = max( 1, m );
+    ldb_ = max( 1, p );
+    A_.resize( lda_ * n );
+    B_.resize( ldb_ * n );
+    taua_.resize( max( 1, n - p ) );
+    taub_.resize( max( 1, p ) );
+
+    // query gerqf's, unmrq's, and geqrf's optimal workspace
+    scalar_t qry_work[ 1 ];
+    nothrow::gerqf( p_, n_, B_.data(), ldb_, taub_.data(), qry_work, -1,
+                    Check::None );
+    int64_t lwork = max( 1, int64_t( real( qry_work[ 0 ] ) ) );
+    nothrow::unmrq( Side::Right, Op::ConjTrans, m_, n_, p_, B_.data(), ldb_,
+                    taub_.data(), A_.data(), lda_, qry_work, -1, Check::None );
+    lwork = max( lwork, int64_t( real( qry_work[ 0 ] ) ) );
+    nothrow::geqrf( m_, n_ - p_, A_.data(), lda_, taua_.data(), qry_work, -1,
+                    Check::None );
+    lwork = max( lwork, int64_t( real( qry_work[ 0 ] ) ) );
+    work_.resize( lwork );
+    info_a_ = 0;
+    info_b_ = 0;
+    a_factored_ = false;
+    b_factored_ = false;
+}
+
+//------------------------------------------------------------------------------
+/// Copies the p-by-n constraint matrix B into the object and computes its
+/// RQ factorization, $B = (0, T_{12}) Q$. Discards any factorization of A,
+/// which depends on Q.
+/// @return 0, or i > 0 if $T_{12}(i,i)$ is exactly zero.
+template <typename scalar_t>
+int64_t LSE<scalar_t>::factor_B( scalar_t const* B, int64_t ldb )
+{
+    lapack_error_if( ldb < max( 1, p_ ) );
+    check_dim( ldb, __func__ );
+    nothrow::lacpy( MatrixType::General, p_, n_, B, ldb, B_.data(), ldb_,
+                    Check::None );
+    nothrow::gerqf( p_, n_, B_.data(), ldb_, taub_.data(), work_.data(),
+                    work_.size(), Check::None );
+    info_b_ = zero_diagonal( p_, B_.data() + (n_ - p_)*ldb_, ldb_ );
+    b_factored_ = true;
+    a_factored_ = false;
+    return info_b_;
+}
+
+//------------------------------------------------------------------------------
+/// Copies the m-by-n objective matrix A into the object, forms
+/// $A Q^H = (A_1, A_2)$, and computes the QR factorization of $A_1$,
+/// $A_1 = Q_1 R_{11}$. Requires a successful factor_B.
+/// @return 0, or i > 0 if $R_{11}(i,i)$ is exactly zero.
+template <typename scalar_t>
+int64_t LSE<scalar_t>::factor_A( scalar_t const* A, int64_t lda )
+{
+    internal::throw_if( ! b_factored_, "factor_B() not called", __func__ );
+    internal::throw_if( info_b_ != 0, "info != 0", __func__,
+                        "B factorization failed, info = %lld",
+                        (long long) info_b_ );
+    lapack_error_if( lda < max( 1, m_ ) );
+    check_dim( lda, __func__ );
+    nothrow::lacpy( MatrixType::General, m_, n_, A, lda, A_.data(), lda_,
+                    Check::None );
+    nothrow::unmrq( Side::Right, Op::ConjTrans, m_, n_, p_, B_.data(), ldb_,
+                    taub_.data(), A_.data(), lda_, work_.data(), work_.size(),
+                    Check::None );
+    nothrow::geqrf( m_, n_ - p_, A_.data(), lda_, taua_.data(), work_.data(),
+                    work_.size(), Check::None );
+    info_a_ = zero_diagonal( n_ - p_, A_.data(), lda_ );
+    a_factored_ = true;
+    return info_a_;
+}
+
+//------------------------------------------------------------------------------
+/// Solves the LSE problem for each of nrhs pairs of columns of the
+/// m-by-nrhs C and p-by-nrhs D, giving the n-by-nrhs X:
+///     $y_2 = T_{12}^{-1} d$,
+///     $y_1 = R_{11}^{-1} (Q_1^H (c - A_2 y_2))_{1:n-p}$,
+///     $x = Q^H (y_1; y_2)$.
+/// C and D are not modified.
+/// Workspace grows on the first call with a larger nrhs, and is then reused.
+template <typename scalar_t>
+void LSE<scalar_t>::solve(
+    int64_t nrhs,
+    scalar_t const* C, int64_t ldc,
+    scalar_t const* D, int64_t ldd,
+    scalar_t* X, int64_t ldx )
+{
+    internal::throw_if( ! b_factored_, "factor_B() not called", __func__ );
+    internal::throw_if( ! a_factored_, "factor_A() not called", __func__ );
+    internal::throw_if( info_b_ != 0 || info_a_ != 0, "info != 0", __func__,
+                        "factorization failed, info = %lld",
+                        (long long) (info_b_ != 0 ? info_b_ : info_a_) );
+    check_dim( nrhs, __func__ );
+    lapack_error_if( ldc < max( 1, m_ ) );
+    check_dim( ldc, __func__ );
+    lapack_error_if( ldd < max( 1, p_ ) );
+    check_dim( ldd, __func__ );
+    lapack_error_if( ldx < max( 1, n_ ) );
+    check_dim( ldx, __func__ );
+    if (n_ == 0 || nrhs == 0)
+        return;
+
+    int64_t np = n_ - p_;
+    int64_t ldw = max( 1, m_ );
+    if (int64_t( C_.size() ) < ldw * nrhs)
+        C_.resize( ldw * nrhs );
+    scalar_t qry_work[ 1 ];
+    nothrow::unmqr( Side::Left, Op::ConjTrans, m_, nrhs, np, A_.data(), lda_,
+                    taua_.data(), C_.data(), ldw, qry_work, -1, Check::None );
+    int64_t lwork = int64_t( real( qry_work[ 0 ] ) );
+    nothrow::unmrq( Side::Left, Op::ConjTrans, n_, nrhs, p_, B_.data(), ldb_,
+                    taub_.data(), X, ldx, qry_work, -1, Check::None );
+    lwork = max( lwork, int64_t( real( qry_work[ 0 ] ) ) );
+    if (int64_t( work_.size() ) < lwork)
+        work_.resize( lwork );
+
+    // Y2 = T12^{-1} D, in rows np:n of X
+    const scalar_t one = 1;
+    nothrow::lacpy( MatrixType::General, p_, nrhs, D, ldd, &X[ np ], ldx,
+                    Check::None );
+    blas::trsm( Layout::ColMajor, Side::Left, Uplo::Upper, Op::NoTrans,
+                Diag::NonUnit, p_, nrhs,
+                one, B_.data() + np*ldb_, ldb_, &X[ np ], ldx );
+
+    // W = Q1^H (C - A2 Y2)
+    nothrow::lacpy( MatrixType::General, m_, nrhs, C, ldc, C_.data(), ldw,
+                    Check::None );
+    blas::gemm( Layout::ColMajor, Op::NoTrans, Op::NoTrans, m_, nrhs, p_,
+                -one, A_.data() + np*lda_, lda_, &X[ np ], ldx,
+                one, C_.data(), ldw );
+    nothrow::unmqr( Side::Left, Op::ConjTrans, m_, nrhs, np, A_.data(), lda_,
+                    taua_.data(), C_.data(), ldw, work_.data(), work_.size(),
+                    Check::None );
+
+    // Y1 = R11^{-1} W(0:np, :), in rows 0:np of X
+    nothrow::lacpy( MatrixType::General, np, nrhs, C_.data(), ldw, X, ldx,
+                    Check::None );
+    blas::trsm( Layout::ColMajor, Side::Left, Uplo::Upper, Op::NoTrans,
+                Diag::NonUnit, np, nrhs,
+                one, A_.data(), lda_, X, ldx );
+
+    // X = Q^H Y
+    nothrow::unmrq( Side::Left, Op::ConjTrans, n_, nrhs, p_, B_.data(), ldb_,
+                    taub_.data(), X, ldx, work_.data(), work_.size(),
+                    Check::None );
+}
+
+//------------------------------------------------------------------------------
+/// Constructs empty GLM problem; call resize before factor_A.
+template <typename scalar_t>
+GLM<scalar_t>::GLM():
+    n_( 0 ),
+    m_( 0 ),
+    p_( 0 ),
+    lda_( 1 ),
+    info_a_( 0 ),
+    info_b_( 0 ),
+    a_factored_( false ),
+    b_factored_( false )
+{}
+
+//------------------------------------------------------------------------------
+/// Constructs GLM problem for n-by-m A and n-by-p B, allocating the
+/// factors and workspace.
+template <typename scalar_t>
+GLM<scalar_t>::GLM( int64_t n, int64_t m, int64_t p ):
+    GLM()
+{
+    resize( n, m, p );
+}
+
+//------------------------------------------------------------------------------
+/// Sets shape to n-by-m A and n-by-p B, with m <= n <= m + p.
+/// Storage is reallocated only if it grows. Discards any factorization.
+template <typename scalar_t>
+void GLM<scalar_t>::resize( int64_t n, int64_t m, int64_t p )
+{
+    check_dim( n, __func__ );
+    check_dim( m, __func__ );
+    check_dim( p, __func__ );
+    lapack_error_if( m > n || n > m + p );
+    n_ = n;
+    m_ = m;
+    p_ = p;
+    lda_ = max( 1, n );
+    A_.resize( lda_ * m );
+    B_.resize( lda_ * p );
+    taua_.resize( max( 1, m ) );
+    taub_.resize( max( 1, min( n, p ) ) );
+
+    // query geqrf's, unmqr's, and gerqf's optimal workspace
+    scalar_t qry_work[ 1 ];
+    nothrow::geqrf( n_, m_, A_.data(), lda_, taua_.data(), qry_work, -1,
+                    Check::None );
+    int64_t lwork = max( 1, int64_t( real( qry_work[ 0 ] ) ) );
+    nothrow::unmqr( Side::Left, Op::ConjTrans, n_, p_, m_, A_.data(), lda_,
+                    taua_.data(), B_.data(), lda_, qry_work, -1, Check::None );
+    lwork = max( lwork, int64_t( real( qry_work[ 0 ] ) ) );
+    nothrow::gerqf( n_, p_, B_.data(), lda_, taub_.data(), qry_work, -1,
+                    Check::None );
+    lwork = max( lwork, int64_t( real( qry_work[ 0 ] ) ) );
+    work_.resize( lwork );
+    info_a_ = 0;
+    info_b_ = 0;
+    a_factored_ = false;
+    b_factored_ = false;
+}
+
+//------------------------------------------------------------------------------
+/// Copies the n-by-m design matrix A into the object and computes its QR
+/// factorization, $A = Q (R; 0)$. Discards any factorization of B,
+/// which depends on Q.
+/// @return 0, or i > 0 if $R(i,i)$ is exactly zero.
+template <typename scalar_t>
+int64_t GLM<scalar_t>::factor_A( scalar_t const* A, int64_t lda )
+{
+    lapack_error_if( lda < max( 1, n_ ) );
+    check_dim( lda, __func__ );
+    nothrow::lacpy( MatrixType::General, n_, m_, A, lda, A_.data(), lda_,
+                    Check::None );
+    nothrow::geqrf( n_, m_, A_.data(), lda_, taua_.data(), work_.data(),
+                    work_.size(), Check::None );
+    info_a_ = zero_diagonal( m_, A_.data(), lda_ );
+    a_factored_ = true;
+    b_factored_ = false;
+    return info_a_;
+}
+
+//------------------------------------------------------------------------------
+/// Copies the n-by-p matrix B into the object, forms $Q^H B$, and computes
+/// its RQ factorization, $Q^H B = T Z$, with $T_{22}$ the
+/// (n-m)-by-(n-m) upper triangle in rows m:n, columns m+p-n:p of T.
+/// Requires a successful factor_A.
+/// @return 0, or i > 0 if $T_{22}(i,i)$ is exactly zero.
+template <typename scalar_t>
+int64_t GLM<scalar_t>::factor_B( scalar_t const* B, int64_t ldb )
+{
+    internal::throw_if( ! a_factored_, "factor_A() not called", __func__ );
+    internal::throw_if( info_a_ != 0, "info != 0", __func__,
+                        "A factorization failed, info = %lld",
+                        (long long) info_a_ );
+    lapack_error_if( ldb < max( 1, n_ ) );
+    check_dim( ldb, __func__ );
+    nothrow::lacpy( MatrixType::General, n_, p_, B, ldb, B_.data(), lda_,
+                    Check::None );
+    nothrow::unmqr( Side::Left, Op::ConjTrans, n_, p_, m_, A_.data(), lda_,
+                    taua_.data(), B_.data(), lda_, work_.data(), work_.size(),
+                    Check::None );
+    nothrow::gerqf( n_, p_, B_.data(), lda_, taub_.data(), work_.data(),
+                    work_.size(), Check::None );
+    info_b_ = zero_diagonal( n_ - m_, B_.data() + m_ + (m_ + p_ - n_)*lda_,
+                             lda_ );
+    b_factored_ = true;
+    return info_b_;
+}
+
+//------------------------------------------------------------------------------
+/// Solves the GLM problem for each of the nrhs columns of the n-by-nrhs D,
+/// giving the m-by-nrhs X and p-by-nrhs Y. With $Q^H d = (d_1; d_2)$:
+///     $z_2 = T_{22}^{-1} d_2$,
+///     $x = R^{-1} (d_1 - T_{12} z_2)$,
+///     $y = Z^H (0; z_2)$.
+/// D is not modified.
+/// Workspace grows on the first call with a larger nrhs, and is then reused.
+template <typename scalar_t>
+void GLM<scalar_t>::solve(
+    int64_t nrhs,
+    scalar_t const* D, int64_t ldd,
+    scalar_t* X, int64_t ldx,
+    scalar_t* Y, int64_t ldy )
+{
+    internal::throw_if( ! a_factored_, "factor_A() not called", __func__ );
+    internal::throw_if( ! b_factored_, "factor_B() not called", __func__ );
+    internal::throw_if( info_a_ != 0 || info_b_ != 0, "info != 0", __func__,
+                        "factorization failed, info = %lld",
+                        (long long) (info_a_ != 0 ? info_a_ : info_b_) );
+    check_dim( nrhs, __func__ );
+    lapack_error_if( ldd < max( 1, n_ ) );
+    check_dim( ldd, __func__ );
+    lapack_error_if( ldx < max( 1, m_ ) );
+    check_dim( ldx, __func__ );
+    lapack_error_if( ldy < max( 1, p_ ) );
+    check_dim( ldy, __func__ );
+    if (n_ == 0 || nrhs == 0)
+        return;
+
+    int64_t nm = n_ - m_;
+    int64_t mpn = m_ + p_ - n_;
+    int64_t ldw = n_;
+    if (int64_t( C_.size() ) < ldw * nrhs)
+        C_.resize( ldw * nrhs );
+    int64_t kb = min( n_, p_ );
+    scalar_t const* Zrows = B_.data() + max( 0, n_ - p_ );
+    scalar_t qry_work[ 1 ];
+    nothrow::unmqr( Side::Left, Op::ConjTrans, n_, nrhs, m_, A_.data(), lda_,
+                    taua_.data(), C_.data(), ldw, qry_work, -1, Check::None );
+    int64_t lwork = int64_t( real( qry_work[ 0 ] ) );
+    nothrow::unmrq( Side::Left, Op::ConjTrans, p_, nrhs, kb, Zrows, lda_,
+                    taub_.data(), Y, ldy, qry_work, -1, Check::None );
+    lwork = max( lwork, int64_t( real( qry_work[ 0 ] ) ) );
+    if (int64_t( work_.size() ) < lwork)
+        work_.resize( lwork );
+
+    // W = Q^H D
+    nothrow::lacpy( MatrixType::General, n_, nrhs, D, ldd, C_.data(), ldw,
+                    Check::None );
+    nothrow::unmqr( Side::Left, Op::ConjTrans, n_, nrhs, m_, A_.data(), lda_,
+                    taua_.data(), C_.data(), ldw, work_.data(), work_.size(),
+                    Check::None );
+
+    // Y = (0; T22^{-1} W(m:n, :))
+    const scalar_t zero = 0, one = 1;
+    lapack::laset( MatrixType::General, mpn, nrhs, zero, zero, Y, ldy );
+    nothrow::lacpy( MatrixType::General, nm, nrhs, C_.data() + m_, ldw,
+                    &Y[ mpn ], ldy, Check::None );
+    blas::trsm( Layout::ColMajor, Side::Left, Uplo::Upper, Op::NoTrans,
+                Diag::NonUnit, nm, nrhs,
+                one, B_.data() + m_ + mpn*lda_, lda_, &Y[ mpn ], ldy );
+
+    // X = R^{-1} (W(0:m, :) - T12 Y(mpn:p, :))
+    blas::gemm( Layout::ColMajor, Op::NoTrans, Op::NoTrans, m_, nrhs, nm,
+                -one, B_.data() + mpn*lda_, lda_, &Y[ mpn ], ldy,
+                one, C_.data(), ldw );
+    nothrow::lacpy( MatrixType::General, m_, nrhs, C_.data(), ldw, X, ldx,
+                    Check::None );
+    blas::trsm( Layout::ColMajor, Side::Left, Uplo::Upper, Op::NoTrans,
+                Diag::NonUnit, m_, nrhs,
+                one, A_.data(), lda_, X, ldx );
+
+    // Y = Z^H Y
+    nothrow::unmrq( Side::Left, Op::ConjTrans, p_, nrhs, kb, Zrows, lda_,
+                    taub_.data(), Y, ldy, work_.data(), work_.size(),
+                    Check::None );
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template class LU< float >;
+template class LU< double >;
+template class LU< std::complex<float> >;
+template class LU< std::complex<double> >;
+
+template class Cholesky< float >;
+template class Cholesky< double >;
+template class Cholesky< std::complex<float> >;
+template class Cholesky< std::complex<double> >;
+
+template class LDLT< float >;
+template class LDLT< double >;
+template class LDLT< std::complex<float> >;
+template class LDLT< std::complex<double> >;
+
+template class QR< float >;
+template class QR< double >;
+template class QR< std::complex<float> >;
+template class QR< std::complex<double> >;
+
+template class ShiftedHessenberg< float >;
+template class ShiftedHessenberg< double >;
+template class ShiftedHessenberg< std::complex<float> >;
+template class ShiftedHessenberg< std::complex<double> >;
+
+template class ShiftedHermitian< float >;
+template class ShiftedHermitian< double >;
+template class ShiftedHermitian< std::complex<float> >;
+template class ShiftedHermitian< std::complex<double> >;
+
+template class GeneralizedEigen< float >;
+template class GeneralizedEigen< double >;
+template class GeneralizedEigen< std::complex<float> >;
+template class GeneralizedEigen< std::complex<double> >;
+
+template class LSE< float >;
+template class LSE< double >;
+template class LSE< std::complex<float> >;
+template class LSE< std::complex<double> >;
+
+template class GLM< float >;
+template class GLM< double >;
+template class GLM< std::complex<float> >;
+template class GLM< std::complex<double> >;
+
+#if LAPACK_VERSION >= 30400  // >= 3.4
+template class StreamingLS< float >;
+template class StreamingLS< double >;
+template class StreamingLS< std::complex<float> >;
+template class StreamingLS< std::complex<double> >;
+#endif
+
+}  // namespace lapack
@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "dispatch.hh"
 
 #include <vector>
 
@@ -46,7 +47,7 @@ int64_t geev(
     // query for workspace size
     float qry_work[1];
     lapack_int ineg_one = -1;
-    LAPACK_sgeev(
+    lapack_dispatch( LAPACK_sgeev, n )(
         &jobvl_, &jobvr_, &n_,
         A, &lda_,
         &WR[0], &WI[0],
@@ -65,7 +66,7 @@ int64_t geev(
     // allocate workspace
     lapack::vector< float > work( lwork_ );
 
-    LAPACK_sgeev(
+    lapack_dispatch( LAPACK_sgeev, n )(
         &jobvl_, &jobvr_, &n_,
         A, &lda_,
         &WR[0], &WI[0],
@@ -117,7 +118,7 @@ int64_t geev(
     // query for workspace size
     double qry_work[1];
     lapack_int ineg_one = -1;
-    LAPACK_dgeev(
+    lapack_dispatch( LAPACK_dgeev, n )(
         &jobvl_, &jobvr_, &n_,
         A, &lda_,
         &WR[0], &WI[0],
@@ -136,7 +137,7 @@ int64_t geev(
     // allocate workspace
     lapack::vector< double > work( lwork_ );
 
-    LAPACK_dgeev(
+    lapack_dispatch( LAPACK_dgeev, n )(
         &jobvl_, &jobvr_, &n_,
         A, &lda_,
         &WR[0], &WI[0],
@@ -185,7 +186,7 @@ int64_t geev(
     std::complex<float> qry_work[1];
     float qry_rwork[1];
     lapack_int ineg_one = -1;
-    LAPACK_cgeev(
+    lapack_dispatch( LAPACK_cgeev, n )(
         &jobvl_, &jobvr_, &n_,
         (lapack_complex_float*) A, &lda_,
         (lapack_complex_float*) W,
@@ -206,7 +207,7 @@ int64_t geev(
     lapack::vector< std::complex<float> > work( lwork_ );
     lapack::vector< float > rwork( (2*n) );
 
-    LAPACK_cgeev(
+    lapack_dispatch( LAPACK_cgeev, n )(
         &jobvl_, &jobvr_, &n_,
         (lapack_complex_float*) A, &lda_,
         (lapack_complex_float*) W,
@@ -352,7 +353,7 @@ int64_t geev(
     std::complex<double> qry_work[1];
     double qry_rwork[1];
     lapack_int ineg_one = -1;
-    LAPACK_zgeev(
+    lapack_dispatch( LAPACK_zgeev, n )(
         &jobvl_, &jobvr_, &n_,
         (lapack_complex_double*) A, &lda_,
         (lapack_complex_double*) W,
@@ -373,7 +374,7 @@ int64_t geev(
     lapack::vector< std::complex<double> > work( lwork_ );
     lapack::vector< double > rwork( (2*n) );
 
-    LAPACK_zgeev(
+    lapack_dispatch( LAPACK_zgeev, n )(
         &jobvl_, &jobvr_, &n_,
         (lapack_complex_double*) A, &lda_,
         (lapack_complex_double*) W,
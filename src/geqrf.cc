@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "dispatch.hh"
 
 #include <vector>
 
@@ -36,7 +37,7 @@ int64_t geqrf(
     // query for workspace size
     float qry_work[1];
     lapack_int ineg_one = -1;
-    LAPACK_sgeqrf(
+    lapack_dispatch( LAPACK_sgeqrf, max( m, n ) )(
         &m_, &n_,
         A, &lda_,
         tau,
@@ -49,7 +50,7 @@ int64_t geqrf(
     // allocate workspace
     lapack::vector< float > work( lwork_ );
 
-    LAPACK_sgeqrf(
+    lapack_dispatch( LAPACK_sgeqrf, max( m, n ) )(
         &m_, &n_,
         A, &lda_,
         tau,
@@ -81,7 +82,7 @@ int64_t geqrf(
     // query for workspace size
     double qry_work[1];
     lapack_int ineg_one = -1;
-    LAPACK_dgeqrf(
+    lapack_dispatch( LAPACK_dgeqrf, max( m, n ) )(
         &m_, &n_,
         A, &lda_,
         tau,
@@ -94,7 +95,7 @@ int64_t geqrf(
     // allocate workspace
     lapack::vector< double > work( lwork_ );
 
-    LAPACK_dgeqrf(
+    lapack_dispatch( LAPACK_dgeqrf, max( m, n ) )(
         &m_, &n_,
         A, &lda_,
         tau,
@@ -126,7 +127,7 @@ int64_t geqrf(
     // query for workspace size
     std::complex<float> qry_work[1];
     lapack_int ineg_one = -1;
-    LAPACK_cgeqrf(
+    lapack_dispatch( LAPACK_cgeqrf, max( m, n ) )(
         &m_, &n_,
         (lapack_complex_float*) A, &lda_,
         (lapack_complex_float*) tau,
@@ -139,7 +140,7 @@ int64_t geqrf(
     // allocate workspace
     lapack::vector< std::complex<float> > work( lwork_ );
 
-    LAPACK_cgeqrf(
+    lapack_dispatch( LAPACK_cgeqrf, max( m, n ) )(
         &m_, &n_,
         (lapack_complex_float*) A, &lda_,
         (lapack_complex_float*) tau,
@@ -222,7 +223,7 @@ int64_t geqrf(
     // query for workspace size
     std::complex<double> qry_work[1];
     lapack_int ineg_one = -1;
-    LAPACK_zgeqrf(
+    lapack_dispatch( LAPACK_zgeqrf, max( m, n ) )(
         &m_, &n_,
         (lapack_complex_double*) A, &lda_,
         (lapack_complex_double*) tau,
@@ -235,7 +236,7 @@ int64_t geqrf(
     // allocate workspace
     lapack::vector< std::complex<double> > work( lwork_ );
 
-    LAPACK_zgeqrf(
+    lapack_dispatch( LAPACK_zgeqrf, max( m, n ) )(
         &m_, &n_,
         (lapack_complex_double*) A, &lda_,
         (lapack_complex_double*) tau,
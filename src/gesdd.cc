@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "dispatch.hh"
 
 #include <vector>
 
@@ -44,7 +45,7 @@ int64_t gesdd(
     float qry_work[1];
     lapack_int qry_iwork[1];
     lapack_int ineg_one = -1;
-    LAPACK_sgesdd(
+    lapack_dispatch( LAPACK_sgesdd, max( m, n ) )(
         &jobz_, &m_, &n_,
         A, &lda_,
         S,
@@ -65,7 +66,7 @@ int64_t gesdd(
     lapack::vector< float > work( lwork_ );
     lapack::vector< lapack_int > iwork( (8*min(m,n)) );
 
-    LAPACK_sgesdd(
+    lapack_dispatch( LAPACK_sgesdd, max( m, n ) )(
         &jobz_, &m_, &n_,
         A, &lda_,
         S,
@@ -112,7 +113,7 @@ int64_t gesdd(
     double qry_work[1];
     lapack_int qry_iwork[1];
     lapack_int ineg_one = -1;
-    LAPACK_dgesdd(
+    lapack_dispatch( LAPACK_dgesdd, max( m, n ) )(
         &jobz_, &m_, &n_,
         A, &lda_,
         S,
@@ -133,7 +134,7 @@ int64_t gesdd(
     lapack::vector< double > work( lwork_ );
     lapack::vector< lapack_int > iwork( (8*min(m,n)) );
 
-    LAPACK_dgesdd(
+    lapack_dispatch( LAPACK_dgesdd, max( m, n ) )(
         &jobz_, &m_, &n_,
         A, &lda_,
         S,
@@ -181,7 +182,7 @@ int64_t gesdd(
     float qry_rwork[1] = { 0 };
     lapack_int qry_iwork[1];
     lapack_int ineg_one = -1;
-    LAPACK_cgesdd(
+    lapack_dispatch( LAPACK_cgesdd, max( m, n ) )(
         &jobz_, &m_, &n_,
         (lapack_complex_float*) A, &lda_,
         S,
@@ -217,7 +218,7 @@ int64_t gesdd(
     lapack::vector< float > rwork( lrwork_ );
     lapack::vector< lapack_int > iwork( (8*min(m,n)) );
 
-    LAPACK_cgesdd(
+    lapack_dispatch( LAPACK_cgesdd, max( m, n ) )(
         &jobz_, &m_, &n_,
         (lapack_complex_float*) A, &lda_,
         S,
@@ -372,7 +373,7 @@ int64_t gesdd(
     double qry_rwork[1] = { 0 };
     lapack_int qry_iwork[1];
     lapack_int ineg_one = -1;
-    LAPACK_zgesdd(
+    lapack_dispatch( LAPACK_zgesdd, max( m, n ) )(
         &jobz_, &m_, &n_,
         (lapack_complex_double*) A, &lda_,
         S,
@@ -408,7 +409,7 @@ int64_t gesdd(
     lapack::vector< double > rwork( lrwork_ );
     lapack::vector< lapack_int > iwork( (8*min(m,n)) );
 
-    LAPACK_zgesdd(
+    lapack_dispatch( LAPACK_zgesdd, max( m, n ) )(
         &jobz_, &m_, &n_,
         (lapack_complex_double*) A, &lda_,
         S,
@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "dispatch.hh"
 
 #include <vector>
 
@@ -43,7 +44,7 @@ int64_t gesv(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
-    LAPACK_sgesv(
+    lapack_dispatch( LAPACK_sgesv, n )(
         &n_, &nrhs_,
         A, &lda_,
         ipiv_ptr,
@@ -85,7 +86,7 @@ int64_t gesv(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
-    LAPACK_dgesv(
+    lapack_dispatch( LAPACK_dgesv, n )(
         &n_, &nrhs_,
         A, &lda_,
         ipiv_ptr,
@@ -127,7 +128,7 @@ int64_t gesv(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
-    LAPACK_cgesv(
+    lapack_dispatch( LAPACK_cgesv, n )(
         &n_, &nrhs_,
         (lapack_complex_float*) A, &lda_,
         ipiv_ptr,
@@ -218,7 +219,7 @@ int64_t gesv(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
-    LAPACK_zgesv(
+    lapack_dispatch( LAPACK_zgesv, n )(
         &n_, &nrhs_,
         (lapack_complex_double*) A, &lda_,
         ipiv_ptr,
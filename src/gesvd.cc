@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "dispatch.hh"
 
 #include <vector>
 
@@ -44,7 +45,7 @@ int64_t gesvd(
     // query for workspace size
     float qry_work[1];
     lapack_int ineg_one = -1;
-    LAPACK_sgesvd(
+    lapack_dispatch( LAPACK_sgesvd, max( m, n ) )(
         &jobu_, &jobvt_, &m_, &n_,
         A, &lda_,
         S,
@@ -61,9 +62,9 @@ int64_t gesvd(
     lapack_int lwork_ = real(qry_work[0]);
 
     // allocate workspace
-    std::vector< float > work( lwork_ );
+    lapack::vector< float > work( lwork_ );
 
-    LAPACK_sgesvd(
+    lapack_dispatch( LAPACK_sgesvd, max( m, n ) )(
         &jobu_, &jobvt_, &m_, &n_,
         A, &lda_,
         S,
@@ -109,7 +110,7 @@ int64_t gesvd(
     // query for workspace size
     double qry_work[1];
     lapack_int ineg_one = -1;
-    LAPACK_dgesvd(
+    lapack_dispatch( LAPACK_dgesvd, max( m, n ) )(
         &jobu_, &jobvt_, &m_, &n_,
         A, &lda_,
         S,
@@ -126,9 +127,9 @@ int64_t gesvd(
     lapack_int lwork_ = real(qry_work[0]);
 
     // allocate workspace
-    std::vector< double > work( lwork_ );
+    lapack::vector< double > work( lwork_ );
 
-    LAPACK_dgesvd(
+    lapack_dispatch( LAPACK_dgesvd, max( m, n ) )(
         &jobu_, &jobvt_, &m_, &n_,
         A, &lda_,
         S,
@@ -175,7 +176,7 @@ int64_t gesvd(
     std::complex<float> qry_work[1];
     float qry_rwork[1];
     lapack_int ineg_one = -1;
-    LAPACK_cgesvd(
+    lapack_dispatch( LAPACK_cgesvd, max( m, n ) )(
         &jobu_, &jobvt_, &m_, &n_,
         (lapack_complex_float*) A, &lda_,
         S,
@@ -193,10 +194,10 @@ int64_t gesvd(
     lapack_int lwork_ = real(qry_work[0]);
 
     // allocate workspace
-    std::vector< std::complex<float> > work( lwork_ );
-    std::vector< float > rwork( (5*min(m,n)) );
+    lapack::vector< std::complex<float> > work( lwork_ );
+    lapack::vector< float > rwork( (5*min(m,n)) );
 
-    LAPACK_cgesvd(
+    lapack_dispatch( LAPACK_cgesvd, max( m, n ) )(
         &jobu_, &jobvt_, &m_, &n_,
         (lapack_complex_float*) A, &lda_,
         S,
@@ -353,7 +354,7 @@ int64_t gesvd(
     std::complex<double> qry_work[1];
     double qry_rwork[1];
     lapack_int ineg_one = -1;
-    LAPACK_zgesvd(
+    lapack_dispatch( LAPACK_zgesvd, max( m, n ) )(
         &jobu_, &jobvt_, &m_, &n_,
         (lapack_complex_double*) A, &lda_,
         S,
@@ -371,10 +372,10 @@ int64_t gesvd(
     lapack_int lwork_ = real(qry_work[0]);
 
     // allocate workspace
-    std::vector< std::complex<double> > work( lwork_ );
-    std::vector< double > rwork( (5*min(m,n)) );
+    lapack::vector< std::complex<double> > work( lwork_ );
+    lapack::vector< double > rwork( (5*min(m,n)) );
 
-    LAPACK_zgesvd(
+    lapack_dispatch( LAPACK_zgesvd, max( m, n ) )(
         &jobu_, &jobvt_, &m_, &n_,
         (lapack_complex_double*) A, &lda_,
         S,
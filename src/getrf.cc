@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "dispatch.hh"
 
 #include <vector>
 
@@ -40,7 +41,7 @@ int64_t getrf(
     #endif
     lapack_int info_ = 0;
 
-    LAPACK_sgetrf(
+    lapack_dispatch( LAPACK_sgetrf, max( m, n ) )(
         &m_, &n_,
         A, &lda_,
         ipiv_ptr, &info_ );
@@ -78,7 +79,7 @@ int64_t getrf(
     #endif
     lapack_int info_ = 0;
 
-    LAPACK_dgetrf(
+    lapack_dispatch( LAPACK_dgetrf, max( m, n ) )(
         &m_, &n_,
         A, &lda_,
         ipiv_ptr, &info_ );
@@ -116,7 +117,7 @@ int64_t getrf(
     #endif
     lapack_int info_ = 0;
 
-    LAPACK_cgetrf(
+    lapack_dispatch( LAPACK_cgetrf, max( m, n ) )(
         &m_, &n_,
         (lapack_complex_float*) A, &lda_,
         ipiv_ptr, &info_ );
@@ -196,7 +197,7 @@ int64_t getrf(
     #endif
     lapack_int info_ = 0;
 
-    LAPACK_zgetrf(
+    lapack_dispatch( LAPACK_zgetrf, max( m, n ) )(
         &m_, &n_,
         (lapack_complex_double*) A, &lda_,
         ipiv_ptr, &info_ );
@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "dispatch.hh"
 
 #include <vector>
 
@@ -45,7 +46,7 @@ int64_t getrs(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
-    LAPACK_sgetrs(
+    lapack_dispatch( LAPACK_sgetrs, n )(
         &trans_, &n_, &nrhs_,
         A, &lda_,
         ipiv_ptr,
@@ -90,7 +91,7 @@ int64_t getrs(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
-    LAPACK_dgetrs(
+    lapack_dispatch( LAPACK_dgetrs, n )(
         &trans_, &n_, &nrhs_,
         A, &lda_,
         ipiv_ptr,
@@ -135,7 +136,7 @@ int64_t getrs(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
-    LAPACK_cgetrs(
+    lapack_dispatch( LAPACK_cgetrs, n )(
         &trans_, &n_, &nrhs_,
         (lapack_complex_float*) A, &lda_,
         ipiv_ptr,
@@ -233,7 +234,7 @@ int64_t getrs(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
-    LAPACK_zgetrs(
+    lapack_dispatch( LAPACK_zgetrs, n )(
         &trans_, &n_, &nrhs_,
         (lapack_complex_double*) A, &lda_,
         ipiv_ptr,
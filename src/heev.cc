@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "dispatch.hh"
 
 #include <vector>
 
@@ -37,7 +38,7 @@ int64_t heev(
     std::complex<float> qry_work[1];
     float qry_rwork[1];
     lapack_int ineg_one = -1;
-    LAPACK_cheev(
+    lapack_dispatch( LAPACK_cheev, n )(
         &jobz_, &uplo_, &n_,
         (lapack_complex_float*) A, &lda_,
         W,
@@ -56,7 +57,7 @@ int64_t heev(
     lapack::vector< std::complex<float> > work( lwork_ );
     lapack::vector< float > rwork( (max( 1, 3*n-2 )) );
 
-    LAPACK_cheev(
+    lapack_dispatch( LAPACK_cheev, n )(
         &jobz_, &uplo_, &n_,
         (lapack_complex_float*) A, &lda_,
         W,
@@ -141,7 +142,7 @@ int64_t heev(
     std::complex<double> qry_work[1];
     double qry_rwork[1];
     lapack_int ineg_one = -1;
-    LAPACK_zheev(
+    lapack_dispatch( LAPACK_zheev, n )(
         &jobz_, &uplo_, &n_,
         (lapack_complex_double*) A, &lda_,
         W,
@@ -160,7 +161,7 @@ int64_t heev(
     lapack::vector< std::complex<double> > work( lwork_ );
     lapack::vector< double > rwork( (max( 1, 3*n-2 )) );
 
-    LAPACK_zheev(
+    lapack_dispatch( LAPACK_zheev, n )(
         &jobz_, &uplo_, &n_,
         (lapack_complex_double*) A, &lda_,
         W,
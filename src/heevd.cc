@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "dispatch.hh"
 
 #include <vector>
 
@@ -38,7 +39,7 @@ int64_t heevd(
     float qry_rwork[1];
     lapack_int qry_iwork[1];
     lapack_int ineg_one = -1;
-    LAPACK_cheevd(
+    lapack_dispatch( LAPACK_cheevd, n )(
         &jobz_, &uplo_, &n_,
         (lapack_complex_float*) A, &lda_,
         W,
@@ -61,7 +62,7 @@ int64_t heevd(
     lapack::vector< float > rwork( lrwork_ );
     lapack::vector< lapack_int > iwork( liwork_ );
 
-    LAPACK_cheevd(
+    lapack_dispatch( LAPACK_cheevd, n )(
         &jobz_, &uplo_, &n_,
         (lapack_complex_float*) A, &lda_,
         W,
@@ -160,7 +161,7 @@ int64_t heevd(
     double qry_rwork[1];
     lapack_int qry_iwork[1];
     lapack_int ineg_one = -1;
-    LAPACK_zheevd(
+    lapack_dispatch( LAPACK_zheevd, n )(
         &jobz_, &uplo_, &n_,
         (lapack_complex_double*) A, &lda_,
         W,
@@ -183,7 +184,7 @@ int64_t heevd(
     lapack::vector< double > rwork( lrwork_ );
     lapack::vector< lapack_int > iwork( liwork_ );
 
-    LAPACK_zheevd(
+    lapack_dispatch( LAPACK_zheevd, n )(
         &jobz_, &uplo_, &n_,
         (lapack_complex_double*) A, &lda_,
         W,
@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "dispatch.hh"
 
 #include <vector>
 
@@ -56,7 +57,7 @@ int64_t heevr(
     float qry_rwork[1];
     lapack_int qry_iwork[1];
     lapack_int ineg_one = -1;
-    LAPACK_cheevr(
+    lapack_dispatch( LAPACK_cheevr, n )(
         &jobz_, &range_, &uplo_, &n_,
         (lapack_complex_float*) A, &lda_, &vl, &vu, &il_, &iu_, &abstol, &nfound_,
         W,
@@ -81,7 +82,7 @@ int64_t heevr(
     lapack::vector< float > rwork( lrwork_ );
     lapack::vector< lapack_int > iwork( liwork_ );
 
-    LAPACK_cheevr(
+    lapack_dispatch( LAPACK_cheevr, n )(
         &jobz_, &range_, &uplo_, &n_,
         (lapack_complex_float*) A, &lda_, &vl, &vu, &il_, &iu_, &abstol, &nfound_,
         W,
@@ -338,7 +339,7 @@ int64_t heevr(
     double qry_rwork[1];
     lapack_int qry_iwork[1];
     lapack_int ineg_one = -1;
-    LAPACK_zheevr(
+    lapack_dispatch( LAPACK_zheevr, n )(
         &jobz_, &range_, &uplo_, &n_,
         (lapack_complex_double*) A, &lda_, &vl, &vu, &il_, &iu_, &abstol, &nfound_,
         W,
@@ -363,7 +364,7 @@ int64_t heevr(
     lapack::vector< double > rwork( lrwork_ );
     lapack::vector< lapack_int > iwork( liwork_ );
 
-    LAPACK_zheevr(
+    lapack_dispatch( LAPACK_zheevr, n )(
         &jobz_, &range_, &uplo_, &n_,
         (lapack_complex_double*) A, &lda_, &vl, &vu, &il_, &iu_, &abstol, &nfound_,
         W,
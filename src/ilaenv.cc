@@ -0,0 +1,182 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack/fortran.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cstring>
+#include <string>
+
+#ifdef LAPACK_ILAENV_OVERRIDE
+    #include <dlfcn.h>
+#endif
+
+namespace lapack {
+
+namespace {
+
+// Number of ilaenv calls intercepted by the override.
+std::atomic< int64_t > s_ilaenv_calls( 0 );
+
+}  // namespace
+
+namespace internal {
+
+// Defined in tuning.cc.
+bool has_block_sizes();
+
+}  // namespace internal
+
+//------------------------------------------------------------------------------
+/// @return true if LAPACK++ was built with its ilaenv override,
+/// so set_block_size can take effect.
+///
+bool ilaenv_override_enabled()
+{
+    #ifdef LAPACK_ILAENV_OVERRIDE
+        return true;
+    #else
+        return false;
+    #endif
+}
+
+//------------------------------------------------------------------------------
+/// @return number of LAPACK ilaenv calls intercepted by the override.
+/// If this doesn't increase when calling, e.g., getrf, the backend
+/// resolves ilaenv internally (e.g., MKL, or a static library linked
+/// with its own ilaenv) and set_block_size has no effect.
+///
+int64_t ilaenv_override_calls()
+{
+    return s_ilaenv_calls.load();
+}
+
+}  // namespace lapack
+
+#ifdef LAPACK_ILAENV_OVERRIDE
+
+#define LAPACK_ilaenv LAPACK_GLOBAL(ilaenv,ILAENV)
+#define LAPACK_iparmq LAPACK_GLOBAL(iparmq,IPARMQ)
+
+#define LAPACK_STR_( x ) #x
+#define LAPACK_STR( x ) LAPACK_STR_( x )
+
+// Hidden string lengths are size_t in gfortran >= 8. Unlike in fortran.h,
+// where passing unsigned is harmless, here they must be forwarded
+// to the backend's ilaenv intact.
+typedef lapack_int (*ilaenv_func)(
+    lapack_int const* ispec, char const* name, char const* opts,
+    lapack_int const* n1, lapack_int const* n2,
+    lapack_int const* n3, lapack_int const* n4,
+    size_t name_len, size_t opts_len );
+
+extern "C"
+lapack_int LAPACK_iparmq(
+    lapack_int const* ispec, char const* name, char const* opts,
+    lapack_int const* n, lapack_int const* ilo, lapack_int const* ihi,
+    lapack_int const* lwork,
+    size_t name_len, size_t opts_len );
+
+namespace {
+
+//------------------------------------------------------------------------------
+// Returns the backend's ilaenv, next in the dynamic linker's search order,
+// or null if there is none, e.g., when LAPACK is linked statically.
+ilaenv_func backend_ilaenv()
+{
+    static ilaenv_func func = reinterpret_cast< ilaenv_func >(
+        dlsym( RTLD_NEXT, LAPACK_STR( LAPACK_ilaenv ) ) );
+    return func;
+}
+
+//------------------------------------------------------------------------------
+// Approximates reference LAPACK's ilaenv, for when the backend's
+// ilaenv can't be found.
+lapack_int default_ilaenv(
+    lapack_int const* ispec, char const* name, char const* opts,
+    lapack_int const* n1, lapack_int const* n2,
+    lapack_int const* n3, lapack_int const* n4,
+    size_t name_len, size_t opts_len )
+{
+    // routine name suffix, e.g., TRF for getrf, TRD for sytrd
+    size_t len = name_len;
+    while (len > 0 && name[ len-1 ] == ' ')
+        --len;
+    char suffix[ 4 ] = "";
+    if (len >= 3) {
+        for (int i = 0; i < 3; ++i)
+            suffix[ i ] = char( std::toupper( name[ len - 3 + i ] ) );
+    }
+    bool is_trf = (std::strcmp( suffix, "TRF" ) == 0);
+    bool is_trd = (std::strcmp( suffix, "TRD" ) == 0);
+
+    switch (*ispec) {
+        case 1:  return (is_trf ? 64 : 32);   // nb
+        case 2:  return 2;                     // nbmin
+        case 3:  return (is_trd ? 32 : 128);  // nx
+        case 4:  return 6;                     // number of shifts (unused)
+        case 5:  return 2;                     // min column dimension (unused)
+        case 6:  return lapack_int( 1.6 * std::min( *n1, *n2 ) );  // svd crossover
+        case 7:  return 1;                     // number of processors
+        case 8:  return 50;                    // hseqr crossover
+        case 9:  return 25;                    // max subproblem size in D&C
+        case 10: return 1;                     // IEEE NaN arithmetic is safe
+        case 11: return 1;                     // IEEE infinity arithmetic is safe
+        case 12: case 13: case 14: case 15: case 16:
+            return LAPACK_iparmq( ispec, name, opts, n1, n2, n3, n4,
+                                  name_len, opts_len );
+        default: return 1;
+    }
+}
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+// Replaces LAPACK's ilaenv, returning block sizes (ispec = 1) and crossover
+// points (ispec = 3) set by lapack::set_block_size, and otherwise
+// forwarding to the backend's ilaenv. The problem size used to look up
+// block sizes is max( n1, n2 ), e.g., max( m, n ) for getrf and geqrf,
+// and n for potrf, sytrd, and gehrd.
+extern "C"
+lapack_int LAPACK_ilaenv(
+    lapack_int const* ispec, char const* name, char const* opts,
+    lapack_int const* n1, lapack_int const* n2,
+    lapack_int const* n3, lapack_int const* n4,
+    size_t name_len, size_t opts_len )
+{
+    ++lapack::s_ilaenv_calls;
+
+    if ((*ispec == 1 || *ispec == 3) && lapack::internal::has_block_sizes()) {
+        // Called from Fortran, so nothing may escape.
+        try {
+            // Fortran string isn't null terminated; trim trailing blanks
+            std::string routine( name, name_len );
+            size_t end = routine.find_last_not_of( ' ' );
+            routine.erase( end == std::string::npos ? 0 : end + 1 );
+
+            int64_t nx;
+            int64_t n = std::max( *n1, *n2 );
+            int64_t nb = lapack::get_block_size( routine, n, &nx );
+            if (*ispec == 1 && nb > 0)
+                return lapack_int( nb );
+            if (*ispec == 3 && nb > 0 && nx >= 0)
+                return lapack_int( nx );
+        }
+        catch (...) {
+            // fall through to backend
+        }
+    }
+
+    ilaenv_func func = backend_ilaenv();
+    if (func != nullptr)
+        return func( ispec, name, opts, n1, n2, n3, n4, name_len, opts_len );
+    return default_ilaenv( ispec, name, opts, n1, n2, n3, n4,
+                           name_len, opts_len );
+}
+
+#endif  // LAPACK_ILAENV_OVERRIDE
@@ -4,7 +4,7 @@
 // the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
 
 #include "lapack.hh"
-#include "lapack/fortran.h"
+#include "lapack/inline.hh"
 
 #include <vector>
 
@@ -21,27 +21,7 @@ void lacpy(
     float const* A, int64_t lda,
     float* B, int64_t ldb )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
-    }
-    char matrixtype_ = matrixtype2char( matrixtype );
-    lapack_int m_ = (lapack_int) m;
-    lapack_int n_ = (lapack_int) n;
-    lapack_int lda_ = (lapack_int) lda;
-    lapack_int ldb_ = (lapack_int) ldb;
-
-    LAPACK_slacpy(
-        &matrixtype_, &m_, &n_,
-        A, &lda_,
-        B, &ldb_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1
-        #endif
-    );
+    lapack::inlined::lacpy( matrixtype, m, n, A, lda, B, ldb );
 }
 
 // -----------------------------------------------------------------------------
@@ -51,27 +31,7 @@ void lacpy(
     double const* A, int64_t lda,
     double* B, int64_t ldb )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
-    }
-    char matrixtype_ = matrixtype2char( matrixtype );
-    lapack_int m_ = (lapack_int) m;
-    lapack_int n_ = (lapack_int) n;
-    lapack_int lda_ = (lapack_int) lda;
-    lapack_int ldb_ = (lapack_int) ldb;
-
-    LAPACK_dlacpy(
-        &matrixtype_, &m_, &n_,
-        A, &lda_,
-        B, &ldb_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1
-        #endif
-    );
+    lapack::inlined::lacpy( matrixtype, m, n, A, lda, B, ldb );
 }
 
 // -----------------------------------------------------------------------------
@@ -81,27 +41,7 @@ void lacpy(
     std::complex<float> const* A, int64_t lda,
     std::complex<float>* B, int64_t ldb )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
-    }
-    char matrixtype_ = matrixtype2char( matrixtype );
-    lapack_int m_ = (lapack_int) m;
-    lapack_int n_ = (lapack_int) n;
-    lapack_int lda_ = (lapack_int) lda;
-    lapack_int ldb_ = (lapack_int) ldb;
-
-    LAPACK_clacpy(
-        &matrixtype_, &m_, &n_,
-        (lapack_complex_float*) A, &lda_,
-        (lapack_complex_float*) B, &ldb_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1
-        #endif
-    );
+    lapack::inlined::lacpy( matrixtype, m, n, A, lda, B, ldb );
 }
 
 // -----------------------------------------------------------------------------
@@ -145,27 +85,7 @@ void lacpy(
     std::complex<double> const* A, int64_t lda,
     std::complex<double>* B, int64_t ldb )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
-    }
-    char matrixtype_ = matrixtype2char( matrixtype );
-    lapack_int m_ = (lapack_int) m;
-    lapack_int n_ = (lapack_int) n;
-    lapack_int lda_ = (lapack_int) lda;
-    lapack_int ldb_ = (lapack_int) ldb;
-
-    LAPACK_zlacpy(
-        &matrixtype_, &m_, &n_,
-        (lapack_complex_double*) A, &lda_,
-        (lapack_complex_double*) B, &ldb_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1
-        #endif
-    );
+    lapack::inlined::lacpy( matrixtype, m, n, A, lda, B, ldb );
 }
 
 }  // namespace lapack
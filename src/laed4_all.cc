@@ -0,0 +1,309 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack/update.hh"
+#include "NoConstructAllocator.hh"
+
+#include <cmath>
+#include <limits>
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+
+namespace {
+
+//------------------------------------------------------------------------------
+// Sums of z(j)^2 / delta(j) and z(j)^2 / delta(j)^2, with
+// delta(j) = (d(j) - org) - tau, over j in [ begin, end ).
+template <typename real_t>
+inline void secular_sums(
+    int64_t begin, int64_t end,
+    real_t const* d, real_t const* z2, real_t org, real_t tau,
+    real_t* sum, real_t* dsum )
+{
+    real_t s = 0, ds = 0;
+    #ifdef _OPENMP
+    #pragma omp simd reduction(+:s, ds)
+    #endif
+    for (int64_t j = begin; j < end; ++j) {
+        real_t inv = 1 / ((d[ j ] - org) - tau);
+        real_t t = z2[ j ] * inv;
+        s  += t;
+        ds += t * inv;
+    }
+    *sum = s;
+    *dsum = ds;
+}
+
+//------------------------------------------------------------------------------
+// Finds root i (0-based) of the secular equation
+//     f(lambda) = 1/rho + sum_j z(j)^2 / (d(j) - lambda) = 0,
+// as lambda = org + tau, where org is the pole nearest the root, so that
+// d(j) - lambda = (d(j) - org) - tau is accurate. z2 = z^2.
+// Returns 0, or 1 if the iteration failed to converge.
+template <typename real_t>
+int64_t secular_root(
+    int64_t n, int64_t i,
+    real_t const* d, real_t const* z2, real_t rho, real_t z2sum,
+    real_t* org_out, real_t* tau_out )
+{
+    const real_t eps = std::numeric_limits< real_t >::epsilon();
+    const int maxit = 60;
+    const real_t rhoinv = 1 / rho;
+
+    // Poles bracketing the root are ip (left) and ip + 1 (right);
+    // for the last root, both are to its left.
+    bool last = (i == n - 1);
+    int64_t ip = (last ? n - 2 : i);
+    int64_t ip1 = ip + 1;
+
+    real_t org, tau, lb, ub;
+    bool orgati;  // origin at left pole ip, else at right pole ip1
+    if (last) {
+        // d(n-1) < lambda <= d(n-1) + rho z^T z
+        orgati = false;
+        org = d[ ip1 ];
+        lb = 0;
+        ub = rho * z2sum;
+        tau = ub / 2;
+    }
+    else {
+        // Evaluate f at the midpoint of the interval to choose the origin.
+        real_t del = d[ ip1 ] - d[ ip ];
+        real_t mid = del / 2;
+        real_t psi, dpsi, phi, dphi;
+        secular_sums( 0, ip1, d, z2, d[ ip ], mid, &psi, &dpsi );
+        secular_sums( ip1, n, d, z2, d[ ip ], mid, &phi, &dphi );
+        real_t w = rhoinv + psi + phi;
+        orgati = (w >= 0);
+        if (orgati) {
+            org = d[ ip ];
+            lb = 0;
+            ub = mid;
+            tau = mid;
+        }
+        else {
+            org = d[ ip1 ];
+            lb = -mid;
+            ub = 0;
+            tau = -mid;
+        }
+    }
+
+    bool converged = false;
+    for (int iter = 0; iter < maxit; ++iter) {
+        // psi sums poles left of the root, phi the rest: poles right of it,
+        // or for the last root, pole n-1.
+        real_t psi, dpsi, phi, dphi;
+        secular_sums( 0, ip1, d, z2, org, tau, &psi, &dpsi );
+        secular_sums( ip1, n, d, z2, org, tau, &phi, &dphi );
+        real_t w = rhoinv + psi + phi;
+        real_t dw = dpsi + dphi;
+
+        // Converged when |f| is within its rounding error, as in laed4.
+        real_t erretm = 8*(std::abs( phi ) - psi) + 2*rhoinv
+                      + std::abs( tau )*dw;
+        if (std::abs( w ) <= eps * erretm || dw == 0) {
+            converged = true;
+            break;
+        }
+
+        // f is increasing, so w shrinks the bracket.
+        if (w <= 0)
+            lb = max( lb, tau );
+        else
+            ub = min( ub, tau );
+
+        // Model f(tau + eta) with two poles, as in laed4's fixed weight
+        // method, and take its root nearest tau.
+        real_t dlt_i   = (d[ ip  ] - org) - tau;
+        real_t dlt_ip1 = (d[ ip1 ] - org) - tau;
+        real_t a, b, c, eta;
+        if (last) {
+            c = w - dlt_i*dpsi - dlt_ip1*dphi;
+            a = (dlt_i + dlt_ip1)*w - dlt_i*dlt_ip1*dw;
+            b = dlt_i*dlt_ip1*w;
+            real_t disc = std::sqrt( std::abs( a*a - 4*b*c ) );
+            if (a >= 0)
+                eta = (c != 0 ? (a + disc) / (2*c) : 0);
+            else
+                eta = 2*b / (a - disc);
+        }
+        else {
+            if (orgati) {
+                real_t t = z2[ ip ] / (dlt_i*dlt_i);
+                c = w - dlt_ip1*dw - (d[ ip ] - d[ ip1 ])*t;
+            }
+            else {
+                real_t t = z2[ ip1 ] / (dlt_ip1*dlt_ip1);
+                c = w - dlt_i*dw - (d[ ip1 ] - d[ ip ])*t;
+            }
+            a = (dlt_i + dlt_ip1)*w - dlt_i*dlt_ip1*dw;
+            b = dlt_i*dlt_ip1*w;
+            real_t disc = std::sqrt( std::abs( a*a - 4*b*c ) );
+            if (c == 0)
+                eta = b / a;
+            else if (a <= 0)
+                eta = (a - disc) / (2*c);
+            else
+                eta = 2*b / (a + disc);
+        }
+
+        // Fall back to Newton if the model step goes the wrong way,
+        // and to bisection if it leaves the bracket.
+        if (w*eta >= 0 || ! std::isfinite( eta ))
+            eta = -w / dw;
+        real_t tau_new = tau + eta;
+        if (tau_new <= lb || tau_new >= ub)
+            tau_new = (eta < 0 ? (lb + tau) / 2 : (ub + tau) / 2);
+        if (tau_new == tau) {
+            // no further progress possible in floating point
+            converged = true;
+            break;
+        }
+        tau = tau_new;
+    }
+    *org_out = org;
+    *tau_out = tau;
+    return (converged ? 0 : 1);
+}
+
+//------------------------------------------------------------------------------
+template <typename real_t>
+int64_t laed4_all_impl(
+    int64_t n,
+    real_t const* d,
+    real_t const* z,
+    real_t* delta, int64_t lddelta,
+    real_t rho,
+    real_t* lambda )
+{
+    lapack_error_if( n < 0 );
+    lapack_error_if( delta != nullptr && lddelta < max( 1, n ) );
+    lapack_error_if( ! (rho > 0) );
+
+    if (n == 0)
+        return 0;
+
+    lapack::vector< real_t > z2( n );
+    real_t z2sum = 0;
+    for (int64_t j = 0; j < n; ++j) {
+        z2[ j ] = z[ j ] * z[ j ];
+        z2sum += z2[ j ];
+    }
+
+    if (n == 1) {
+        lambda[ 0 ] = d[ 0 ] + rho * z2[ 0 ];
+        if (delta != nullptr)
+            delta[ 0 ] = -rho * z2[ 0 ];
+        return 0;
+    }
+
+    // Roots are independent; each thread takes a range of them.
+    int64_t first_fail = n;
+    #ifdef _OPENMP
+    #pragma omp parallel for schedule( dynamic, 16 ) \
+        reduction( min:first_fail ) if (n >= 128)
+    #endif
+    for (int64_t i = 0; i < n; ++i) {
+        real_t org, tau;
+        int64_t info = secular_root( n, i, d, &z2[0], rho, z2sum, &org, &tau );
+        if (info != 0)
+            first_fail = min( first_fail, i );
+        lambda[ i ] = org + tau;
+        if (delta != nullptr) {
+            real_t* delta_i = &delta[ i*lddelta ];
+            #ifdef _OPENMP
+            #pragma omp simd
+            #endif
+            for (int64_t j = 0; j < n; ++j)
+                delta_i[ j ] = (d[ j ] - org) - tau;
+        }
+    }
+    return (first_fail < n ? first_fail + 1 : 0);
+}
+
+}  // namespace
+
+// -----------------------------------------------------------------------------
+/// Computes all n updated eigenvalues of a symmetric rank-one modification
+/// to a diagonal matrix,
+/// \[
+///     diag( d ) + \rho z z^T,
+/// \]
+/// where d(i) < d(j) for i < j and rho > 0, as n calls to laed4 would,
+/// but natively: roots are found in parallel using OpenMP threads, if
+/// available, and the sums over the poles use SIMD instructions.
+/// Unlike laed4, z need not have unit norm.
+///
+/// Each root is found relative to its nearest pole by laed4's fixed weight
+/// rational interpolation, safeguarded by bisection, and stops by laed4's
+/// criterion, when f(lambda) is within its rounding error. Hence
+/// d(j) - lambda(i) is accurate to high relative accuracy, as needed to
+/// compute orthogonal eigenvectors as in laed3.
+///
+/// Overloaded versions are available for
+/// `float`, `double`.
+///
+/// @param[in] n
+///     The length of all arrays. n >= 0.
+///
+/// @param[in] d
+///     The vector d of length n.
+///     The original eigenvalues, in strictly increasing order.
+///
+/// @param[in] z
+///     The vector z of length n.
+///     The components of the updating vector.
+///
+/// @param[out] delta
+///     The n-by-n matrix delta, stored in an lddelta-by-n array.
+///     On exit, delta(j, i) = d(j) - lambda(i). Unlike laed4, this holds
+///     for n = 1 and n = 2 as well. May be nullptr to compute only lambda.
+///
+/// @param[in] lddelta
+///     The leading dimension of the array delta.
+///     If delta is not nullptr, lddelta >= max(1,n).
+///
+/// @param[in] rho
+///     The scalar in the symmetric updating formula. rho > 0.
+///
+/// @param[out] lambda
+///     The vector lambda of length n.
+///     The updated eigenvalues, in increasing order.
+///
+/// @return = 0: successful exit
+/// @return > 0: if return value = i, the iteration failed to converge for
+///              the i-th root (1-based), and possibly others after it.
+///
+/// @see laed4
+/// @ingroup heev_auxiliary
+int64_t laed4_all(
+    int64_t n,
+    float const* d,
+    float const* z,
+    float* delta, int64_t lddelta,
+    float rho,
+    float* lambda )
+{
+    return laed4_all_impl( n, d, z, delta, lddelta, rho, lambda );
+}
+
+/// @ingroup heev_auxiliary
+int64_t laed4_all(
+    int64_t n,
+    double const* d,
+    double const* z,
+    double* delta, int64_t lddelta,
+    double rho,
+    double* lambda )
+{
+    return laed4_all_impl( n, d, z, delta, lddelta, rho, lambda );
+}
+
+}  // namespace lapack
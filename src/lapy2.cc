@@ -4,7 +4,7 @@
 // the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
 
 #include "lapack.hh"
-#include "lapack/fortran.h"
+#include "lapack/inline.hh"
 
 #include <vector>
 
@@ -19,7 +19,7 @@ using blas::real;
 float lapy2(
     float x, float y )
 {
-    return LAPACK_slapy2( &x, &y );
+    return lapack::inlined::lapy2( x, y );
 }
 
 // -----------------------------------------------------------------------------
@@ -38,7 +38,7 @@ float lapy2(
 double lapy2(
     double x, double y )
 {
-    return LAPACK_dlapy2( &x, &y );
+    return lapack::inlined::lapy2( x, y );
 }
 
 }  // namespace lapack
@@ -4,7 +4,7 @@
 // the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
 
 #include "lapack.hh"
-#include "lapack/fortran.h"
+#include "lapack/inline.hh"
 
 #include <vector>
 
@@ -19,7 +19,7 @@ using blas::real;
 float lapy3(
     float x, float y, float z )
 {
-    return LAPACK_slapy3( &x, &y, &z );
+    return lapack::inlined::lapy3( x, y, z );
 }
 
 // -----------------------------------------------------------------------------
@@ -40,7 +40,7 @@ float lapy3(
 double lapy3(
     double x, double y, double z )
 {
-    return LAPACK_dlapy3( &x, &y, &z );
+    return lapack::inlined::lapy3( x, y, z );
 }
 
 }  // namespace lapack
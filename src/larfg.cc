@@ -4,7 +4,7 @@
 // the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
 
 #include "lapack.hh"
-#include "lapack/fortran.h"
+#include "lapack/inline.hh"
 
 #include <vector>
 
@@ -22,17 +22,7 @@ void larfg(
     float* X, int64_t incx,
     float* tau )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(incx) > std::numeric_limits<lapack_int>::max() );
-    }
-    lapack_int n_ = (lapack_int) n;
-    lapack_int incx_ = (lapack_int) incx;
-
-    LAPACK_slarfg(
-        &n_, alpha,
-        X, &incx_, tau );
+    lapack::inlined::larfg( n, alpha, X, incx, tau );
 }
 
 // -----------------------------------------------------------------------------
@@ -43,17 +33,7 @@ void larfg(
     double* X, int64_t incx,
     double* tau )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(incx) > std::numeric_limits<lapack_int>::max() );
-    }
-    lapack_int n_ = (lapack_int) n;
-    lapack_int incx_ = (lapack_int) incx;
-
-    LAPACK_dlarfg(
-        &n_, alpha,
-        X, &incx_, tau );
+    lapack::inlined::larfg( n, alpha, X, incx, tau );
 }
 
 // -----------------------------------------------------------------------------
@@ -64,17 +44,7 @@ void larfg(
     std::complex<float>* X, int64_t incx,
     std::complex<float>* tau )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(incx) > std::numeric_limits<lapack_int>::max() );
-    }
-    lapack_int n_ = (lapack_int) n;
-    lapack_int incx_ = (lapack_int) incx;
-
-    LAPACK_clarfg(
-        &n_, (lapack_complex_float*) alpha,
-        (lapack_complex_float*) X, &incx_, (lapack_complex_float*) tau );
+    lapack::inlined::larfg( n, alpha, X, incx, tau );
 }
 
 // -----------------------------------------------------------------------------
@@ -141,17 +111,7 @@ void larfg(
     std::complex<double>* X, int64_t incx,
     std::complex<double>* tau )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(incx) > std::numeric_limits<lapack_int>::max() );
-    }
-    lapack_int n_ = (lapack_int) n;
-    lapack_int incx_ = (lapack_int) incx;
-
-    LAPACK_zlarfg(
-        &n_, (lapack_complex_double*) alpha,
-        (lapack_complex_double*) X, &incx_, (lapack_complex_double*) tau );
+    lapack::inlined::larfg( n, alpha, X, incx, tau );
 }
 
 }  // namespace lapack
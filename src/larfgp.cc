@@ -4,7 +4,7 @@
 // the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
 
 #include "lapack.hh"
-#include "lapack/fortran.h"
+#include "lapack/inline.hh"
 
 #if LAPACK_VERSION >= 30202  // >= 3.2.2
 
@@ -24,17 +24,7 @@ void larfgp(
     float* X, int64_t incx,
     float* tau )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(incx) > std::numeric_limits<lapack_int>::max() );
-    }
-    lapack_int n_ = (lapack_int) n;
-    lapack_int incx_ = (lapack_int) incx;
-
-    LAPACK_slarfgp(
-        &n_, alpha,
-        X, &incx_, tau );
+    lapack::inlined::larfgp( n, alpha, X, incx, tau );
 }
 
 // -----------------------------------------------------------------------------
@@ -45,17 +35,7 @@ void larfgp(
     double* X, int64_t incx,
     double* tau )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(incx) > std::numeric_limits<lapack_int>::max() );
-    }
-    lapack_int n_ = (lapack_int) n;
-    lapack_int incx_ = (lapack_int) incx;
-
-    LAPACK_dlarfgp(
-        &n_, alpha,
-        X, &incx_, tau );
+    lapack::inlined::larfgp( n, alpha, X, incx, tau );
 }
 
 // -----------------------------------------------------------------------------
@@ -66,17 +46,7 @@ void larfgp(
     std::complex<float>* X, int64_t incx,
     std::complex<float>* tau )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(incx) > std::numeric_limits<lapack_int>::max() );
-    }
-    lapack_int n_ = (lapack_int) n;
-    lapack_int incx_ = (lapack_int) incx;
-
-    LAPACK_clarfgp(
-        &n_, (lapack_complex_float*) alpha,
-        (lapack_complex_float*) X, &incx_, (lapack_complex_float*) tau );
+    lapack::inlined::larfgp( n, alpha, X, incx, tau );
 }
 
 // -----------------------------------------------------------------------------
@@ -143,17 +113,7 @@ void larfgp(
     std::complex<double>* X, int64_t incx,
     std::complex<double>* tau )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(incx) > std::numeric_limits<lapack_int>::max() );
-    }
-    lapack_int n_ = (lapack_int) n;
-    lapack_int incx_ = (lapack_int) incx;
-
-    LAPACK_zlarfgp(
-        &n_, (lapack_complex_double*) alpha,
-        (lapack_complex_double*) X, &incx_, (lapack_complex_double*) tau );
+    lapack::inlined::larfgp( n, alpha, X, incx, tau );
 }
 
 }  // namespace lapack
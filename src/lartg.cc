@@ -3,7 +3,7 @@
 // This program is free software: you can redistribute it and/or modify it under
 // the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
 
-#include "lapack/fortran.h"
+#include "lapack/inline.hh"
 
 namespace lapack {
 
@@ -14,9 +14,7 @@ void lartg(
     float* sn,
     float* r )
 {
-
-    LAPACK_slartg(
-        &f, &g, cs, sn, r );
+    lapack::inlined::lartg( f, g, cs, sn, r );
 }
 
 // -----------------------------------------------------------------------------
@@ -26,9 +24,7 @@ void lartg(
     double* sn,
     double* r )
 {
-
-    LAPACK_dlartg(
-        &f, &g, cs, sn, r );
+    lapack::inlined::lartg( f, g, cs, sn, r );
 }
 
 // -----------------------------------------------------------------------------
@@ -38,13 +34,7 @@ void lartg(
     std::complex<float>* sn,
     std::complex<float>* r )
 {
-
-    LAPACK_clartg(
-        (lapack_complex_float*) &f,
-        (lapack_complex_float*) &g,
-        cs,
-        (lapack_complex_float*) sn,
-        (lapack_complex_float*) r );
+    lapack::inlined::lartg( f, g, cs, sn, r );
 }
 
 // -----------------------------------------------------------------------------
@@ -54,13 +44,7 @@ void lartg(
     std::complex<double>* sn,
     std::complex<double>* r )
 {
-
-    LAPACK_zlartg(
-        (lapack_complex_double*) &f,
-        (lapack_complex_double*) &g,
-        cs,
-        (lapack_complex_double*) sn,
-        (lapack_complex_double*) r );
+    lapack::inlined::lartg( f, g, cs, sn, r );
 }
 
 }  // namespace lapack
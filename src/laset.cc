@@ -4,7 +4,7 @@
 // the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
 
 #include "lapack.hh"
-#include "lapack/fortran.h"
+#include "lapack/inline.hh"
 
 #include <vector>
 
@@ -20,24 +20,7 @@ void laset(
     lapack::MatrixType matrixtype, int64_t m, int64_t n, float offdiag, float diag,
     float* A, int64_t lda )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
-    }
-    char matrixtype_ = matrixtype2char( matrixtype );
-    lapack_int m_ = (lapack_int) m;
-    lapack_int n_ = (lapack_int) n;
-    lapack_int lda_ = (lapack_int) lda;
-
-    LAPACK_slaset(
-        &matrixtype_, &m_, &n_, &offdiag, &diag,
-        A, &lda_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1
-        #endif
-    );
+    lapack::inlined::laset( matrixtype, m, n, offdiag, diag, A, lda );
 }
 
 // -----------------------------------------------------------------------------
@@ -46,24 +29,7 @@ void laset(
     lapack::MatrixType matrixtype, int64_t m, int64_t n, double offdiag, double diag,
     double* A, int64_t lda )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
-    }
-    char matrixtype_ = matrixtype2char( matrixtype );
-    lapack_int m_ = (lapack_int) m;
-    lapack_int n_ = (lapack_int) n;
-    lapack_int lda_ = (lapack_int) lda;
-
-    LAPACK_dlaset(
-        &matrixtype_, &m_, &n_, &offdiag, &diag,
-        A, &lda_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1
-        #endif
-    );
+    lapack::inlined::laset( matrixtype, m, n, offdiag, diag, A, lda );
 }
 
 // -----------------------------------------------------------------------------
@@ -72,24 +38,7 @@ void laset(
     lapack::MatrixType matrixtype, int64_t m, int64_t n, std::complex<float> offdiag, std::complex<float> diag,
     std::complex<float>* A, int64_t lda )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
-    }
-    char matrixtype_ = matrixtype2char( matrixtype );
-    lapack_int m_ = (lapack_int) m;
-    lapack_int n_ = (lapack_int) n;
-    lapack_int lda_ = (lapack_int) lda;
-
-    LAPACK_claset(
-        &matrixtype_, &m_, &n_, (lapack_complex_float*) &offdiag, (lapack_complex_float*) &diag,
-        (lapack_complex_float*) A, &lda_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1
-        #endif
-    );
+    lapack::inlined::laset( matrixtype, m, n, offdiag, diag, A, lda );
 }
 
 // -----------------------------------------------------------------------------
@@ -137,24 +86,7 @@ void laset(
     lapack::MatrixType matrixtype, int64_t m, int64_t n, std::complex<double> offdiag, std::complex<double> diag,
     std::complex<double>* A, int64_t lda )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
-    }
-    char matrixtype_ = matrixtype2char( matrixtype );
-    lapack_int m_ = (lapack_int) m;
-    lapack_int n_ = (lapack_int) n;
-    lapack_int lda_ = (lapack_int) lda;
-
-    LAPACK_zlaset(
-        &matrixtype_, &m_, &n_, (lapack_complex_double*) &offdiag, (lapack_complex_double*) &diag,
-        (lapack_complex_double*) A, &lda_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1
-        #endif
-    );
+    lapack::inlined::laset( matrixtype, m, n, offdiag, diag, A, lda );
 }
 
 }  // namespace lapack
@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "dispatch.hh"
 
 #include <vector>
 
@@ -36,7 +37,7 @@ int64_t posv(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
-    LAPACK_sposv(
+    lapack_dispatch( LAPACK_sposv, n )(
         &uplo_, &n_, &nrhs_,
         A, &lda_,
         B, &ldb_, &info_
@@ -71,7 +72,7 @@ int64_t posv(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
-    LAPACK_dposv(
+    lapack_dispatch( LAPACK_dposv, n )(
         &uplo_, &n_, &nrhs_,
         A, &lda_,
         B, &ldb_, &info_
@@ -106,7 +107,7 @@ int64_t posv(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
-    LAPACK_cposv(
+    lapack_dispatch( LAPACK_cposv, n )(
         &uplo_, &n_, &nrhs_,
         (lapack_complex_float*) A, &lda_,
         (lapack_complex_float*) B, &ldb_, &info_
@@ -200,7 +201,7 @@ int64_t posv(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
-    LAPACK_zposv(
+    lapack_dispatch( LAPACK_zposv, n )(
         &uplo_, &n_, &nrhs_,
         (lapack_complex_double*) A, &lda_,
         (lapack_complex_double*) B, &ldb_, &info_
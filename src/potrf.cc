@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "dispatch.hh"
 
 #include <vector>
 
@@ -30,7 +31,7 @@ int64_t potrf(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
-    LAPACK_spotrf(
+    lapack_dispatch( LAPACK_spotrf, n )(
         &uplo_, &n_,
         A, &lda_, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
@@ -59,7 +60,7 @@ int64_t potrf(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
-    LAPACK_dpotrf(
+    lapack_dispatch( LAPACK_dpotrf, n )(
         &uplo_, &n_,
         A, &lda_, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
@@ -88,7 +89,7 @@ int64_t potrf(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
-    LAPACK_cpotrf(
+    lapack_dispatch( LAPACK_cpotrf, n )(
         &uplo_, &n_,
         (lapack_complex_float*) A, &lda_, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
@@ -162,7 +163,7 @@ int64_t potrf(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
-    LAPACK_zpotrf(
+    lapack_dispatch( LAPACK_zpotrf, n )(
         &uplo_, &n_,
         (lapack_complex_double*) A, &lda_, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
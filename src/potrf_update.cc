@@ -0,0 +1,261 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack/update.hh"
+
+#include <cmath>
+
+namespace lapack {
+
+using blas::max;
+using blas::real;
+using blas::conj;
+
+namespace {
+
+//------------------------------------------------------------------------------
+// Updates (downdate = false) or downdates (downdate = true) the Cholesky
+// factor in A by the k columns of X, one column of L at a time.
+// For each column j of L, the k rotations that zero row j of X are applied
+// to column j of L and to each column of X while column j is in cache.
+//
+// With uplo = Upper, A = U^H U = L L^H for L = U^H, so column j of L is the
+// conjugate of row j of U. Rotating rows of U against conj( X ) takes the
+// same form, so X is conjugated and the same loop is run with the strides
+// of a row of U.
+template <typename scalar_t>
+int64_t potrf_update_impl(
+    bool downdate,
+    Uplo uplo, int64_t n, int64_t k,
+    scalar_t* A, int64_t lda,
+    scalar_t* X, int64_t ldx )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    lapack_error_if( uplo != Uplo::Lower && uplo != Uplo::Upper );
+    lapack_error_if( n < 0 );
+    lapack_error_if( k < 0 );
+    lapack_error_if( lda < max( 1, n ) );
+    lapack_error_if( ldx < max( 1, n ) );
+
+    // stride down a column of L, and between columns of L
+    int64_t inc = (uplo == Uplo::Lower ? 1 : lda);
+    int64_t ld  = (uplo == Uplo::Lower ? lda : 1);
+
+    if (uplo == Uplo::Upper) {
+        for (int64_t p = 0; p < k; ++p)
+            for (int64_t i = 0; i < n; ++i)
+                X[ i + p*ldx ] = conj( X[ i + p*ldx ] );
+    }
+
+    for (int64_t j = 0; j < n; ++j) {
+        scalar_t* Lj = &A[ j*inc + j*ld ];  // L(j, j), then down column j
+        real_t d = real( Lj[ 0 ] );
+        for (int64_t p = 0; p < k; ++p) {
+            scalar_t* x = &X[ p*ldx ];
+            real_t a = std::abs( x[ j ] );
+            if (a == 0)
+                continue;
+
+            // rotation [ c, -s; conj(s), c ] (update) or
+            // hyperbolic rotation [ c, -s; -conj(s), c ] (downdate)
+            // zeroing x(j) against d = L(j, j)
+            real_t r;
+            if (downdate) {
+                // A - x x^H must stay positive definite; also catches NaN
+                if (! (a < d)) {
+                    Lj[ 0 ] = d;
+                    return j + 1;
+                }
+                r = std::sqrt( (d - a) * (d + a) );
+            }
+            else {
+                r = std::hypot( d, a );
+            }
+            real_t   c = d / r;
+            scalar_t s = x[ j ] / r;
+            d = r;
+            x[ j ] = 0;
+
+            if (downdate) {
+                // mixed form, more stable than applying the hyperbolic
+                // rotation directly: new x uses the new L
+                for (int64_t i = j + 1; i < n; ++i) {
+                    scalar_t& l = Lj[ (i - j)*inc ];
+                    l = c*l - conj( s )*x[ i ];
+                    x[ i ] = (x[ i ] - s*l) / c;
+                }
+            }
+            else {
+                for (int64_t i = j + 1; i < n; ++i) {
+                    scalar_t& l = Lj[ (i - j)*inc ];
+                    scalar_t tmp = c*l + conj( s )*x[ i ];
+                    x[ i ] = c*x[ i ] - s*l;
+                    l = tmp;
+                }
+            }
+        }
+        Lj[ 0 ] = d;
+    }
+    return 0;
+}
+
+}  // namespace
+
+// -----------------------------------------------------------------------------
+/// Updates the Cholesky factorization of a Hermitian positive definite
+/// matrix A, as computed by potrf, to that of $A + X X^H$, where X is
+/// n-by-k. This takes O(k n^2) operations using Givens rotations, instead of
+/// the O(n^3) to refactor. Since $A + X X^H$ is positive definite whenever
+/// A is, the update cannot fail.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] uplo
+///     - lapack::Uplo::Upper: A holds U from $A = U^H U$;
+///     - lapack::Uplo::Lower: A holds L from $A = L L^H$.
+///
+/// @param[in] n
+///     The order of the matrix A. n >= 0.
+///
+/// @param[in] k
+///     The number of columns of X, i.e., the rank of the update. k >= 0.
+///
+/// @param[in,out] A
+///     The n-by-n matrix A, stored in an lda-by-n array.
+///     On entry, the factor U or L from potrf, in the uplo triangle.
+///     On exit, the factor of $A + X X^H$.
+///     The other triangle is not referenced.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,n).
+///
+/// @param[in,out] X
+///     The n-by-k matrix X, stored in an ldx-by-k array.
+///     On exit, X is destroyed.
+///
+/// @param[in] ldx
+///     The leading dimension of the array X. ldx >= max(1,n).
+///
+/// @return = 0: successful exit
+///
+/// @see potrf_downdate
+/// @ingroup posv_computational
+int64_t potrf_update(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    float* A, int64_t lda,
+    float* X, int64_t ldx )
+{
+    return potrf_update_impl( false, uplo, n, k, A, lda, X, ldx );
+}
+
+/// @ingroup posv_computational
+int64_t potrf_update(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    double* A, int64_t lda,
+    double* X, int64_t ldx )
+{
+    return potrf_update_impl( false, uplo, n, k, A, lda, X, ldx );
+}
+
+/// @ingroup posv_computational
+int64_t potrf_update(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* X, int64_t ldx )
+{
+    return potrf_update_impl( false, uplo, n, k, A, lda, X, ldx );
+}
+
+/// @ingroup posv_computational
+int64_t potrf_update(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* X, int64_t ldx )
+{
+    return potrf_update_impl( false, uplo, n, k, A, lda, X, ldx );
+}
+
+// -----------------------------------------------------------------------------
+/// Downdates the Cholesky factorization of a Hermitian positive definite
+/// matrix A, as computed by potrf, to that of $A - X X^H$, where X is
+/// n-by-k. This takes O(k n^2) operations using hyperbolic rotations,
+/// applied in mixed form for stability, instead of the O(n^3) to refactor.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] uplo
+///     - lapack::Uplo::Upper: A holds U from $A = U^H U$;
+///     - lapack::Uplo::Lower: A holds L from $A = L L^H$.
+///
+/// @param[in] n
+///     The order of the matrix A. n >= 0.
+///
+/// @param[in] k
+///     The number of columns of X, i.e., the rank of the downdate. k >= 0.
+///
+/// @param[in,out] A
+///     The n-by-n matrix A, stored in an lda-by-n array.
+///     On entry, the factor U or L from potrf, in the uplo triangle.
+///     On successful exit, the factor of $A - X X^H$.
+///     If the downdate fails, A is partially modified and should be
+///     refactored. The other triangle is not referenced.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,n).
+///
+/// @param[in,out] X
+///     The n-by-k matrix X, stored in an ldx-by-k array.
+///     On exit, X is destroyed.
+///
+/// @param[in] ldx
+///     The leading dimension of the array X. ldx >= max(1,n).
+///
+/// @return = 0: successful exit
+/// @return > 0: if return value = i, the leading minor of order i of
+///              $A - X X^H$ is not positive definite (numerically), and
+///              the downdate could not be completed.
+///
+/// @see potrf_update
+/// @ingroup posv_computational
+int64_t potrf_downdate(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    float* A, int64_t lda,
+    float* X, int64_t ldx )
+{
+    return potrf_update_impl( true, uplo, n, k, A, lda, X, ldx );
+}
+
+/// @ingroup posv_computational
+int64_t potrf_downdate(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    double* A, int64_t lda,
+    double* X, int64_t ldx )
+{
+    return potrf_update_impl( true, uplo, n, k, A, lda, X, ldx );
+}
+
+/// @ingroup posv_computational
+int64_t potrf_downdate(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* X, int64_t ldx )
+{
+    return potrf_update_impl( true, uplo, n, k, A, lda, X, ldx );
+}
+
+/// @ingroup posv_computational
+int64_t potrf_downdate(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* X, int64_t ldx )
+{
+    return potrf_update_impl( true, uplo, n, k, A, lda, X, ldx );
+}
+
+}  // namespace lapack
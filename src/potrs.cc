@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "dispatch.hh"
 
 #include <vector>
 
@@ -35,7 +36,7 @@ int64_t potrs(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
-    LAPACK_spotrs(
+    lapack_dispatch( LAPACK_spotrs, n )(
         &uplo_, &n_, &nrhs_,
         A, &lda_,
         B, &ldb_, &info_
@@ -70,7 +71,7 @@ int64_t potrs(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
-    LAPACK_dpotrs(
+    lapack_dispatch( LAPACK_dpotrs, n )(
         &uplo_, &n_, &nrhs_,
         A, &lda_,
         B, &ldb_, &info_
@@ -105,7 +106,7 @@ int64_t potrs(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
-    LAPACK_cpotrs(
+    lapack_dispatch( LAPACK_cpotrs, n )(
         &uplo_, &n_, &nrhs_,
         (lapack_complex_float*) A, &lda_,
         (lapack_complex_float*) B, &ldb_, &info_
@@ -176,7 +177,7 @@ int64_t potrs(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
-    LAPACK_zpotrs(
+    lapack_dispatch( LAPACK_zpotrs, n )(
         &uplo_, &n_, &nrhs_,
         (lapack_complex_double*) A, &lda_,
         (lapack_complex_double*) B, &ldb_, &info_
@@ -0,0 +1,623 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack/update.hh"
+#include "NoConstructAllocator.hh"
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+using blas::conj;
+
+namespace {
+
+//------------------------------------------------------------------------------
+// Applies G = [ c, s; -conj(s), c ] to rows k and k+1 of R, in columns
+// k0, ..., n-1, and G^H to columns k and k+1 of the m-by-m Q,
+// so the product Q R is unchanged.
+template <typename scalar_t>
+void rotate(
+    int64_t m, int64_t n, int64_t k, int64_t k0,
+    scalar_t* Q, int64_t ldq,
+    scalar_t* R, int64_t ldr,
+    blas::real_type<scalar_t> c, scalar_t s )
+{
+    if (k0 < n) {
+        blas::rot( n - k0, &R[ k + k0*ldr ], ldr, &R[ k+1 + k0*ldr ], ldr,
+                   c, s );
+    }
+    blas::rot( m, &Q[ k*ldq ], 1, &Q[ (k+1)*ldq ], 1, c, conj( s ) );
+}
+
+//------------------------------------------------------------------------------
+// Reduces the upper Hessenberg R, with subdiagonal entries in
+// columns k1, ..., k2-1, to upper triangular, updating Q.
+template <typename scalar_t>
+void hessenberg_to_triangular(
+    int64_t m, int64_t n, int64_t k1, int64_t k2,
+    scalar_t* Q, int64_t ldq,
+    scalar_t* R, int64_t ldr )
+{
+    blas::real_type<scalar_t> c;
+    scalar_t s, r;
+    for (int64_t k = k1; k < k2; ++k) {
+        lartg( R[ k + k*ldr ], R[ k+1 + k*ldr ], &c, &s, &r );
+        R[ k   + k*ldr ] = r;
+        R[ k+1 + k*ldr ] = 0;
+        rotate( m, n, k, k+1, Q, ldq, R, ldr, c, s );
+    }
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+void qr_update_impl(
+    int64_t m, int64_t n,
+    scalar_t* Q, int64_t ldq,
+    scalar_t* R, int64_t ldr,
+    scalar_t const* u, scalar_t const* v )
+{
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 );
+    lapack_error_if( ldq < max( 1, m ) );
+    lapack_error_if( ldr < max( 1, m ) );
+
+    if (m == 0)
+        return;
+
+    // w = Q^H u
+    lapack::vector< scalar_t > w( m );
+    blas::gemv( blas::Layout::ColMajor, blas::Op::ConjTrans, m, m,
+                scalar_t( 1 ), Q, ldq, u, 1, scalar_t( 0 ), &w[0], 1 );
+
+    // Zero w( 1 : m-1 ) bottom up, making R upper Hessenberg.
+    blas::real_type<scalar_t> c;
+    scalar_t s, r;
+    for (int64_t k = m - 2; k >= 0; --k) {
+        lartg( w[ k ], w[ k+1 ], &c, &s, &r );
+        w[ k ] = r;
+        w[ k+1 ] = 0;
+        if (k < n)
+            R[ k+1 + k*ldr ] = 0;
+        rotate( m, n, k, k, Q, ldq, R, ldr, c, s );
+    }
+
+    // R += w(0) e_0 v^H, still upper Hessenberg
+    for (int64_t j = 0; j < n; ++j)
+        R[ j*ldr ] += w[ 0 ] * conj( v[ j ] );
+
+    hessenberg_to_triangular( m, n, 0, min( n, m-1 ), Q, ldq, R, ldr );
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+void qr_insert_col_impl(
+    int64_t m, int64_t n,
+    scalar_t* Q, int64_t ldq,
+    scalar_t* R, int64_t ldr,
+    int64_t j, scalar_t const* x )
+{
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 );
+    lapack_error_if( ldq < max( 1, m ) );
+    lapack_error_if( ldr < max( 1, m ) );
+    lapack_error_if( j < 1 || j > n+1 );
+
+    int64_t jj = j - 1;  // 0-based
+
+    // Shift columns jj, ..., n-1 right. Shifted column c has a zero in
+    // row c, which the rotations below fill.
+    for (int64_t c = n; c > jj; --c) {
+        for (int64_t i = 0; i < min( c, m ); ++i)
+            R[ i + c*ldr ] = R[ i + (c-1)*ldr ];
+        if (c < m)
+            R[ c + c*ldr ] = 0;
+    }
+
+    // R( :, jj ) = Q^H x
+    blas::gemv( blas::Layout::ColMajor, blas::Op::ConjTrans, m, m,
+                scalar_t( 1 ), Q, ldq, x, 1, scalar_t( 0 ), &R[ jj*ldr ], 1 );
+
+    // Zero R( jj+1 : m-1, jj ) bottom up.
+    blas::real_type<scalar_t> c;
+    scalar_t s, r;
+    for (int64_t k = m - 2; k >= jj; --k) {
+        lartg( R[ k + jj*ldr ], R[ k+1 + jj*ldr ], &c, &s, &r );
+        R[ k   + jj*ldr ] = r;
+        R[ k+1 + jj*ldr ] = 0;
+        rotate( m, n+1, k, k+1, Q, ldq, R, ldr, c, s );
+    }
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+void qr_delete_col_impl(
+    int64_t m, int64_t n,
+    scalar_t* Q, int64_t ldq,
+    scalar_t* R, int64_t ldr,
+    int64_t j )
+{
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 1 );
+    lapack_error_if( ldq < max( 1, m ) );
+    lapack_error_if( ldr < max( 1, m ) );
+    lapack_error_if( j < 1 || j > n );
+
+    int64_t jj = j - 1;  // 0-based
+
+    // Shift columns jj+1, ..., n-1 left, making R upper Hessenberg.
+    for (int64_t c = jj; c < n-1; ++c) {
+        for (int64_t i = 0; i < min( c+2, m ); ++i)
+            R[ i + c*ldr ] = R[ i + (c+1)*ldr ];
+    }
+
+    hessenberg_to_triangular( m, n-1, jj, min( n-1, m-1 ), Q, ldq, R, ldr );
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+void qr_insert_row_impl(
+    int64_t m, int64_t n,
+    scalar_t* Q, int64_t ldq,
+    scalar_t* R, int64_t ldr,
+    int64_t i, scalar_t const* x )
+{
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 );
+    lapack_error_if( ldq < m+1 );
+    lapack_error_if( ldr < m+1 );
+    lapack_error_if( i < 1 || i > m+1 );
+
+    int64_t ii = i - 1;  // 0-based
+
+    // With x as row ii of A, A = [ 0 Q ] [ x^T ]  with rows permuted.
+    //                            [ 1 0 ] [ R   ]
+    // Build Q := P [ 1 0; 0 Q ], inserting row ii and column 0,
+    // from the last column back so nothing is overwritten before it is read.
+    for (int64_t c = m; c >= 1; --c) {
+        for (int64_t r = m; r > ii; --r)
+            Q[ r + c*ldq ] = Q[ r-1 + (c-1)*ldq ];
+        Q[ ii + c*ldq ] = 0;
+        for (int64_t r = ii - 1; r >= 0; --r)
+            Q[ r + c*ldq ] = Q[ r + (c-1)*ldq ];
+    }
+    for (int64_t r = 0; r <= m; ++r)
+        Q[ r ] = 0;
+    Q[ ii ] = 1;
+
+    // R := [ x^T; R ], which is upper Hessenberg.
+    for (int64_t c = 0; c < n; ++c) {
+        for (int64_t r = min( c, m-1 ); r >= 0; --r)
+            R[ r+1 + c*ldr ] = R[ r + c*ldr ];
+        R[ c*ldr ] = x[ c ];
+    }
+
+    hessenberg_to_triangular( m+1, n, 0, min( n, m ), Q, ldq, R, ldr );
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+void qr_delete_row_impl(
+    int64_t m, int64_t n,
+    scalar_t* Q, int64_t ldq,
+    scalar_t* R, int64_t ldr,
+    int64_t i )
+{
+    lapack_error_if( m < 1 );
+    lapack_error_if( n < 0 );
+    lapack_error_if( ldq < max( 1, m ) );
+    lapack_error_if( ldr < max( 1, m ) );
+    lapack_error_if( i < 1 || i > m );
+
+    int64_t ii = i - 1;  // 0-based
+
+    // Zero row ii of Q in columns 1, ..., m-1, right to left,
+    // making R upper Hessenberg. Rotations are computed on conj( q )
+    // since Q is multiplied on the right by G^H.
+    blas::real_type<scalar_t> c;
+    scalar_t s, r;
+    for (int64_t k = m - 2; k >= 0; --k) {
+        lartg( conj( Q[ ii + k*ldq ] ), conj( Q[ ii + (k+1)*ldq ] ),
+               &c, &s, &r );
+        if (k < n)
+            R[ k+1 + k*ldr ] = 0;
+        rotate( m, n, k, k, Q, ldq, R, ldr, c, s );
+        Q[ ii + (k+1)*ldq ] = 0;
+    }
+
+    // Now Q = P [ alpha 0; 0 Q2 ] with |alpha| = 1, so row ii of A
+    // is alpha R( 0, : ). Drop row ii and column 0 of Q, and row 0 of R.
+    for (int64_t c2 = 0; c2 < m-1; ++c2) {
+        for (int64_t r2 = 0; r2 < ii; ++r2)
+            Q[ r2 + c2*ldq ] = Q[ r2 + (c2+1)*ldq ];
+        for (int64_t r2 = ii; r2 < m-1; ++r2)
+            Q[ r2 + c2*ldq ] = Q[ r2+1 + (c2+1)*ldq ];
+    }
+    for (int64_t c2 = 0; c2 < n; ++c2) {
+        for (int64_t r2 = 0; r2 < min( c2+1, m-1 ); ++r2)
+            R[ r2 + c2*ldr ] = R[ r2+1 + c2*ldr ];
+    }
+}
+
+}  // namespace
+
+// -----------------------------------------------------------------------------
+/// Updates the QR factorization $A = Q R$ of an m-by-n matrix A to that of
+/// the rank-one update $A + u v^H$, in O(m^2 + m n) operations using Givens
+/// rotations from lartg, instead of the O(m n^2) to refactor.
+///
+/// The routines qr_update, qr_insert_col, qr_delete_col, qr_insert_row,
+/// and qr_delete_row all work on the full m-by-m unitary Q, as generated by
+/// ungqr( m, m, min( m, n ), ... ) from geqrf's output, and the m-by-n upper
+/// trapezoidal R. geqrf's compact Householder form can't be updated this way.
+/// The strictly lower triangle of R is not read; on exit, parts of it may
+/// be overwritten with zeros.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] m
+///     The number of rows of the matrix A. m >= 0.
+///
+/// @param[in] n
+///     The number of columns of the matrix A. n >= 0.
+///
+/// @param[in,out] Q
+///     The m-by-m unitary matrix Q, stored in an ldq-by-m array.
+///     On exit, the updated Q.
+///
+/// @param[in] ldq
+///     The leading dimension of the array Q. ldq >= max(1,m).
+///
+/// @param[in,out] R
+///     The m-by-n upper trapezoidal matrix R, stored in an ldr-by-n array.
+///     On exit, the updated R.
+///
+/// @param[in] ldr
+///     The leading dimension of the array R. ldr >= max(1,m).
+///
+/// @param[in] u
+///     The vector u of length m.
+///
+/// @param[in] v
+///     The vector v of length n.
+///
+/// @see qr_insert_col, qr_delete_col, qr_insert_row, qr_delete_row
+/// @ingroup geqrf
+void qr_update(
+    int64_t m, int64_t n,
+    float* Q, int64_t ldq,
+    float* R, int64_t ldr,
+    float const* u, float const* v )
+{
+    qr_update_impl( m, n, Q, ldq, R, ldr, u, v );
+}
+
+/// @ingroup geqrf
+void qr_update(
+    int64_t m, int64_t n,
+    double* Q, int64_t ldq,
+    double* R, int64_t ldr,
+    double const* u, double const* v )
+{
+    qr_update_impl( m, n, Q, ldq, R, ldr, u, v );
+}
+
+/// @ingroup geqrf
+void qr_update(
+    int64_t m, int64_t n,
+    std::complex<float>* Q, int64_t ldq,
+    std::complex<float>* R, int64_t ldr,
+    std::complex<float> const* u, std::complex<float> const* v )
+{
+    qr_update_impl( m, n, Q, ldq, R, ldr, u, v );
+}
+
+/// @ingroup geqrf
+void qr_update(
+    int64_t m, int64_t n,
+    std::complex<double>* Q, int64_t ldq,
+    std::complex<double>* R, int64_t ldr,
+    std::complex<double> const* u, std::complex<double> const* v )
+{
+    qr_update_impl( m, n, Q, ldq, R, ldr, u, v );
+}
+
+// -----------------------------------------------------------------------------
+/// Updates the QR factorization $A = Q R$ of an m-by-n matrix A to that of
+/// A with column x inserted before column j, in O(m^2 + m n) operations.
+/// See qr_update for the storage of Q and R.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] m
+///     The number of rows of the matrix A. m >= 0.
+///
+/// @param[in] n
+///     The number of columns of the matrix A before the insertion. n >= 0.
+///
+/// @param[in,out] Q
+///     The m-by-m unitary matrix Q, stored in an ldq-by-m array.
+///     On exit, the updated Q.
+///
+/// @param[in] ldq
+///     The leading dimension of the array Q. ldq >= max(1,m).
+///
+/// @param[in,out] R
+///     The ldr-by-(n+1) array R. On entry, the m-by-n upper trapezoidal R.
+///     On exit, the m-by-(n+1) upper trapezoidal R of the updated A.
+///
+/// @param[in] ldr
+///     The leading dimension of the array R. ldr >= max(1,m).
+///
+/// @param[in] j
+///     The index of the inserted column in the updated A, 1-based.
+///     1 <= j <= n+1; j = n+1 appends the column.
+///
+/// @param[in] x
+///     The column x of length m.
+///
+/// @ingroup geqrf
+void qr_insert_col(
+    int64_t m, int64_t n,
+    float* Q, int64_t ldq,
+    float* R, int64_t ldr,
+    int64_t j, float const* x )
+{
+    qr_insert_col_impl( m, n, Q, ldq, R, ldr, j, x );
+}
+
+/// @ingroup geqrf
+void qr_insert_col(
+    int64_t m, int64_t n,
+    double* Q, int64_t ldq,
+    double* R, int64_t ldr,
+    int64_t j, double const* x )
+{
+    qr_insert_col_impl( m, n, Q, ldq, R, ldr, j, x );
+}
+
+/// @ingroup geqrf
+void qr_insert_col(
+    int64_t m, int64_t n,
+    std::complex<float>* Q, int64_t ldq,
+    std::complex<float>* R, int64_t ldr,
+    int64_t j, std::complex<float> const* x )
+{
+    qr_insert_col_impl( m, n, Q, ldq, R, ldr, j, x );
+}
+
+/// @ingroup geqrf
+void qr_insert_col(
+    int64_t m, int64_t n,
+    std::complex<double>* Q, int64_t ldq,
+    std::complex<double>* R, int64_t ldr,
+    int64_t j, std::complex<double> const* x )
+{
+    qr_insert_col_impl( m, n, Q, ldq, R, ldr, j, x );
+}
+
+// -----------------------------------------------------------------------------
+/// Updates the QR factorization $A = Q R$ of an m-by-n matrix A to that of
+/// A with column j deleted, in O(m^2 + m n) operations.
+/// See qr_update for the storage of Q and R.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] m
+///     The number of rows of the matrix A. m >= 0.
+///
+/// @param[in] n
+///     The number of columns of the matrix A before the deletion. n >= 1.
+///
+/// @param[in,out] Q
+///     The m-by-m unitary matrix Q, stored in an ldq-by-m array.
+///     On exit, the updated Q.
+///
+/// @param[in] ldq
+///     The leading dimension of the array Q. ldq >= max(1,m).
+///
+/// @param[in,out] R
+///     The ldr-by-n array R. On entry, the m-by-n upper trapezoidal R.
+///     On exit, the first n-1 columns hold the m-by-(n-1) R of the updated
+///     A; the last column is undefined.
+///
+/// @param[in] ldr
+///     The leading dimension of the array R. ldr >= max(1,m).
+///
+/// @param[in] j
+///     The index of the deleted column, 1-based. 1 <= j <= n.
+///
+/// @ingroup geqrf
+void qr_delete_col(
+    int64_t m, int64_t n,
+    float* Q, int64_t ldq,
+    float* R, int64_t ldr,
+    int64_t j )
+{
+    qr_delete_col_impl( m, n, Q, ldq, R, ldr, j );
+}
+
+/// @ingroup geqrf
+void qr_delete_col(
+    int64_t m, int64_t n,
+    double* Q, int64_t ldq,
+    double* R, int64_t ldr,
+    int64_t j )
+{
+    qr_delete_col_impl( m, n, Q, ldq, R, ldr, j );
+}
+
+/// @ingroup geqrf
+void qr_delete_col(
+    int64_t m, int64_t n,
+    std::complex<float>* Q, int64_t ldq,
+    std::complex<float>* R, int64_t ldr,
+    int64_t j )
+{
+    qr_delete_col_impl( m, n, Q, ldq, R, ldr, j );
+}
+
+/// @ingroup geqrf
+void qr_delete_col(
+    int64_t m, int64_t n,
+    std::complex<double>* Q, int64_t ldq,
+    std::complex<double>* R, int64_t ldr,
+    int64_t j )
+{
+    qr_delete_col_impl( m, n, Q, ldq, R, ldr, j );
+}
+
+// -----------------------------------------------------------------------------
+/// Updates the QR factorization $A = Q R$ of an m-by-n matrix A to that of
+/// A with row x inserted before row i, in O(m^2 + m n) operations.
+/// See qr_update for the storage of Q and R.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] m
+///     The number of rows of the matrix A before the insertion. m >= 0.
+///
+/// @param[in] n
+///     The number of columns of the matrix A. n >= 0.
+///
+/// @param[in,out] Q
+///     The ldq-by-(m+1) array Q. On entry, the m-by-m unitary Q.
+///     On exit, the (m+1)-by-(m+1) unitary Q of the updated A.
+///
+/// @param[in] ldq
+///     The leading dimension of the array Q. ldq >= m+1.
+///
+/// @param[in,out] R
+///     The ldr-by-n array R. On entry, the m-by-n upper trapezoidal R.
+///     On exit, the (m+1)-by-n upper trapezoidal R of the updated A.
+///
+/// @param[in] ldr
+///     The leading dimension of the array R. ldr >= m+1.
+///
+/// @param[in] i
+///     The index of the inserted row in the updated A, 1-based.
+///     1 <= i <= m+1; i = m+1 appends the row.
+///
+/// @param[in] x
+///     The row x of length n.
+///
+/// @ingroup geqrf
+void qr_insert_row(
+    int64_t m, int64_t n,
+    float* Q, int64_t ldq,
+    float* R, int64_t ldr,
+    int64_t i, float const* x )
+{
+    qr_insert_row_impl( m, n, Q, ldq, R, ldr, i, x );
+}
+
+/// @ingroup geqrf
+void qr_insert_row(
+    int64_t m, int64_t n,
+    double* Q, int64_t ldq,
+    double* R, int64_t ldr,
+    int64_t i, double const* x )
+{
+    qr_insert_row_impl( m, n, Q, ldq, R, ldr, i, x );
+}
+
+/// @ingroup geqrf
+void qr_insert_row(
+    int64_t m, int64_t n,
+    std::complex<float>* Q, int64_t ldq,
+    std::complex<float>* R, int64_t ldr,
+    int64_t i, std::complex<float> const* x )
+{
+    qr_insert_row_impl( m, n, Q, ldq, R, ldr, i, x );
+}
+
+/// @ingroup geqrf
+void qr_insert_row(
+    int64_t m, int64_t n,
+    std::complex<double>* Q, int64_t ldq,
+    std::complex<double>* R, int64_t ldr,
+    int64_t i, std::complex<double> const* x )
+{
+    qr_insert_row_impl( m, n, Q, ldq, R, ldr, i, x );
+}
+
+// -----------------------------------------------------------------------------
+/// Updates the QR factorization $A = Q R$ of an m-by-n matrix A to that of
+/// A with row i deleted, in O(m^2 + m n) operations.
+/// See qr_update for the storage of Q and R.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] m
+///     The number of rows of the matrix A before the deletion. m >= 1.
+///
+/// @param[in] n
+///     The number of columns of the matrix A. n >= 0.
+///
+/// @param[in,out] Q
+///     The ldq-by-m array Q. On entry, the m-by-m unitary Q.
+///     On exit, the leading (m-1)-by-(m-1) part holds the unitary Q of the
+///     updated A; the rest is undefined.
+///
+/// @param[in] ldq
+///     The leading dimension of the array Q. ldq >= max(1,m).
+///
+/// @param[in,out] R
+///     The ldr-by-n array R. On entry, the m-by-n upper trapezoidal R.
+///     On exit, the leading (m-1)-by-n part holds the R of the updated A.
+///
+/// @param[in] ldr
+///     The leading dimension of the array R. ldr >= max(1,m).
+///
+/// @param[in] i
+///     The index of the deleted row, 1-based. 1 <= i <= m.
+///
+/// @ingroup geqrf
+void qr_delete_row(
+    int64_t m, int64_t n,
+    float* Q, int64_t ldq,
+    float* R, int64_t ldr,
+    int64_t i )
+{
+    qr_delete_row_impl( m, n, Q, ldq, R, ldr, i );
+}
+
+/// @ingroup geqrf
+void qr_delete_row(
+    int64_t m, int64_t n,
+    double* Q, int64_t ldq,
+    double* R, int64_t ldr,
+    int64_t i )
+{
+    qr_delete_row_impl( m, n, Q, ldq, R, ldr, i );
+}
+
+/// @ingroup geqrf
+void qr_delete_row(
+    int64_t m, int64_t n,
+    std::complex<float>* Q, int64_t ldq,
+    std::complex<float>* R, int64_t ldr,
+    int64_t i )
+{
+    qr_delete_row_impl( m, n, Q, ldq, R, ldr, i );
+}
+
+/// @ingroup geqrf
+void qr_delete_row(
+    int64_t m, int64_t n,
+    std::complex<double>* Q, int64_t ldq,
+    std::complex<double>* R, int64_t ldr,
+    int64_t i )
+{
+    qr_delete_row_impl( m, n, Q, ldq, R, ldr, i );
+}
+
+}  // namespace lapack
@@ -0,0 +1,274 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "NoConstructAllocator.hh"
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+
+namespace {
+
+inline char type_char( float* )                { return 's'; }
+inline char type_char( double* )               { return 'd'; }
+inline char type_char( std::complex<float>* )  { return 'c'; }
+inline char type_char( std::complex<double>* ) { return 'z'; }
+
+//------------------------------------------------------------------------------
+// Chooses driver: override, tuning table, or default. gesdd needs the same
+// job for U and VT, and gesvdx computes only the min( m, n ) thin vectors;
+// otherwise fall back to gesvd, which handles any job.
+SvdDriver choose_svd(
+    char type, Job jobu, Job jobvt, int64_t m, int64_t n, int64_t nwanted )
+{
+    Job jobz = (jobu == Job::NoVec && jobvt == Job::NoVec ? Job::NoVec : Job::Vec);
+    SvdDriver driver = select_svd_driver( type, jobz, m, n, nwanted );
+    if (driver == SvdDriver::gesdd && jobu != jobvt)
+        driver = SvdDriver::gesvd;
+    #if LAPACK_VERSION >= 30600  // >= 3.6
+        if (driver == SvdDriver::gesvdx
+            && (jobu == Job::AllVec || jobvt == Job::AllVec))
+            driver = SvdDriver::gesvd;
+    #else
+        if (driver == SvdDriver::gesvdx)
+            driver = SvdDriver::gesvd;
+    #endif
+    if (driver == SvdDriver::Auto)
+        driver = SvdDriver::gesvd;
+    return driver;
+}
+
+//------------------------------------------------------------------------------
+// Maps gesvd job (NoVec, SomeVec) to gesvdx job (NoVec, Vec).
+inline Job gesvdx_job( Job job )
+{
+    return (job == Job::NoVec ? Job::NoVec : Job::Vec);
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+int64_t svd_auto_all(
+    Job jobu, Job jobvt, int64_t m, int64_t n,
+    scalar_t* A, int64_t lda,
+    blas::real_type<scalar_t>* S,
+    scalar_t* U, int64_t ldu,
+    scalar_t* VT, int64_t ldvt )
+{
+    lapack_error_if( jobu  != Job::NoVec && jobu  != Job::SomeVec && jobu  != Job::AllVec );
+    lapack_error_if( jobvt != Job::NoVec && jobvt != Job::SomeVec && jobvt != Job::AllVec );
+
+    int64_t minmn = min( m, n );
+    SvdDriver driver = choose_svd( type_char( A ), jobu, jobvt, m, n, minmn );
+    switch (driver) {
+        case SvdDriver::gesdd:
+            return gesdd( jobu, m, n, A, lda, S, U, ldu, VT, ldvt );
+
+        #if LAPACK_VERSION >= 30600  // >= 3.6
+        case SvdDriver::gesvdx: {
+            int64_t ns = 0;
+            return gesvdx( gesvdx_job( jobu ), gesvdx_job( jobvt ), Range::All,
+                           m, n, A, lda, 0, 0, 0, 0, &ns, S, U, ldu, VT, ldvt );
+        }
+        #endif
+
+        default:
+            return gesvd( jobu, jobvt, m, n, A, lda, S, U, ldu, VT, ldvt );
+    }
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+int64_t svd_auto_index(
+    Job jobu, Job jobvt, int64_t m, int64_t n,
+    scalar_t* A, int64_t lda, int64_t il, int64_t iu,
+    int64_t* nfound,
+    blas::real_type<scalar_t>* S,
+    scalar_t* U, int64_t ldu,
+    scalar_t* VT, int64_t ldvt )
+{
+    lapack_error_if( jobu  != Job::NoVec && jobu  != Job::Vec );
+    lapack_error_if( jobvt != Job::NoVec && jobvt != Job::Vec );
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 );
+    lapack_error_if( lda < max( 1, m ) );
+
+    int64_t minmn = min( m, n );
+    lapack_error_if( minmn > 0 && (il < 1 || il > minmn) );
+    lapack_error_if( minmn > 0 && (iu < il || iu > minmn) );
+    int64_t nwanted = (minmn > 0 ? iu - il + 1 : 0);
+    lapack_error_if( ldu < 1 || (jobu == Job::Vec && ldu < m) );
+    lapack_error_if( ldvt < 1 || (jobvt == Job::Vec && ldvt < nwanted) );
+
+    SvdDriver driver = choose_svd( type_char( A ), jobu, jobvt, m, n, nwanted );
+
+    #if LAPACK_VERSION >= 30600  // >= 3.6
+        if (driver == SvdDriver::gesvdx) {
+            return gesvdx( jobu, jobvt, Range::Index, m, n, A, lda, 0, 0, il, iu,
+                           nfound, S, U, ldu, VT, ldvt );
+        }
+    #endif
+
+    // gesvd and gesdd compute all thin vectors; extract il, ..., iu
+    bool wantu  = (jobu  == Job::Vec);
+    bool wantvt = (jobvt == Job::Vec);
+    int64_t ldu_  = (wantu  ? max( 1, m ) : 1);
+    int64_t ldvt_ = (wantvt ? max( 1, minmn ) : 1);
+    lapack::vector< scalar_t > U_ ( wantu  ? ldu_*minmn : 1 );
+    lapack::vector< scalar_t > VT_( wantvt ? ldvt_*n    : 1 );
+
+    int64_t info;
+    if (driver == SvdDriver::gesdd && (wantu || wantvt)) {
+        // gesdd computes both or neither; compute both, copy what's wanted
+        ldu_  = max( 1, m );
+        ldvt_ = max( 1, minmn );
+        U_ .resize( ldu_*minmn );
+        VT_.resize( ldvt_*n );
+        info = gesdd( Job::SomeVec, m, n, A, lda, S,
+                      &U_[0], ldu_, &VT_[0], ldvt_ );
+    }
+    else if (driver == SvdDriver::gesdd) {
+        info = gesdd( Job::NoVec, m, n, A, lda, S,
+                      &U_[0], ldu_, &VT_[0], ldvt_ );
+    }
+    else {
+        info = gesvd( wantu  ? Job::SomeVec : Job::NoVec,
+                      wantvt ? Job::SomeVec : Job::NoVec,
+                      m, n, A, lda, S, &U_[0], ldu_, &VT_[0], ldvt_ );
+    }
+
+    if (info == 0) {
+        for (int64_t i = 0; i < nwanted; ++i)
+            S[ i ] = S[ il - 1 + i ];
+        if (wantu) {
+            lacpy( MatrixType::General, m, nwanted,
+                   &U_[ (il - 1)*ldu_ ], ldu_, U, ldu );
+        }
+        if (wantvt) {
+            lacpy( MatrixType::General, nwanted, n,
+                   &VT_[ il - 1 ], ldvt_, VT, ldvt );
+        }
+        *nfound = nwanted;
+    }
+    return info;
+}
+
+}  // namespace
+
+// -----------------------------------------------------------------------------
+/// Computes the singular value decomposition (SVD) of a general
+/// m-by-n matrix A, using whichever of gesvd, gesdd, or gesvdx the tuning
+/// table says is fastest for this size. See select_svd_driver.
+/// Arguments and results are the same as gesvd,
+/// except jobu = OverwriteVec and jobvt = OverwriteVec are not supported.
+///
+/// @ingroup gesvd
+int64_t svd_auto(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* S,
+    float* U, int64_t ldu,
+    float* VT, int64_t ldvt )
+{
+    return svd_auto_all( jobu, jobvt, m, n, A, lda, S, U, ldu, VT, ldvt );
+}
+
+/// @ingroup gesvd
+int64_t svd_auto(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* S,
+    double* U, int64_t ldu,
+    double* VT, int64_t ldvt )
+{
+    return svd_auto_all( jobu, jobvt, m, n, A, lda, S, U, ldu, VT, ldvt );
+}
+
+/// @ingroup gesvd
+int64_t svd_auto(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* S,
+    std::complex<float>* U, int64_t ldu,
+    std::complex<float>* VT, int64_t ldvt )
+{
+    return svd_auto_all( jobu, jobvt, m, n, A, lda, S, U, ldu, VT, ldvt );
+}
+
+/// @ingroup gesvd
+int64_t svd_auto(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* S,
+    std::complex<double>* U, int64_t ldu,
+    std::complex<double>* VT, int64_t ldvt )
+{
+    return svd_auto_all( jobu, jobvt, m, n, A, lda, S, U, ldu, VT, ldvt );
+}
+
+// -----------------------------------------------------------------------------
+/// Computes singular values il, ..., iu (1-based, in descending order) and,
+/// optionally, the corresponding singular vectors of a general m-by-n
+/// matrix A, using whichever driver the tuning table says is fastest for
+/// this size and number of wanted singular values.
+/// Arguments and results are the same as gesvdx with range = Index:
+/// jobu and jobvt are NoVec or Vec; S has length min( m, n ), and on exit,
+/// its first nfound = iu - il + 1 entries hold the singular values;
+/// U is m-by-nfound and VT is nfound-by-n. A is destroyed.
+///
+/// @ingroup gesvd
+int64_t svd_auto(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    float* A, int64_t lda, int64_t il, int64_t iu,
+    int64_t* nfound,
+    float* S,
+    float* U, int64_t ldu,
+    float* VT, int64_t ldvt )
+{
+    return svd_auto_index( jobu, jobvt, m, n, A, lda, il, iu, nfound,
+                           S, U, ldu, VT, ldvt );
+}
+
+/// @ingroup gesvd
+int64_t svd_auto(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    double* A, int64_t lda, int64_t il, int64_t iu,
+    int64_t* nfound,
+    double* S,
+    double* U, int64_t ldu,
+    double* VT, int64_t ldvt )
+{
+    return svd_auto_index( jobu, jobvt, m, n, A, lda, il, iu, nfound,
+                           S, U, ldu, VT, ldvt );
+}
+
+/// @ingroup gesvd
+int64_t svd_auto(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda, int64_t il, int64_t iu,
+    int64_t* nfound,
+    float* S,
+    std::complex<float>* U, int64_t ldu,
+    std::complex<float>* VT, int64_t ldvt )
+{
+    return svd_auto_index( jobu, jobvt, m, n, A, lda, il, iu, nfound,
+                           S, U, ldu, VT, ldvt );
+}
+
+/// @ingroup gesvd
+int64_t svd_auto(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda, int64_t il, int64_t iu,
+    int64_t* nfound,
+    double* S,
+    std::complex<double>* U, int64_t ldu,
+    std::complex<double>* VT, int64_t ldvt )
+{
+    return svd_auto_index( jobu, jobvt, m, n, A, lda, il, iu, nfound,
+                           S, U, ldu, VT, ldvt );
+}
+
+}  // namespace lapack
@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "dispatch.hh"
 
 #include <vector>
 
@@ -36,7 +37,7 @@ int64_t syev(
     // query for workspace size
     float qry_work[1];
     lapack_int ineg_one = -1;
-    LAPACK_ssyev(
+    lapack_dispatch( LAPACK_ssyev, n )(
         &jobz_, &uplo_, &n_,
         A, &lda_,
         W,
@@ -53,7 +54,7 @@ int64_t syev(
     // allocate workspace
     lapack::vector< float > work( lwork_ );
 
-    LAPACK_ssyev(
+    lapack_dispatch( LAPACK_ssyev, n )(
         &jobz_, &uplo_, &n_,
         A, &lda_,
         W,
@@ -90,7 +91,7 @@ int64_t syev(
     // query for workspace size
     double qry_work[1];
     lapack_int ineg_one = -1;
-    LAPACK_dsyev(
+    lapack_dispatch( LAPACK_dsyev, n )(
         &jobz_, &uplo_, &n_,
         A, &lda_,
         W,
@@ -107,7 +108,7 @@ int64_t syev(
     // allocate workspace
     lapack::vector< double > work( lwork_ );
 
-    LAPACK_dsyev(
+    lapack_dispatch( LAPACK_dsyev, n )(
         &jobz_, &uplo_, &n_,
         A, &lda_,
         W,
@@ -0,0 +1,267 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack/update.hh"
+#include "NoConstructAllocator.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace lapack {
+
+using blas::max;
+
+namespace {
+
+//------------------------------------------------------------------------------
+// Rank-one update of A = Q diag( D ) Q^T to A + rho z z^T, following
+// LAPACK's divide & conquer merge (laed2 deflation, laed3 vectors).
+template <typename real_t>
+int64_t syev_update_impl(
+    Job jobz, int64_t n,
+    real_t* D,
+    real_t* Q, int64_t ldq,
+    real_t rho,
+    real_t const* z )
+{
+    lapack_error_if( jobz != Job::NoVec && jobz != Job::Vec );
+    lapack_error_if( n < 0 );
+    lapack_error_if( ldq < max( 1, n ) );
+
+    if (n == 0 || rho == 0)
+        return 0;
+
+    bool wantz = (jobz == Job::Vec);
+    const real_t one = 1, zero = 0;
+
+    // w = Q^T z, the update in the eigenbasis
+    lapack::vector< real_t > w( n );
+    blas::gemv( blas::Layout::ColMajor, blas::Op::Trans, n, n,
+                one, Q, ldq, z, 1, zero, &w[0], 1 );
+    real_t wnorm = blas::nrm2( n, &w[0], 1 );
+    if (wnorm == 0)
+        return 0;
+
+    // Scale z to unit norm. laed4_all needs rho > 0, so for rho < 0, negate D
+    // and reverse its order so it stays ascending: d( i ) = -D( col( i ) ).
+    real_t sign = (rho > 0 ? one : -one);
+    real_t rho2 = std::abs( rho ) * wnorm * wnorm;
+    lapack::vector< real_t > d( n ), zn( n );
+    lapack::vector< int64_t > col( n );
+    for (int64_t i = 0; i < n; ++i) {
+        col[ i ] = (rho > 0 ? i : n - 1 - i);
+        d[ i ]  = sign * D[ col[ i ] ];
+        zn[ i ] = w[ col[ i ] ] / wnorm;
+    }
+
+    // ---------- deflation, as in laed2
+    // Entries with tiny rho |z(i)| keep their eigenpair. Of two entries with
+    // nearly equal d, a Givens rotation zeros one z, which then keeps its
+    // eigenpair; the rotation is also applied to Q.
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t dmax = 0, zmax = 0;
+    for (int64_t i = 0; i < n; ++i) {
+        dmax = max( dmax, std::abs( d[ i ] ) );
+        zmax = max( zmax, std::abs( zn[ i ] ) );
+    }
+    real_t tol = 8 * eps * max( dmax, zmax );
+
+    std::vector< int64_t > keep;  // non-deflated indices, ascending d
+    keep.reserve( n );
+    int64_t prev = -1;
+    for (int64_t j = 0; j < n; ++j) {
+        if (rho2 * std::abs( zn[ j ] ) <= tol)
+            continue;
+        if (prev >= 0) {
+            real_t tau = std::hypot( zn[ prev ], zn[ j ] );
+            real_t c = zn[ j ] / tau;
+            real_t s = -zn[ prev ] / tau;
+            real_t t = d[ j ] - d[ prev ];
+            if (std::abs( t*c*s ) <= tol) {
+                zn[ j ] = tau;
+                zn[ prev ] = 0;
+                real_t dp = d[ prev ], dj = d[ j ];
+                d[ prev ] = dp*c*c + dj*s*s;
+                d[ j ]    = dp*s*s + dj*c*c;
+                if (wantz) {
+                    blas::rot( n, &Q[ col[ prev ]*ldq ], 1, &Q[ col[ j ]*ldq ], 1,
+                               c, s );
+                }
+            }
+            else {
+                keep.push_back( prev );
+            }
+        }
+        prev = j;
+    }
+    if (prev >= 0)
+        keep.push_back( prev );
+    int64_t k = keep.size();
+
+    // ---------- secular equation for the k non-deflated entries
+    lapack::vector< real_t > dk( k ), zk( k ), lambda( k );
+    lapack::vector< real_t > delta( k*k );  // delta( i, j ) = dk( i ) - lambda( j )
+    for (int64_t i = 0; i < k; ++i) {
+        dk[ i ] = d[ keep[ i ] ];
+        zk[ i ] = zn[ keep[ i ] ];
+    }
+    int64_t info = laed4_all( k, dk.data(), zk.data(), delta.data(), max( 1, k ),
+                              rho2, lambda.data() );
+    if (info != 0)
+        return info;
+
+    // ---------- eigenvectors, as in laed3
+    lapack::vector< real_t > Qk;
+    if (wantz) {
+        // Recompute z from the computed eigenvalues (Gu & Eisenstat),
+        // so the vectors are numerically orthogonal even for close
+        // eigenvalues.
+        for (int64_t i = 0; i < k; ++i) {
+            real_t wi = delta[ i + i*k ];
+            for (int64_t j = 0; j < k; ++j) {
+                if (j != i)
+                    wi *= delta[ i + j*k ] / (dk[ i ] - dk[ j ]);
+            }
+            zk[ i ] = std::copysign( std::sqrt( -wi ), zk[ i ] );
+        }
+        // U( i, j ) = zk( i ) / delta( i, j ), normalized; stored in delta
+        for (int64_t j = 0; j < k; ++j) {
+            real_t* Uj = &delta[ j*k ];
+            for (int64_t i = 0; i < k; ++i)
+                Uj[ i ] = zk[ i ] / Uj[ i ];
+            real_t unorm = blas::nrm2( k, Uj, 1 );
+            blas::scal( k, one / unorm, Uj, 1 );
+        }
+
+        // Qk = Q( :, keep ) U
+        lapack::vector< real_t > Qkeep( n*k );
+        for (int64_t i = 0; i < k; ++i)
+            blas::copy( n, &Q[ col[ keep[ i ] ]*ldq ], 1, &Qkeep[ i*n ], 1 );
+        Qk.resize( n*k );
+        blas::gemm( blas::Layout::ColMajor, blas::Op::NoTrans, blas::Op::NoTrans,
+                    n, k, k,
+                    one, &Qkeep[0], n, &delta[0], k, zero, &Qk[0], n );
+    }
+
+    // ---------- merge deflated and new eigenpairs in ascending order.
+    // Eigenpair source: index j >= 0 is lambda( j ), column j of Qk;
+    // index -1 - i is d( i ), column col( i ) of Q.
+    lapack::vector< real_t > eig( n );
+    lapack::vector< int64_t > src( n );
+    std::vector< char > deflated( n, true );
+    for (int64_t j = 0; j < k; ++j)
+        deflated[ keep[ j ] ] = false;
+    int64_t cnt = 0;
+    for (int64_t j = 0; j < k; ++j) {
+        eig[ cnt ] = sign * lambda[ j ];
+        src[ cnt ] = j;
+        ++cnt;
+    }
+    for (int64_t i = 0; i < n; ++i) {
+        if (deflated[ i ]) {
+            eig[ cnt ] = sign * d[ i ];
+            src[ cnt ] = -1 - i;
+            ++cnt;
+        }
+    }
+    lapack::vector< int64_t > order( n );
+    for (int64_t i = 0; i < n; ++i)
+        order[ i ] = i;
+    std::sort( order.begin(), order.end(),
+               [&eig]( int64_t a, int64_t b ) { return eig[ a ] < eig[ b ]; } );
+
+    if (wantz) {
+        lapack::vector< real_t > Qout( n*n );
+        for (int64_t i = 0; i < n; ++i) {
+            int64_t s = src[ order[ i ] ];
+            real_t const* x = (s >= 0 ? &Qk[ s*n ] : &Q[ col[ -1 - s ]*ldq ]);
+            blas::copy( n, x, 1, &Qout[ i*n ], 1 );
+        }
+        lacpy( MatrixType::General, n, n, &Qout[0], n, Q, ldq );
+    }
+    for (int64_t i = 0; i < n; ++i)
+        D[ i ] = eig[ order[ i ] ];
+
+    return 0;
+}
+
+}  // namespace
+
+// -----------------------------------------------------------------------------
+/// Updates the eigendecomposition $A = Q D Q^T$ of a real symmetric matrix,
+/// as computed by syev or heev, to that of the rank-one update
+/// $A + \rho z z^T$, in O(n^2) operations for eigenvalues, plus O(n k^2)
+/// to rotate the eigenvectors with gemm, where k <= n is the number of
+/// eigenpairs that don't deflate.
+///
+/// The new eigenvalues are the roots of the secular equation
+/// $1 + \rho \sum_i w_i^2 / (d_i - \lambda) = 0$, where $w = Q^T z$, found by
+/// laed4_all. As in LAPACK's divide and conquer (laed2, laed3), entries with
+/// negligible $w_i$, and one of each pair of nearly equal $d_i$, are deflated
+/// and keep their eigenpair, and eigenvectors are computed from a $w$
+/// recomputed from the new eigenvalues, so they are numerically orthogonal.
+///
+/// Overloaded versions are available for
+/// `float` and `double`.
+///
+/// @param[in] jobz
+///     - lapack::Job::NoVec: Update eigenvalues only; Q is input only;
+///     - lapack::Job::Vec:   Update eigenvalues and eigenvectors.
+///
+/// @param[in] n
+///     The order of the matrix A. n >= 0.
+///
+/// @param[in,out] D
+///     The vector D of length n.
+///     On entry, the eigenvalues of A in ascending order.
+///     On successful exit, the eigenvalues of $A + \rho z z^T$ in ascending order.
+///
+/// @param[in,out] Q
+///     The n-by-n matrix Q, stored in an ldq-by-n array.
+///     On entry, the orthonormal eigenvectors of A, with Q(:,i) for D(i).
+///     On successful exit, if jobz = Vec, the eigenvectors of
+///     $A + \rho z z^T$, with Q(:,i) for the new D(i).
+///
+/// @param[in] ldq
+///     The leading dimension of the array Q. ldq >= max(1,n).
+///
+/// @param[in] rho
+///     The scalar $\rho$, of either sign.
+///
+/// @param[in] z
+///     The vector z of length n.
+///
+/// @return = 0: successful exit
+/// @return > 0: if return value = i, laed4_all failed to find the i-th root of
+///              the deflated secular equation; D is unchanged, and Q is
+///              undefined.
+///
+/// @see potrf_update
+/// @ingroup heev_computational
+int64_t syev_update(
+    lapack::Job jobz, int64_t n,
+    float* D,
+    float* Q, int64_t ldq,
+    float rho,
+    float const* z )
+{
+    return syev_update_impl( jobz, n, D, Q, ldq, rho, z );
+}
+
+/// @ingroup heev_computational
+int64_t syev_update(
+    lapack::Job jobz, int64_t n,
+    double* D,
+    double* Q, int64_t ldq,
+    double rho,
+    double const* z )
+{
+    return syev_update_impl( jobz, n, D, Q, ldq, rho, z );
+}
+
+}  // namespace lapack
@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "dispatch.hh"
 
 #include <vector>
 
@@ -37,7 +38,7 @@ int64_t syevd(
     float qry_work[1];
     lapack_int qry_iwork[1];
     lapack_int ineg_one = -1;
-    LAPACK_ssyevd(
+    lapack_dispatch( LAPACK_ssyevd, n )(
         &jobz_, &uplo_, &n_,
         A, &lda_,
         W,
@@ -57,7 +58,7 @@ int64_t syevd(
     lapack::vector< float > work( lwork_ );
     lapack::vector< lapack_int > iwork( liwork_ );
 
-    LAPACK_ssyevd(
+    lapack_dispatch( LAPACK_ssyevd, n )(
         &jobz_, &uplo_, &n_,
         A, &lda_,
         W,
@@ -96,7 +97,7 @@ int64_t syevd(
     double qry_work[1];
     lapack_int qry_iwork[1];
     lapack_int ineg_one = -1;
-    LAPACK_dsyevd(
+    lapack_dispatch( LAPACK_dsyevd, n )(
         &jobz_, &uplo_, &n_,
         A, &lda_,
         W,
@@ -116,7 +117,7 @@ int64_t syevd(
     lapack::vector< double > work( lwork_ );
     lapack::vector< lapack_int > iwork( liwork_ );
 
-    LAPACK_dsyevd(
+    lapack_dispatch( LAPACK_dsyevd, n )(
         &jobz_, &uplo_, &n_,
         A, &lda_,
         W,
@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "dispatch.hh"
 
 #include <vector>
 
@@ -55,7 +56,7 @@ int64_t syevr(
     float qry_work[1];
     lapack_int qry_iwork[1];
     lapack_int ineg_one = -1;
-    LAPACK_ssyevr(
+    lapack_dispatch( LAPACK_ssyevr, n )(
         &jobz_, &range_, &uplo_, &n_,
         A, &lda_, &vl, &vu, &il_, &iu_, &abstol, &nfound_,
         W,
@@ -77,7 +78,7 @@ int64_t syevr(
     lapack::vector< float > work( lwork_ );
     lapack::vector< lapack_int > iwork( liwork_ );
 
-    LAPACK_ssyevr(
+    lapack_dispatch( LAPACK_ssyevr, n )(
         &jobz_, &range_, &uplo_, &n_,
         A, &lda_, &vl, &vu, &il_, &iu_, &abstol, &nfound_,
         W,
@@ -140,7 +141,7 @@ int64_t syevr(
     double qry_work[1];
     lapack_int qry_iwork[1];
     lapack_int ineg_one = -1;
-    LAPACK_dsyevr(
+    lapack_dispatch( LAPACK_dsyevr, n )(
         &jobz_, &range_, &uplo_, &n_,
         A, &lda_, &vl, &vu, &il_, &iu_, &abstol, &nfound_,
         W,
@@ -162,7 +163,7 @@ int64_t syevr(
     lapack::vector< double > work( lwork_ );
     lapack::vector< lapack_int > iwork( liwork_ );
 
-    LAPACK_dsyevr(
+    lapack_dispatch( LAPACK_dsyevr, n )(
         &jobz_, &range_, &uplo_, &n_,
         A, &lda_, &vl, &vu, &il_, &iu_, &abstol, &nfound_,
         W,
@@ -0,0 +1,134 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+
+#include <mutex>
+#include <set>
+
+#if defined(LAPACK_HAVE_MKL) || defined(BLAS_HAVE_MKL)
+    #define LAPACK_THREADS_MKL
+    #include <mkl_service.h>
+#elif defined(LAPACK_HAVE_OPENBLAS) || defined(BLAS_HAVE_OPENBLAS)
+    #define LAPACK_THREADS_OPENBLAS
+    // from OpenBLAS cblas.h, which may conflict with other CBLAS headers
+    extern "C" {
+        void openblas_set_num_threads( int num_threads );
+        int openblas_get_num_threads( void );
+    }
+#elif defined(_OPENMP)
+    #define LAPACK_THREADS_OPENMP
+    #include <omp.h>
+#endif
+
+namespace lapack {
+
+namespace {
+
+#ifdef LAPACK_THREADS_OPENBLAS
+
+// Thread counts requested by active ThreadScopes, and the process-wide
+// setting before the first of them.
+std::multiset< int > s_scopes;
+int s_scopes_saved = 0;
+std::mutex s_scopes_mutex;
+
+#endif
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+/// Sets number of threads the backend uses. With MKL and OpenBLAS, this is
+/// process-wide; with OpenMP, it applies to the calling thread.
+/// For a temporary change, use ThreadScope.
+///
+void set_num_threads( int nthreads )
+{
+    lapack_error_if( nthreads < 1 );
+    #if defined(LAPACK_THREADS_MKL)
+        mkl_set_num_threads( nthreads );
+    #elif defined(LAPACK_THREADS_OPENBLAS)
+        openblas_set_num_threads( nthreads );
+    #elif defined(LAPACK_THREADS_OPENMP)
+        omp_set_num_threads( nthreads );
+    #endif
+}
+
+//------------------------------------------------------------------------------
+/// @return number of threads the backend will use in the calling thread,
+/// including the effect of any ThreadScope.
+///
+int get_num_threads()
+{
+    #if defined(LAPACK_THREADS_MKL)
+        return mkl_get_max_threads();
+    #elif defined(LAPACK_THREADS_OPENBLAS)
+        return openblas_get_num_threads();
+    #elif defined(LAPACK_THREADS_OPENMP)
+        return omp_get_max_threads();
+    #else
+        return 1;
+    #endif
+}
+
+//------------------------------------------------------------------------------
+/// @return backend whose thread count set_num_threads and ThreadScope
+/// control: "MKL", "OpenBLAS", "OpenMP", or "none".
+///
+const char* thread_backend()
+{
+    #if defined(LAPACK_THREADS_MKL)
+        return "MKL";
+    #elif defined(LAPACK_THREADS_OPENBLAS)
+        return "OpenBLAS";
+    #elif defined(LAPACK_THREADS_OPENMP)
+        return "OpenMP";
+    #else
+        return "none";
+    #endif
+}
+
+//------------------------------------------------------------------------------
+/// Limits backend to nthreads threads until the scope exits.
+///
+ThreadScope::ThreadScope( int nthreads ):
+    nthreads_( nthreads ),
+    saved_( 0 )
+{
+    lapack_error_if( nthreads < 1 );
+    #if defined(LAPACK_THREADS_MKL)
+        // thread-local; returns previous local setting, 0 meaning global
+        saved_ = mkl_set_num_threads_local( nthreads );
+    #elif defined(LAPACK_THREADS_OPENBLAS)
+        std::lock_guard< std::mutex > lock( s_scopes_mutex );
+        if (s_scopes.empty())
+            s_scopes_saved = openblas_get_num_threads();
+        s_scopes.insert( nthreads );
+        openblas_set_num_threads( *s_scopes.begin() );
+    #elif defined(LAPACK_THREADS_OPENMP)
+        // nthreads-var is per thread
+        saved_ = omp_get_max_threads();
+        omp_set_num_threads( nthreads );
+    #endif
+}
+
+//------------------------------------------------------------------------------
+/// Restores the backend's previous number of threads.
+///
+ThreadScope::~ThreadScope()
+{
+    #if defined(LAPACK_THREADS_MKL)
+        mkl_set_num_threads_local( saved_ );
+    #elif defined(LAPACK_THREADS_OPENBLAS)
+        std::lock_guard< std::mutex > lock( s_scopes_mutex );
+        s_scopes.erase( s_scopes.find( nthreads_ ) );
+        openblas_set_num_threads( s_scopes.empty() ? s_scopes_saved
+                                                   : *s_scopes.begin() );
+    #elif defined(LAPACK_THREADS_OPENMP)
+        omp_set_num_threads( saved_ );
+    #endif
+}
+
+}  // namespace lapack
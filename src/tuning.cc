@@ -0,0 +1,861 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "dispatch.hh"
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <vector>
+
+namespace lapack {
+
+namespace {
+
+//------------------------------------------------------------------------------
+// One measured point: for problems of this kind, type, and shape,
+// driver was fastest.
+struct TuningEntry {
+    char kind;          // 'e' = eig, 's' = svd
+    char type;          // 's', 'd', 'c', 'z'
+    bool vectors;
+    int64_t m, n, nwanted;
+    int driver;         // EigDriver or SvdDriver
+};
+
+//------------------------------------------------------------------------------
+// Block size for LAPACK routine, e.g., "dgetrf", or "getrf" for all types,
+// returned by ilaenv for problems of size n, or any size if n < 0.
+// nx < 0 leaves the backend's crossover point.
+struct BlockSizeEntry {
+    std::string routine;
+    int64_t n, nb, nx;
+};
+
+//------------------------------------------------------------------------------
+// LAPACK library that routines can be dispatched to, by name.
+struct BackendEntry {
+    std::string name;
+    std::string path;
+};
+
+//------------------------------------------------------------------------------
+// Backend for LAPACK routine, e.g., "dgetrf", or "getrf" for all types,
+// for problems of size n, or any size if n < 0.
+struct RouteEntry {
+    std::string routine;
+    int64_t n;
+    std::string backend;
+};
+
+struct Table {
+    std::vector< TuningEntry > drivers;
+    std::vector< BlockSizeEntry > block_sizes;
+    std::vector< BackendEntry > backends;
+    std::vector< RouteEntry > routes;
+};
+
+Table s_table;
+std::mutex s_table_mutex;
+std::once_flag s_table_env_flag;
+
+//------------------------------------------------------------------------------
+// Immutable copy of the routes, read by dispatch_symbol without locking.
+// paths[ i ] is the path of routes[ i ]'s backend, or empty for the default.
+// funcs[ 4*i + t ] caches the symbol from that backend for type t
+// (s, d, c, z), or holds s_unresolved until first use.
+struct RouteSnapshot {
+    std::vector< RouteEntry > routes;
+    std::vector< std::string > paths;
+    std::unique_ptr< std::atomic< void* >[] > funcs;
+};
+
+// Current snapshot, or null if there are no routes. Replaced snapshots are
+// kept in s_snapshots, never deleted, since other threads may still be
+// reading them; set_backend is rare, so this is small.
+std::atomic< RouteSnapshot const* > s_routes( nullptr );
+std::vector< std::unique_ptr< RouteSnapshot > > s_snapshots;
+
+// Marks funcs entries not yet resolved; null means the backend lacks it.
+char s_unresolved;
+
+const char types[] = "sdcz";
+
+// Number of block sizes, so ilaenv can skip the table when there are none.
+std::atomic< size_t > s_num_block_sizes( 0 );
+
+std::atomic< int > s_eig_driver( int( EigDriver::Auto ) );
+std::atomic< int > s_svd_driver( int( SvdDriver::Auto ) );
+
+const char* eig_driver_names[] = {
+    "auto", "ev", "evd", "evr", "evx",
+    "ev_2stage", "evd_2stage", "evr_2stage", "evx_2stage",
+};
+
+const char* svd_driver_names[] = {
+    "auto", "gesvd", "gesdd", "gesvdx",
+};
+
+//------------------------------------------------------------------------------
+// Reads table in file into table. Returns false if file can't be opened.
+// Throws Error on a malformed line.
+bool read_table( std::string const& filename, Table& table )
+{
+    std::ifstream file( filename );
+    if (! file)
+        return false;
+
+    std::string line;
+    int lineno = 0;
+    while (std::getline( file, line )) {
+        ++lineno;
+        size_t pos = line.find( '#' );
+        if (pos != std::string::npos)
+            line.erase( pos );
+
+        std::istringstream fields( line );
+        std::string kind, type, job, driver;
+        TuningEntry entry;
+        if (! (fields >> kind))
+            continue;  // blank or comment line
+        if (kind == "nb") {
+            BlockSizeEntry bs;
+            fields >> bs.routine >> bs.n >> bs.nb >> bs.nx;
+            if (! fields || bs.routine.empty() || bs.nb <= 0) {
+                throw Error( filename + ":" + std::to_string( lineno )
+                             + ": malformed block size entry: " + line );
+            }
+            table.block_sizes.push_back( bs );
+            continue;
+        }
+        if (kind == "backend") {
+            // path is rest of line, so it may contain spaces
+            BackendEntry be;
+            fields >> be.name >> std::ws;
+            std::getline( fields, be.path );
+            size_t end = be.path.find_last_not_of( " \t\r" );
+            be.path.erase( end == std::string::npos ? 0 : end + 1 );
+            if (be.name.empty() || be.path.empty()) {
+                throw Error( filename + ":" + std::to_string( lineno )
+                             + ": malformed backend entry: " + line );
+            }
+            table.backends.push_back( be );
+            continue;
+        }
+        if (kind == "route") {
+            RouteEntry re;
+            fields >> re.routine >> re.n >> re.backend;
+            if (! fields || re.routine.empty() || re.backend.empty()) {
+                throw Error( filename + ":" + std::to_string( lineno )
+                             + ": malformed route entry: " + line );
+            }
+            table.routes.push_back( re );
+            continue;
+        }
+        fields >> type >> job >> entry.m >> entry.n >> entry.nwanted >> driver;
+        if (! fields || type.size() != 1 || job.size() != 1
+            || std::strchr( "sdcz", type[0] ) == nullptr
+            || std::strchr( "NV", job[0] ) == nullptr
+            || (kind != "eig" && kind != "svd")) {
+            throw Error( filename + ":" + std::to_string( lineno )
+                         + ": malformed tuning entry: " + line );
+        }
+        entry.kind = kind[0];
+        entry.type = type[0];
+        entry.vectors = (job[0] == 'V');
+        if (entry.kind == 'e')
+            entry.driver = int( str2eigdriver( driver.c_str() ) );
+        else
+            entry.driver = int( str2svddriver( driver.c_str() ) );
+        table.drivers.push_back( entry );
+    }
+    return true;
+}
+
+//------------------------------------------------------------------------------
+// Publishes a new snapshot of the routes for dispatch_symbol, after routes
+// or backends change. Assumes s_table_mutex is locked.
+void publish_routes()
+{
+    RouteSnapshot* snapshot = nullptr;
+    if (! s_table.routes.empty()) {
+        size_t size = s_table.routes.size();
+        std::unique_ptr< RouteSnapshot > copy( new RouteSnapshot );
+        copy->routes = s_table.routes;
+        copy->paths.resize( size );
+        copy->funcs.reset( new std::atomic< void* >[ 4*size ] );
+        for (size_t i = 0; i < size; ++i) {
+            for (auto const& e : s_table.backends) {
+                if (e.name == copy->routes[ i ].backend)
+                    copy->paths[ i ] = e.path;
+            }
+            for (size_t t = 0; t < 4; ++t)
+                copy->funcs[ 4*i + t ].store( &s_unresolved );
+        }
+        snapshot = copy.get();
+        s_snapshots.push_back( std::move( copy ) );
+    }
+    s_routes.store( snapshot, std::memory_order_release );
+}
+
+//------------------------------------------------------------------------------
+// Loads $LAPACKPP_TUNING_FILE once, on first use of the table.
+// A missing or malformed file is ignored, leaving the built-in defaults,
+// so a stale environment can't make eig_auto or svd_auto fail.
+void load_env_table()
+{
+    std::call_once( s_table_env_flag, [] {
+        const char* filename = std::getenv( "LAPACKPP_TUNING_FILE" );
+        if (filename == nullptr || filename[0] == '\0')
+            return;
+        Table table;
+        try {
+            if (read_table( filename, table )) {
+                std::lock_guard< std::mutex > lock( s_table_mutex );
+                s_table = std::move( table );
+                publish_routes();
+                s_num_block_sizes = s_table.block_sizes.size();
+            }
+        }
+        catch (Error const&) {
+            // ignore malformed file
+        }
+    });
+}
+
+//------------------------------------------------------------------------------
+// Adds entry, replacing any previous entry with the same key.
+void set_entry( TuningEntry const& entry )
+{
+    load_env_table();
+    std::lock_guard< std::mutex > lock( s_table_mutex );
+    for (auto& e : s_table.drivers) {
+        if (e.kind == entry.kind && e.type == entry.type
+            && e.vectors == entry.vectors
+            && e.m == entry.m && e.n == entry.n && e.nwanted == entry.nwanted) {
+            e.driver = entry.driver;
+            return;
+        }
+    }
+    s_table.drivers.push_back( entry );
+}
+
+//------------------------------------------------------------------------------
+// Adds entry, replacing any previous entry with the same key.
+void set_block_size_entry( BlockSizeEntry const& entry )
+{
+    load_env_table();
+    std::lock_guard< std::mutex > lock( s_table_mutex );
+    for (auto& e : s_table.block_sizes) {
+        if (e.routine == entry.routine && e.n == entry.n) {
+            e = entry;
+            return;
+        }
+    }
+    s_table.block_sizes.push_back( entry );
+    s_num_block_sizes = s_table.block_sizes.size();
+}
+
+//------------------------------------------------------------------------------
+// Adds entry, replacing any previous backend with the same name.
+void set_backend_entry( BackendEntry const& entry )
+{
+    load_env_table();
+    std::lock_guard< std::mutex > lock( s_table_mutex );
+    for (auto& e : s_table.backends) {
+        if (e.name == entry.name) {
+            e = entry;
+            publish_routes();
+            return;
+        }
+    }
+    s_table.backends.push_back( entry );
+    publish_routes();
+}
+
+//------------------------------------------------------------------------------
+// Adds entry, replacing any previous entry with the same key.
+void set_route_entry( RouteEntry const& entry )
+{
+    load_env_table();
+    std::lock_guard< std::mutex > lock( s_table_mutex );
+    for (auto& e : s_table.routes) {
+        if (e.routine == entry.routine && e.n == entry.n) {
+            e = entry;
+            publish_routes();
+            return;
+        }
+    }
+    s_table.routes.push_back( entry );
+    publish_routes();
+}
+
+//------------------------------------------------------------------------------
+// Returns routine name in lowercase.
+std::string lowercase( std::string const& routine )
+{
+    std::string name( routine );
+    for (auto& c : name)
+        c = char( std::tolower( c ) );
+    return name;
+}
+
+//------------------------------------------------------------------------------
+// Returns the entry in entries for routine, e.g., "dgetrf", nearest to
+// size n, or null if there is none. Entries for the routine name including
+// type take precedence over entries for all types, e.g., "getrf"; sized
+// entries take precedence over n < 0. name must be lowercase.
+// Assumes s_table_mutex is locked, or entries are in a RouteSnapshot.
+template <typename entry_t>
+entry_t const* nearest_routine_entry(
+    std::vector< entry_t > const& entries,
+    char const* name, int64_t n )
+{
+    // generic name without type, e.g., dgetrf => getrf
+    char const* generic = (name[0] != '\0' && name[1] != '\0'
+                           && std::strchr( types, name[0] )
+                           ? name + 1 : name);
+
+    entry_t const* found = nullptr;
+    double best = INFINITY;
+    for (int pass = 0; pass < 2 && found == nullptr; ++pass) {
+        char const* key = (pass == 0 ? name : generic);
+        for (auto const& e : entries) {
+            if (e.routine != key)
+                continue;
+            // sized entries by log distance; unsized entries last
+            double d = (e.n < 0 ? 1e300
+                        : std::abs( std::log( std::max( double( n ), 1.0 )
+                                              / std::max( double( e.n ), 1.0 ) ) ));
+            if (found == nullptr || d < best) {
+                best = d;
+                found = &e;
+            }
+        }
+    }
+    return found;
+}
+
+//------------------------------------------------------------------------------
+// Returns driver of the entry nearest to the given problem, or -1 if the
+// table has no entries for this kind, type, and job. Distance is measured
+// in log space of m, n, and fraction of vectors wanted, nwanted / min( m, n ),
+// since driver crossovers are roughly at fixed ratios of those.
+int nearest_entry(
+    char kind, char type, bool vectors,
+    int64_t m, int64_t n, int64_t nwanted )
+{
+    load_env_table();
+
+    auto frac = [](int64_t m_, int64_t n_, int64_t nwanted_) {
+        int64_t k = std::max( int64_t( 1 ), std::min( m_, n_ ) );
+        return double( std::max( int64_t( 1 ), nwanted_ ) ) / k;
+    };
+    auto dist = [](double x, double y) {
+        return std::abs( std::log( std::max( x, 1.0 ) / std::max( y, 1.0 ) ) );
+    };
+    double f = frac( m, n, nwanted );
+
+    std::lock_guard< std::mutex > lock( s_table_mutex );
+    int driver = -1;
+    double best = INFINITY;
+    for (auto const& e : s_table.drivers) {
+        if (e.kind != kind || e.type != type || e.vectors != vectors)
+            continue;
+        double d = dist( m, e.m ) + dist( n, e.n )
+                 + std::abs( std::log( f / frac( e.m, e.n, e.nwanted ) ) );
+        if (d < best) {
+            best = d;
+            driver = e.driver;
+        }
+    }
+    return driver;
+}
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+const char* eigdriver2str( lapack::EigDriver driver )
+{
+    int i = int( driver );
+    if (i < 0 || i >= int( sizeof(eig_driver_names) / sizeof(*eig_driver_names) ))
+        return "?";
+    return eig_driver_names[ i ];
+}
+
+/// @throws Error if driver is not a known name.
+lapack::EigDriver str2eigdriver( const char* driver )
+{
+    int cnt = sizeof(eig_driver_names) / sizeof(*eig_driver_names);
+    for (int i = 0; i < cnt; ++i) {
+        if (std::strcmp( driver, eig_driver_names[ i ] ) == 0)
+            return EigDriver( i );
+    }
+    throw Error( std::string( "unknown eig driver: " ) + driver );
+}
+
+//------------------------------------------------------------------------------
+const char* svddriver2str( lapack::SvdDriver driver )
+{
+    int i = int( driver );
+    if (i < 0 || i >= int( sizeof(svd_driver_names) / sizeof(*svd_driver_names) ))
+        return "?";
+    return svd_driver_names[ i ];
+}
+
+/// @throws Error if driver is not a known name.
+lapack::SvdDriver str2svddriver( const char* driver )
+{
+    int cnt = sizeof(svd_driver_names) / sizeof(*svd_driver_names);
+    for (int i = 0; i < cnt; ++i) {
+        if (std::strcmp( driver, svd_driver_names[ i ] ) == 0)
+            return SvdDriver( i );
+    }
+    throw Error( std::string( "unknown svd driver: " ) + driver );
+}
+
+//------------------------------------------------------------------------------
+/// Forces eig_auto to use driver, where it supports the requested job.
+/// EigDriver::Auto reverts to the tuning table.
+///
+void set_eig_driver( lapack::EigDriver driver )
+{
+    s_eig_driver = int( driver );
+}
+
+lapack::EigDriver get_eig_driver()
+{
+    return EigDriver( s_eig_driver.load() );
+}
+
+//------------------------------------------------------------------------------
+/// Forces svd_auto to use driver, where it supports the requested job.
+/// SvdDriver::Auto reverts to the tuning table.
+///
+void set_svd_driver( lapack::SvdDriver driver )
+{
+    s_svd_driver = int( driver );
+}
+
+lapack::SvdDriver get_svd_driver()
+{
+    return SvdDriver( s_svd_driver.load() );
+}
+
+//------------------------------------------------------------------------------
+/// Adds entries in filename to the tuning table. Driver entries are lines
+///
+///     kind type job m n nwanted driver
+///
+/// where kind is eig or svd, type is s, d, c, or z, job is N or V,
+/// and driver is a name from eigdriver2str or svddriver2str, e.g.,
+///
+///     eig d V 1000 1000 100 evr
+///
+/// Block size entries, used by the ilaenv override (see set_block_size),
+/// are lines
+///
+///     nb routine n nb nx
+///
+/// e.g., `nb dgetrf 4000 128 -1`. Backends and routes, used by runtime
+/// dispatch (see add_backend and set_backend), are lines
+///
+///     backend name path
+///     route routine n backend
+///
+/// e.g., `backend openblas /usr/lib/libopenblas.so` and
+/// `route dgetrf 2000 openblas`. Text after # is a comment.
+///
+/// @throws Error if file can't be read or has a malformed line.
+///
+void load_tuning_table( std::string const& filename )
+{
+    load_env_table();
+    Table table;
+    if (! read_table( filename, table ))
+        throw Error( "can't open tuning file: " + filename );
+    for (auto const& entry : table.drivers)
+        set_entry( entry );
+    for (auto const& entry : table.block_sizes)
+        set_block_size_entry( entry );
+    for (auto const& entry : table.backends)
+        set_backend_entry( entry );
+    for (auto const& entry : table.routes)
+        set_route_entry( entry );
+}
+
+//------------------------------------------------------------------------------
+/// Writes the tuning table to filename, in the format of load_tuning_table.
+///
+/// @throws Error if file can't be written.
+///
+void save_tuning_table( std::string const& filename )
+{
+    load_env_table();
+    std::ostringstream out;
+    out << "# LAPACK++ tuning table, written by lapack::save_tuning_table\n"
+        << "# kind type job m n nwanted driver\n"
+        << "# nb routine n nb nx\n"
+        << "# backend name path\n"
+        << "# route routine n backend\n";
+    {
+        std::lock_guard< std::mutex > lock( s_table_mutex );
+        for (auto const& e : s_table.drivers) {
+            out << (e.kind == 'e' ? "eig " : "svd ")
+                << e.type << ' ' << (e.vectors ? 'V' : 'N') << ' '
+                << e.m << ' ' << e.n << ' ' << e.nwanted << ' '
+                << (e.kind == 'e' ? eigdriver2str( EigDriver( e.driver ) )
+                                  : svddriver2str( SvdDriver( e.driver ) ))
+                << '\n';
+        }
+        for (auto const& e : s_table.block_sizes) {
+            out << "nb " << e.routine << ' ' << e.n << ' '
+                << e.nb << ' ' << e.nx << '\n';
+        }
+        for (auto const& e : s_table.backends) {
+            out << "backend " << e.name << ' ' << e.path << '\n';
+        }
+        for (auto const& e : s_table.routes) {
+            out << "route " << e.routine << ' ' << e.n << ' '
+                << e.backend << '\n';
+        }
+    }
+
+    // write to temporary file, then rename, so readers never see partial table
+    std::string tmp = filename + ".tmp";
+    {
+        std::ofstream file( tmp );
+        file << out.str();
+        if (! file)
+            throw Error( "can't write tuning file: " + tmp );
+    }
+    if (std::rename( tmp.c_str(), filename.c_str() ) != 0)
+        throw Error( "can't rename " + tmp + " to " + filename );
+}
+
+//------------------------------------------------------------------------------
+/// Removes all entries from the tuning table, including block sizes,
+/// backends, and routes, reverting to built-in defaults.
+///
+void clear_tuning_table()
+{
+    load_env_table();
+    std::lock_guard< std::mutex > lock( s_table_mutex );
+    s_table.drivers.clear();
+    s_table.block_sizes.clear();
+    s_table.backends.clear();
+    s_table.routes.clear();
+    publish_routes();
+    s_num_block_sizes = 0;
+}
+
+//------------------------------------------------------------------------------
+/// Sets block size nb and crossover point nx that LAPACK's ilaenv returns
+/// for routine, e.g., "dgetrf", or "getrf" for all types, for problems of
+/// size n (nearest n is used), or for all sizes if n < 0.
+/// nx < 0 leaves the backend's crossover point.
+/// nb <= 0 removes the entry for routine and n, reverting to the backend.
+///
+/// Takes effect only if LAPACK++ was built with its ilaenv override
+/// (CMake -Dilaenv_override=yes) and the LAPACK backend calls ilaenv through
+/// the dynamic linker, as reference LAPACK does; see ilaenv_override_enabled.
+///
+void set_block_size(
+    std::string const& routine, int64_t nb, int64_t nx, int64_t n )
+{
+    lapack_error_if( routine.empty() );
+    std::string name = lowercase( routine );
+    if (nb > 0) {
+        set_block_size_entry( { name, n, nb, nx } );
+    }
+    else {
+        load_env_table();
+        std::lock_guard< std::mutex > lock( s_table_mutex );
+        auto& table = s_table.block_sizes;
+        table.erase( std::remove_if( table.begin(), table.end(),
+                         [&]( BlockSizeEntry const& e ) {
+                             return e.routine == name && e.n == n;
+                         } ),
+                     table.end() );
+        s_num_block_sizes = table.size();
+    }
+}
+
+//------------------------------------------------------------------------------
+/// @return block size set by set_block_size for routine, e.g., "dgetrf",
+/// and problem size n, or -1 if none is set. If nx is not null, sets nx
+/// to the crossover point, or -1 if none is set.
+/// Entries for the routine name including type take precedence over
+/// entries for all types; sized entries take precedence over n < 0.
+///
+int64_t get_block_size(
+    std::string const& routine, int64_t n, int64_t* nx )
+{
+    load_env_table();
+    std::string name = lowercase( routine );
+    std::lock_guard< std::mutex > lock( s_table_mutex );
+    BlockSizeEntry const* found
+        = nearest_routine_entry( s_table.block_sizes, name.c_str(), n );
+    if (nx != nullptr)
+        *nx = (found ? found->nx : -1);
+    return (found ? found->nb : -1);
+}
+
+//------------------------------------------------------------------------------
+/// Adds LAPACK library at path, e.g., "/usr/lib/libopenblas.so", as backend
+/// name, replacing any previous backend with that name. Routines are
+/// dispatched to it by set_backend. The library must use the same integer
+/// size (LP64 or ILP64) and Fortran name mangling as the linked LAPACK.
+///
+/// @throws Error if LAPACK++ was built with dispatch and the library can't
+/// be opened.
+///
+void add_backend( std::string const& name, std::string const& path )
+{
+    lapack_error_if( name.empty() || name == "default"
+                     || name.find_first_of( " \t" ) != std::string::npos );
+    lapack_error_if( path.empty() );
+    if (dispatch_enabled())
+        internal::backend_open( path );
+    set_backend_entry( { name, path } );
+}
+
+//------------------------------------------------------------------------------
+/// @return names of backends added by add_backend or the tuning table,
+/// not including "default".
+///
+std::vector< std::string > get_backends()
+{
+    load_env_table();
+    std::lock_guard< std::mutex > lock( s_table_mutex );
+    std::vector< std::string > names;
+    for (auto const& e : s_table.backends)
+        names.push_back( e.name );
+    return names;
+}
+
+//------------------------------------------------------------------------------
+/// Routes routine, e.g., "dgetrf", or "getrf" for all types, for problems
+/// of size n (nearest n is used), or for all sizes if n < 0, to backend,
+/// which is a name from add_backend, or "default" for the LAPACK linked
+/// at build time. An empty backend removes the route for routine and n.
+/// The problem size is max( m, n ) for getrf, geqrf, gesvd, and gesdd,
+/// and n otherwise.
+///
+/// Takes effect only if LAPACK++ was built with dispatch
+/// (CMake -Ddispatch=yes), and only for routines that LAPACK++ dispatches:
+/// getrf, getrs, gesv, potrf, potrs, posv, geqrf, heev, heevd, heevr
+/// (syev, syevd, syevr), gesvd, gesdd, and geev.
+/// A routine missing from the backend falls back to the default.
+///
+/// @throws Error if backend is unknown.
+///
+void set_backend(
+    std::string const& routine, std::string const& backend, int64_t n )
+{
+    lapack_error_if( routine.empty() );
+    std::string name = lowercase( routine );
+    if (backend.empty()) {
+        load_env_table();
+        std::lock_guard< std::mutex > lock( s_table_mutex );
+        auto& table = s_table.routes;
+        table.erase( std::remove_if( table.begin(), table.end(),
+                         [&]( RouteEntry const& e ) {
+                             return e.routine == name && e.n == n;
+                         } ),
+                     table.end() );
+        publish_routes();
+        return;
+    }
+    if (backend != "default") {
+        auto names = get_backends();
+        if (std::find( names.begin(), names.end(), backend ) == names.end())
+            throw Error( "unknown LAPACK backend: " + backend );
+    }
+    set_route_entry( { name, n, backend } );
+}
+
+//------------------------------------------------------------------------------
+/// @return backend that routine, e.g., "dgetrf", is routed to for problems
+/// of size n, or "default" if none is set. Routes for the routine name
+/// including type take precedence over routes for all types;
+/// sized routes take precedence over n < 0.
+///
+std::string get_backend( std::string const& routine, int64_t n )
+{
+    load_env_table();
+    std::string name = lowercase( routine );
+    std::lock_guard< std::mutex > lock( s_table_mutex );
+    RouteEntry const* found
+        = nearest_routine_entry( s_table.routes, name.c_str(), n );
+    return (found ? found->backend : "default");
+}
+
+namespace internal {
+
+//------------------------------------------------------------------------------
+// Returns true if any block sizes are set, so the ilaenv override can skip
+// get_block_size, which locks the table, when there are none.
+bool has_block_sizes()
+{
+    load_env_table();
+    return s_num_block_sizes.load( std::memory_order_relaxed ) > 0;
+}
+
+//------------------------------------------------------------------------------
+// Returns symbol, e.g., "dgetrf_", from the backend that routine dgetrf
+// is routed to for size n, or null for the default.
+// Called for every dispatched LAPACK call, so it reads the current
+// RouteSnapshot without locking or allocating, and caches the symbol.
+void* dispatch_symbol( char const* symbol, int64_t n )
+{
+    load_env_table();
+    RouteSnapshot const* snapshot = s_routes.load( std::memory_order_acquire );
+    if (snapshot == nullptr)
+        return nullptr;
+
+    // routine name from symbol, e.g., dgetrf_ or DGETRF => dgetrf
+    char routine[ 32 ];
+    size_t len = 0;
+    for (; symbol[ len ] != '\0'; ++len) {
+        if (len + 1 >= sizeof( routine ))
+            return nullptr;  // not a LAPACK routine
+        routine[ len ] = char( std::tolower( symbol[ len ] ) );
+    }
+    while (len > 0 && routine[ len-1 ] == '_')
+        --len;
+    routine[ len ] = '\0';
+
+    RouteEntry const* route
+        = nearest_routine_entry( snapshot->routes, routine, n );
+    if (route == nullptr)
+        return nullptr;
+    size_t i = route - snapshot->routes.data();
+    std::string const& path = snapshot->paths[ i ];
+    if (path.empty())
+        return nullptr;  // default, or backend not added
+
+    char const* type = (len > 0 ? std::strchr( types, routine[ 0 ] ) : nullptr);
+    if (type == nullptr)
+        return backend_symbol( path, symbol );
+    std::atomic< void* >& func = snapshot->funcs[ 4*i + (type - types) ];
+    void* f = func.load( std::memory_order_acquire );
+    if (f == &s_unresolved) {
+        // racing threads resolve the same symbol, so either store is fine
+        f = backend_symbol( path, symbol );
+        func.store( f, std::memory_order_release );
+    }
+    return f;
+}
+
+}  // namespace internal
+
+//------------------------------------------------------------------------------
+/// Records that driver is fastest for n-by-n eigenvalue problems of type
+/// ('s', 'd', 'c', 'z') with nwanted eigenvalues and, if jobz = Vec, vectors.
+///
+void set_eig_tuning(
+    char type, lapack::Job jobz, int64_t n, int64_t nwanted,
+    lapack::EigDriver driver )
+{
+    lapack_error_if( std::strchr( "sdcz", type ) == nullptr );
+    lapack_error_if( driver == EigDriver::Auto );
+    set_entry( { 'e', type, jobz != Job::NoVec, n, n, nwanted, int( driver ) } );
+}
+
+//------------------------------------------------------------------------------
+/// Records that driver is fastest for m-by-n SVD problems of type
+/// ('s', 'd', 'c', 'z') with nwanted singular values and, if jobz != NoVec,
+/// vectors.
+///
+void set_svd_tuning(
+    char type, lapack::Job jobz, int64_t m, int64_t n, int64_t nwanted,
+    lapack::SvdDriver driver )
+{
+    lapack_error_if( std::strchr( "sdcz", type ) == nullptr );
+    lapack_error_if( driver == SvdDriver::Auto );
+    set_entry( { 's', type, jobz != Job::NoVec, m, n, nwanted, int( driver ) } );
+}
+
+//------------------------------------------------------------------------------
+/// Built-in choice when the tuning table has no entries for a problem.
+/// Eigenvalues only: 2-stage tridiagonal reduction for large n, where its
+/// blocked first stage outruns the memory-bound sytrd.
+/// Few vectors: MRRR (evr), which computes only the wanted vectors.
+/// Otherwise divide & conquer (evd).
+///
+lapack::EigDriver default_eig_driver(
+    lapack::Job jobz, int64_t n, int64_t nwanted )
+{
+    if (jobz == Job::NoVec) {
+        #if LAPACK_VERSION >= 30700  // >= 3.7
+            if (n >= 1000)
+                return EigDriver::ev_2stage;
+        #endif
+        return EigDriver::ev;
+    }
+    else if (10*nwanted <= n) {
+        return EigDriver::evr;
+    }
+    return EigDriver::evd;
+}
+
+//------------------------------------------------------------------------------
+/// Built-in choice when the tuning table has no entries for a problem.
+/// Few vectors: bisection & inverse iteration (gesvdx), which computes only
+/// the wanted vectors. Otherwise divide & conquer (gesdd).
+///
+lapack::SvdDriver default_svd_driver(
+    lapack::Job jobz, int64_t m, int64_t n, int64_t nwanted )
+{
+    #if LAPACK_VERSION >= 30600  // >= 3.6
+        if (jobz != Job::NoVec && 10*nwanted <= std::min( m, n ))
+            return SvdDriver::gesvdx;
+    #endif
+    return SvdDriver::gesdd;
+}
+
+//------------------------------------------------------------------------------
+/// @return driver for eig_auto: the override set by set_eig_driver, if any;
+/// else the nearest tuning table entry; else default_eig_driver.
+///
+lapack::EigDriver select_eig_driver(
+    char type, lapack::Job jobz, int64_t n, int64_t nwanted )
+{
+    EigDriver driver = get_eig_driver();
+    if (driver != EigDriver::Auto)
+        return driver;
+    int d = nearest_entry( 'e', type, jobz != Job::NoVec, n, n, nwanted );
+    if (d > 0)
+        return EigDriver( d );
+    return default_eig_driver( jobz, n, nwanted );
+}
+
+//------------------------------------------------------------------------------
+/// @return driver for svd_auto: the override set by set_svd_driver, if any;
+/// else the nearest tuning table entry; else default_svd_driver.
+///
+lapack::SvdDriver select_svd_driver(
+    char type, lapack::Job jobz, int64_t m, int64_t n, int64_t nwanted )
+{
+    SvdDriver driver = get_svd_driver();
+    if (driver != SvdDriver::Auto)
+        return driver;
+    int d = nearest_entry( 's', type, jobz != Job::NoVec, m, n, nwanted );
+    if (d > 0)
+        return SvdDriver( d );
+    return default_svd_driver( jobz, m, n, nwanted );
+}
+
+}  // namespace lapack
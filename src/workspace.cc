@@ -0,0 +1,72 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "NoConstructAllocator.hh"
+
+#include <atomic>
+
+namespace lapack {
+
+namespace {
+
+// Process-wide counts, in bytes, of workspace allocated by lapack::vector.
+std::atomic< int64_t > s_workspace_bytes( 0 );
+std::atomic< int64_t > s_workspace_high_water( 0 );
+
+}  // namespace
+
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Records allocation of bytes of workspace; called by NoConstructAllocator.
+void workspace_allocated( std::size_t bytes )
+{
+    int64_t current = (s_workspace_bytes += bytes);
+    int64_t high = s_workspace_high_water.load();
+    while (current > high
+           && ! s_workspace_high_water.compare_exchange_weak( high, current )) {
+        // high was updated by compare_exchange_weak; retry
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Records release of bytes of workspace; called by NoConstructAllocator.
+void workspace_freed( std::size_t bytes ) noexcept
+{
+    s_workspace_bytes -= bytes;
+}
+
+}  // namespace internal
+
+//------------------------------------------------------------------------------
+/// @return bytes of workspace currently allocated by LAPACK++ routines.
+/// Counts are process-wide, over all threads.
+///
+int64_t workspace_bytes()
+{
+    return s_workspace_bytes.load();
+}
+
+//------------------------------------------------------------------------------
+/// @return peak bytes of workspace allocated by LAPACK++ routines since
+/// the last workspace_reset_high_water(), or since the program started.
+/// To measure a routine's hidden workspace, reset the high-water mark,
+/// call the routine, then subtract workspace_bytes() from before the call.
+///
+int64_t workspace_high_water()
+{
+    return s_workspace_high_water.load();
+}
+
+//------------------------------------------------------------------------------
+/// Resets the workspace high-water mark to the currently allocated bytes.
+///
+void workspace_reset_high_water()
+{
+    s_workspace_high_water = s_workspace_bytes.load();
+}
+
+}  // namespace lapack
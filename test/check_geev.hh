@@ -5,6 +5,7 @@
 
 #include "blas.hh"
 #include "lapack.hh"
+#include "check_random.hh"
 
 #include <vector>
 
@@ -206,6 +207,9 @@ real_t check_geev_Vnormalization(
 //
 // TODO: doesn't quite match LAWN 41, which normalizes by (n ||A||)
 // See LAPACK testing drvev and get22.
+//
+// If fast, estimates || op(A) V - V W ||_F / (||A||_F ||V||_F) using
+// random probes, in O(n^2) instead of O(n^3); see check_random.hh.
 
 // version for real
 template< typename scalar_t >
@@ -215,7 +219,8 @@ void check_geev(
     blas::complex_type< scalar_t > const* W,
     scalar_t const* V, int64_t ldv,
     int64_t verbose,
-    blas::real_type< scalar_t > results[2] )
+    blas::real_type< scalar_t > results[2],
+    bool fast = false )
 {
     using real_t = blas::real_type< scalar_t >;
 
@@ -223,6 +228,35 @@ void check_geev(
     std::vector< scalar_t > work( n * n );
     check_geev_multiply_VW( trans, n, W, V, ldv, &work[0], n );
 
+    if (fast) {
+        // Y = op(A) (V X) - (V W) X, where X is n-by-nprobes;
+        // V W is only O(n^2) to form since W is (block) diagonal.
+        std::vector< scalar_t > X, T( n * check_nprobes ), Y( n * check_nprobes );
+        check_random_probes( n, X );
+        blas::gemm( blas::Layout::ColMajor,
+                    blas::Op::NoTrans, blas::Op::NoTrans, n, check_nprobes, n,
+                    1.0, V, ldv, &X[0], n, 0.0, &T[0], n );
+        blas::gemm( blas::Layout::ColMajor,
+                    blas::Op::NoTrans, blas::Op::NoTrans, n, check_nprobes, n,
+                    -1.0, &work[0], n, &X[0], n, 0.0, &Y[0], n );
+        blas::gemm( blas::Layout::ColMajor,
+                    trans, blas::Op::NoTrans, n, check_nprobes, n,
+                    1.0, A, lda, &T[0], n, 1.0, &Y[0], n );
+
+        real_t error = check_random_norm( n, n, X, Y );
+        real_t Anorm = lapack::lange( lapack::Norm::Fro, n, n, A, lda );
+        real_t Vnorm = lapack::lange( lapack::Norm::Fro, n, n, V, ldv );
+        results[0] = error / Vnorm / Anorm;
+
+        if (verbose >= 1) {
+            printf( "error: { ||A^{%c} V - V W||_F ~ %.2e / (||V||_F=%.2e ||A||_F=%.2e) } = %.2e;  n=%.0f\n",
+                    op2char(trans), error, Vnorm, Anorm, results[0], real_t(n) );
+        }
+
+        results[1] = check_geev_Vnormalization( n, W, V, ldv );
+        return;
+    }
+
     if (verbose >= 2) {
         printf( "VW = " ); print_matrix( n, n, &work[0], n );
     }
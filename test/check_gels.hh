@@ -6,6 +6,7 @@
 #include "blas.hh"
 #include "lapack.hh"
 #include "error.hh"
+#include "check_random.hh"
 //#include "check_ortho.hh"
 
 #include <vector>
@@ -28,6 +29,11 @@
 /// On entry, A, B are the original input data to gels, X is the output of gels.
 /// A is m-by-n, op(A) is opAm-by-opAn, B is opAm-by-nrhs, X is opAn-by-nrhs.
 ///
+/// If fast, in the over-determined case, result[0] is a randomized estimate
+/// of || R^H op(A) ||_F (see check_random.hh), and in the under-determined
+/// case, the O(n^3) row-span check is skipped, leaving result[0] = 0.
+/// The residual check, result[1], is already only O(mn nrhs).
+///
 template< typename scalar_t >
 void check_gels(
     bool consistent,
@@ -36,7 +42,8 @@ void check_gels(
     scalar_t const* A, int64_t lda,
     scalar_t const* X, int64_t ldx,
     scalar_t const* B, int64_t ldb,
-    blas::real_type< scalar_t > result[2] )
+    blas::real_type< scalar_t > result[2],
+    bool fast = false )
 {
     using real_t = blas::real_type<scalar_t>;
     using blas::Op;
@@ -85,15 +92,34 @@ void check_gels(
         //real_t R_max = slate::norm(slate::Norm::Max, B);
         //slate::scale(1, R_max, B);
 
-        // X = R^H op(A)  (opAm-by-nrhs)^H (opAm-by-opAn) = (nrhs-by-opAm) (opAm-by-opAn)
-        std::vector< scalar_t > RA( nrhs * opAn );
-        blas::gemm( blas::Layout::ColMajor, Op::ConjTrans, trans, nrhs, opAn, opAm,
-                    1.0, &R[0], ldb,
-                         A, lda,
-                    0.0, &RA[0], nrhs );
-
-        // || R^H op(A) ||_1 == || X ||_inf
-        error = lapack::lange( lapack::Norm::One, nrhs, opAn, &RA[0], nrhs );
+        if (fast) {
+            // Y = R^H (op(A) P), where probes P are opAn-by-nprobes
+            std::vector< scalar_t > P, AP( opAm * check_nprobes ),
+                                    Y( nrhs * check_nprobes );
+            check_random_probes( opAn, P );
+            blas::gemm( blas::Layout::ColMajor, trans, Op::NoTrans,
+                        opAm, check_nprobes, opAn,
+                        1.0, A, lda,
+                             &P[0], opAn,
+                        0.0, &AP[0], opAm );
+            blas::gemm( blas::Layout::ColMajor, Op::ConjTrans, Op::NoTrans,
+                        nrhs, check_nprobes, opAm,
+                        1.0, &R[0], ldb,
+                             &AP[0], opAm,
+                        0.0, &Y[0], nrhs );
+            error = check_random_norm( nrhs, opAn, P, Y );
+        }
+        else {
+            // X = R^H op(A)  (opAm-by-nrhs)^H (opAm-by-opAn) = (nrhs-by-opAm) (opAm-by-opAn)
+            std::vector< scalar_t > RA( nrhs * opAn );
+            blas::gemm( blas::Layout::ColMajor, Op::ConjTrans, trans, nrhs, opAn, opAm,
+                        1.0, &R[0], ldb,
+                             A, lda,
+                        0.0, &RA[0], nrhs );
+
+            // || R^H op(A) ||_1 == || X ||_inf
+            error = lapack::lange( lapack::Norm::One, nrhs, opAn, &RA[0], nrhs );
+        }
         if (opA_norm != 0)
             error /= opA_norm;
         // todo: error *= R_max
@@ -102,7 +128,7 @@ void check_gels(
         error /= blas::max(m, n, nrhs);
         result[0] = error;
     }
-    else {
+    else if (! fast) {
         //--------------------------------------------------
         // opAm < opAn
         // Under-determined case, minimum norm solution.
@@ -6,6 +6,7 @@
 #include "blas.hh"
 #include "lapack.hh"
 #include "error.hh"
+#include "check_random.hh"
 
 #include <vector>
 
@@ -15,11 +16,15 @@
 // or
 // || I - U U^H || / n  if rowcol == Row (rows are orthogonal; m <= n)
 // Similar to LAPACK testing zunt01
+//
+// If fast, estimates || I - U^H U ||_F (or || I - U U^H ||_F) using
+// random probes in O(mn) instead of forming it in O(m n^2).
 template< typename scalar_t >
 blas::real_type< scalar_t > check_orthogonality(
     lapack::RowCol rowcol,
     int64_t m, int64_t n,
-    scalar_t const* U, int64_t ldu )
+    scalar_t const* U, int64_t ldu,
+    bool fast = false )
 {
     using namespace blas;
     using namespace lapack;
@@ -42,6 +47,21 @@ blas::real_type< scalar_t > check_orthogonality(
         k = m;
     }
 
+    if (fast) {
+        // Y = (I - U^H U) X = X - U^H (U X)   (col)
+        // or  (I - U U^H) X = X - U (U^H X)   (row)
+        // where X is minmn-by-nprobes, and T = U X or U^H X is k-by-nprobes.
+        Op transT = (transU == Op::NoTrans ? Op::ConjTrans : Op::NoTrans);
+        std::vector< scalar_t > X, T( k * check_nprobes );
+        check_random_probes( minmn, X );
+        std::vector< scalar_t > Y( X );
+        gemm( Layout::ColMajor, transT, Op::NoTrans, k, check_nprobes, minmn,
+              1.0, U, ldu, &X[0], minmn, 0.0, &T[0], k );
+        gemm( Layout::ColMajor, transU, Op::NoTrans, minmn, check_nprobes, k,
+              -1.0, U, ldu, &T[0], k, 1.0, &Y[0], minmn );
+        return check_random_norm( minmn, minmn, X, Y ) / k;
+    }
+
     // R = I - U^H U (col) or I - U U^H (row)
     std::vector< scalar_t > R( minmn * minmn );
     laset( MatrixType::Upper, minmn, minmn, 0.0, 1.0, &R[0], ldr );
@@ -0,0 +1,56 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef CHECK_RANDOM_HH
+#define CHECK_RANDOM_HH
+
+#include "blas.hh"
+#include "lapack.hh"
+
+#include <cmath>
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// Randomized (Freivalds-style) residual estimates, for `tester --check f`.
+// Instead of forming an n-by-n residual such as R = A - U S V^H in O(n^3),
+// apply it to a few random probe vectors X in O(n^2), since for probes with
+// i.i.d. zero-mean entries, E[ ||R X||_F^2 ] = ||R||_F^2 E[ ||X||_F^2 ] / n.
+
+/// Number of random probe vectors. With 3 Gaussian probes, the estimate is
+/// within a factor of 2 or so of ||R||_F, which is plenty to tell an
+/// O(eps) residual from a wrong answer.
+const int64_t check_nprobes = 3;
+
+// -----------------------------------------------------------------------------
+// Fills n-by-nprobes X with Gaussian random probes.
+// Uses a fixed seed, so checks are reproducible.
+template< typename scalar_t >
+void check_random_probes( int64_t n, std::vector< scalar_t >& X )
+{
+    int64_t idist = 3;  // normal(0, 1)
+    int64_t iseed[4] = { 0, 0, 0, 1 };
+    X.resize( n * check_nprobes );
+    lapack::larnv( idist, iseed, X.size(), &X[0] );
+}
+
+// -----------------------------------------------------------------------------
+// Given n-by-nprobes probes X and m-by-nprobes Y = R X,
+// returns estimate of ||R||_F, where R is m-by-n.
+template< typename scalar_t >
+blas::real_type< scalar_t > check_random_norm(
+    int64_t m, int64_t n,
+    std::vector< scalar_t > const& X,
+    std::vector< scalar_t > const& Y )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    real_t Xnorm = lapack::lange( lapack::Norm::Fro, n, check_nprobes, &X[0], n );
+    real_t Ynorm = lapack::lange( lapack::Norm::Fro, m, check_nprobes, &Y[0], m );
+    if (Xnorm == 0)
+        return 0;
+    return Ynorm / Xnorm * std::sqrt( real_t( n ) );
+}
+
+#endif  // CHECK_RANDOM_HH
@@ -17,6 +17,9 @@
 // result[1] = || I - U^H U || / m,   if jobu  != NoVec.
 // result[2] = || I - VT VT^H || / n, if jobvt != NoVec.
 // result[3] = 0 if S has non-negative values in non-increasing order, else 1.
+//
+// If fast, results 0-2 are randomized estimates using Frobenius norms,
+// computed in O(mn) instead of O(mn min(m,n)); see check_random.hh.
 template< typename scalar_t >
 void check_svd(
     lapack::Job jobu, lapack::Job jobvt,
@@ -25,7 +28,8 @@ void check_svd(
     blas::real_type< scalar_t > const* s,
     scalar_t const* U,  int64_t ldu,
     scalar_t const* VT, int64_t ldvt,
-    blas::real_type< scalar_t > result[4] )
+    blas::real_type< scalar_t > result[4],
+    bool fast = false )
 {
     using namespace blas;
     using namespace lapack;
@@ -40,7 +44,30 @@ void check_svd(
     int64_t minmn = min( m, n );
     int64_t maxmn = max( m, n );
 
-    if (U != nullptr && VT != nullptr) {
+    if (U != nullptr && VT != nullptr && fast) {
+        // estimate || A - U diag(S) VT ||_F / (||A||_F max(m,n))
+        // Y = A X - U (diag(S) (VT X)), where X is n-by-nprobes
+        std::vector< scalar_t > X, T( minmn * check_nprobes ),
+                                Y( m * check_nprobes );
+        check_random_probes( n, X );
+        gemm( Layout::ColMajor, Op::NoTrans, Op::NoTrans, minmn, check_nprobes, n,
+              1.0, VT, ldvt, &X[0], n, 0.0, &T[0], minmn );
+        for (int64_t j = 0; j < check_nprobes; ++j) {
+            for (int64_t i = 0; i < minmn; ++i) {
+                T[ i + j*minmn ] *= s[i];
+            }
+        }
+        gemm( Layout::ColMajor, Op::NoTrans, Op::NoTrans, m, check_nprobes, n,
+              1.0, A, lda, &X[0], n, 0.0, &Y[0], m );
+        gemm( Layout::ColMajor, Op::NoTrans, Op::NoTrans, m, check_nprobes, minmn,
+              -1.0, U, ldu, &T[0], minmn, 1.0, &Y[0], m );
+
+        real_t Anorm = lange( Norm::Fro, m, n, A, lda );
+        real_t resid = check_random_norm( m, n, X, Y );
+        result[0] = (Anorm > 0 ? resid / Anorm / maxmn
+                               : 1 / std::numeric_limits< real_t >::epsilon());
+    }
+    else if (U != nullptr && VT != nullptr) {
         // check || A - U diag(S) VT || / (||A|| max(m,n))
         // R = A
         std::vector< scalar_t > R( m * n );
@@ -95,13 +122,13 @@ void check_svd(
     if (U != nullptr) {
         // check || I - U^H U || / m
         int64_t ucols = (jobu == Job::AllVec ? m : minmn);
-        result[1] = check_orthogonality( RowCol::Col, m, ucols, U, ldu );
+        result[1] = check_orthogonality( RowCol::Col, m, ucols, U, ldu, fast );
     }
 
     if (VT != nullptr) {
         // check || I - VT VT^H || / n
         int64_t vrows = (jobvt == Job::AllVec ? n : minmn);
-        result[2] = check_orthogonality( RowCol::Row, vrows, n, VT, ldvt );
+        result[2] = check_orthogonality( RowCol::Row, vrows, n, VT, ldvt, fast );
     }
 
     // check s >= 0 and s is non-increasing
@@ -0,0 +1,290 @@
+#!/usr/bin/env python
+#
+# Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+# SPDX-License-Identifier: BSD-3-Clause
+# This program is free software: you can redistribute it and/or modify it under
+# the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+#
+# Compares two sets of tester results, written by `tester --output`
+# or `run_tests.py --output`, and flags statistically significant slowdowns.
+#
+# Example usage:
+# record baseline and new results, e.g., before and after a BLAS/LAPACK upgrade
+#     ./run_tests.py --output old.json --repeat 5 getrf potrf
+#     ./run_tests.py --output new.json --repeat 5 getrf potrf
+#
+# compare; exit status is 1 if any routine has a significant slowdown, else 0
+#     ./compare_results.py old.json new.json
+#
+# Tests are matched by routine and input parameters (type, dims, uplo, ...),
+# ignoring host, backend, date, etc., which are expected to differ.
+#
+# Each test is flagged if it is slower than --threshold and, when both sets
+# have repeats (tester --repeat), a one-sided Welch t-test gives p < --alpha.
+# Each routine is flagged if the geometric mean of new/old time over its
+# tests is slower than --threshold and a one-sided t-test of the log ratios
+# gives p < --alpha, so consistent small slowdowns across sizes are caught
+# even without repeats.
+
+from __future__ import print_function
+
+import sys
+import io
+import csv
+import json
+import math
+import argparse
+
+# ------------------------------------------------------------------------------
+# command line arguments
+parser = argparse.ArgumentParser()
+parser.add_argument( 'old', help='baseline results, JSON lines or *.csv' )
+parser.add_argument( 'new', help='new results, JSON lines or *.csv' )
+parser.add_argument( '--metric', action='store', default='time',
+    help='output field to compare, where lower is better, e.g., time, ref_time, call_ns, latency_p99, workspace_mib; default %(default)s' )
+parser.add_argument( '--threshold', action='store', type=float, default=0.05,
+    help='relative slowdown to flag, e.g., 0.05 is 5%% slower; default %(default)s' )
+parser.add_argument( '--alpha', action='store', type=float, default=0.05,
+    help='significance level for t-tests; default %(default)s' )
+parser.add_argument( '--min-time', action='store', type=float, default=0,
+    help='ignore tests where both old and new means are below this; default %(default)s' )
+parser.add_argument( '-v', '--verbose', action='store_true',
+    help='print every test, not only flagged ones' )
+opts = parser.parse_args()
+
+# Fields that describe the run or are outputs, rather than identifying a test.
+# Everything else in a record is part of the test's key.
+non_key_fields = set([
+    # host & build
+    'date', 'host', 'os', 'cpu', 'lapackpp', 'id', 'backend', 'threads',
+    'iter',
+    # outputs
+    'error', 'error2', 'error3', 'error4', 'error5',
+    'ortho', 'ortho_U', 'ortho_V', 'error_sigma',
+    'time', 'gflops', 'gbytes', 'iters',
+    'ref_time', 'ref_gflops', 'ref_gbytes', 'ref_iters',
+    'gflops_pct', 'gbytes_pct', 'roofline_pct', 'bound',
+    'workspace_mib', 'rss_mib',
+    'throughput', 'latency_p50', 'latency_p99',
+    'call_ns', 'nothrow_ns', 'inline_ns', 'ref_call_ns', 'overhead_ns',
+    'driver', 'nb_out',
+    'okay',
+])
+
+# ------------------------------------------------------------------------------
+# Reads results file. Returns list of records (dicts).
+# CSV fields are all strings; empty fields are dropped to match JSON.
+def read_results( filename ):
+    records = []
+    with io.open( filename, encoding='utf-8' ) as f:
+        if (filename.endswith( '.csv' )):
+            for row in csv.DictReader( f ):
+                rec = {}
+                for (name, value) in row.items():
+                    if (value != ''):
+                        rec[ name ] = value
+                records.append( rec )
+        else:
+            for (lineno, line) in enumerate( f, 1 ):
+                line = line.strip()
+                if (line):
+                    try:
+                        records.append( json.loads( line ) )
+                    except ValueError as ex:
+                        print( '%s:%d: skipping bad record: %s'
+                               % (filename, lineno, ex), file=sys.stderr )
+    return records
+# end
+
+# ------------------------------------------------------------------------------
+# Returns key identifying a test: routine and input parameters,
+# as a sorted tuple of (name, value) strings.
+def test_key( rec ):
+    return tuple( sorted( (name, str( value ))
+                          for (name, value) in rec.items()
+                          if name not in non_key_fields ) )
+# end
+
+# ------------------------------------------------------------------------------
+# Groups records by test key. Returns dict key => list of metric values.
+def group( records, metric ):
+    groups = {}
+    for rec in records:
+        value = rec.get( metric )
+        if (value is None):
+            continue
+        value = float( value )
+        if (not (value > 0) or math.isinf( value )):
+            continue
+        groups.setdefault( test_key( rec ), [] ).append( value )
+    return groups
+# end
+
+# ------------------------------------------------------------------------------
+# Statistics, without depending on scipy.
+
+def mean( x ):
+    return sum( x ) / len( x )
+
+def variance( x ):
+    m = mean( x )
+    return sum( (xi - m)**2 for xi in x ) / (len( x ) - 1)
+
+# Continued fraction for incomplete beta function; see Numerical Recipes, betacf.
+def betacf( a, b, x ):
+    tiny = 1e-300
+    qab = a + b
+    qap = a + 1
+    qam = a - 1
+    c = 1.0
+    d = 1 - qab*x/qap
+    if (abs( d ) < tiny):
+        d = tiny
+    d = 1/d
+    h = d
+    for m in range( 1, 201 ):
+        m2 = 2*m
+        aa = m*(b - m)*x / ((qam + m2)*(a + m2))
+        d = 1 + aa*d
+        if (abs( d ) < tiny):
+            d = tiny
+        c = 1 + aa/c
+        if (abs( c ) < tiny):
+            c = tiny
+        d = 1/d
+        h *= d*c
+        aa = -(a + m)*(qab + m)*x / ((a + m2)*(qap + m2))
+        d = 1 + aa*d
+        if (abs( d ) < tiny):
+            d = tiny
+        c = 1 + aa/c
+        if (abs( c ) < tiny):
+            c = tiny
+        d = 1/d
+        delta = d*c
+        h *= delta
+        if (abs( delta - 1 ) < 1e-12):
+            break
+    return h
+# end
+
+# Regularized incomplete beta function I_x(a, b).
+def betainc( a, b, x ):
+    if (x <= 0):
+        return 0.0
+    if (x >= 1):
+        return 1.0
+    lbeta = (math.lgamma( a + b ) - math.lgamma( a ) - math.lgamma( b )
+             + a*math.log( x ) + b*math.log( 1 - x ))
+    if (x < (a + 1) / (a + b + 2)):
+        return math.exp( lbeta ) * betacf( a, b, x ) / a
+    else:
+        return 1 - math.exp( lbeta ) * betacf( b, a, 1 - x ) / b
+# end
+
+# One-sided p-value, P(T > t), for Student's t with df degrees of freedom.
+def t_sf( t, df ):
+    p = 0.5 * betainc( df/2., 0.5, df / (df + t*t) )
+    return p if (t > 0) else 1 - p
+# end
+
+# One-sided Welch t-test that mean( new ) > mean( old ).
+# Returns p-value, or None if there are too few samples.
+def welch_p( old, new ):
+    n1 = len( old )
+    n2 = len( new )
+    if (n1 < 2 or n2 < 2):
+        return None
+    v1 = variance( old ) / n1
+    v2 = variance( new ) / n2
+    if (v1 + v2 == 0):
+        return 0.0 if (mean( new ) > mean( old )) else 1.0
+    t = (mean( new ) - mean( old )) / math.sqrt( v1 + v2 )
+    df = (v1 + v2)**2 / (v1**2/(n1 - 1) + v2**2/(n2 - 1))
+    return t_sf( t, df )
+# end
+
+# One-sided one-sample t-test that mean( x ) > 0.
+# Returns p-value, or None if there are too few samples.
+def one_sample_p( x ):
+    n = len( x )
+    if (n < 2):
+        return None
+    v = variance( x ) / n
+    if (v == 0):
+        return 0.0 if (mean( x ) > 0) else 1.0
+    return t_sf( mean( x ) / math.sqrt( v ), n - 1 )
+# end
+
+# ------------------------------------------------------------------------------
+def format_key( key ):
+    routine = dict( key ).get( 'routine', '?' )
+    return routine + ' ' + ' '.join( name + '=' + value
+                                     for (name, value) in key
+                                     if name != 'routine' )
+# end
+
+def format_p( p ):
+    return '    n/a' if (p is None) else '%7.4f' % p
+# end
+
+# ------------------------------------------------------------------------------
+old = group( read_results( opts.old ), opts.metric )
+new = group( read_results( opts.new ), opts.metric )
+
+common = sorted( set( old.keys() ) & set( new.keys() ) )
+only_old = len( set( old.keys() ) - set( new.keys() ) )
+only_new = len( set( new.keys() ) - set( old.keys() ) )
+if (not common):
+    print( 'No tests in common with', opts.metric, 'between', opts.old,
+           'and', opts.new )
+    exit( 1 )
+
+slow = 1 + opts.threshold
+
+# per-test comparison
+print( '%-10s  %10s  %10s  %7s  %7s  %s'
+       % ('status', 'old', 'new', 'ratio', 'p', 'test') )
+routines = {}
+nflagged_tests = 0
+for key in common:
+    m_old = mean( old[ key ] )
+    m_new = mean( new[ key ] )
+    if (m_old < opts.min_time and m_new < opts.min_time):
+        continue
+    ratio = m_new / m_old
+    p = welch_p( old[ key ], new[ key ] )
+    flagged = (ratio > slow and (p is None or p < opts.alpha))
+    nflagged_tests += flagged
+    routines.setdefault( dict( key )[ 'routine' ], [] ).append( ratio )
+    if (flagged or opts.verbose):
+        print( '%-10s  %10.4g  %10.4g  %7.3f  %s  %s'
+               % ('SLOWER' if flagged else 'ok', m_old, m_new, ratio,
+                  format_p( p ), format_key( key )) )
+
+# per-routine summary
+print()
+print( '%-10s  %7s  %7s  %7s  %s'
+       % ('status', 'tests', 'geomean', 'p', 'routine') )
+nflagged_routines = 0
+for routine in sorted( routines.keys() ):
+    log_ratios = [ math.log( r ) for r in routines[ routine ] ]
+    geomean = math.exp( mean( log_ratios ) )
+    p = one_sample_p( log_ratios )
+    flagged = (geomean > slow and (p is None or p < opts.alpha))
+    nflagged_routines += flagged
+    print( '%-10s  %7d  %7.3f  %s  %s'
+           % ('SLOWER' if flagged else 'ok', len( log_ratios ), geomean,
+              format_p( p ), routine) )
+
+print()
+print( 'Compared %d tests (%s); %d only in %s, %d only in %s.'
+       % (len( common ), opts.metric, only_old, opts.old, only_new, opts.new) )
+if (nflagged_routines or nflagged_tests):
+    print( '%d routines and %d tests significantly slower (> %.1f%%, alpha %g).'
+           % (nflagged_routines, nflagged_tests, 100*opts.threshold, opts.alpha) )
+else:
+    print( 'No significant slowdowns.' )
+
+# status is 0 or 1, since exit status wraps modulo 256
+exit( 1 if nflagged_routines else 0 )
@@ -0,0 +1,361 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include <complex>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#if defined( _WIN32 )
+    #include <process.h>
+    #define getpid _getpid
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+#include "matrix_file.hh"
+
+namespace lapack {
+
+// -----------------------------------------------------------------------------
+/// Read-only view of a whole file. Uses mmap where available, so reading
+/// a matrix touches each page once, copying straight into the
+/// caller's array, with no intermediate buffer; elsewhere, reads the file.
+class MappedFile
+{
+public:
+    explicit MappedFile( std::string const& filename ):
+        data_( nullptr ),
+        size_( 0 )
+    {
+    #if defined( _WIN32 )
+        FILE* file = fopen( filename.c_str(), "rb" );
+        if (file == nullptr)
+            throw std::runtime_error( "can't open " + filename );
+        fseek( file, 0, SEEK_END );
+        size_ = ftell( file );
+        fseek( file, 0, SEEK_SET );
+        buffer_.resize( size_ );
+        size_t got = (size_ > 0 ? fread( &buffer_[0], 1, size_, file ) : 0);
+        fclose( file );
+        if (got != size_)
+            throw std::runtime_error( "can't read " + filename );
+        data_ = buffer_.data();
+    #else
+        int fd = open( filename.c_str(), O_RDONLY );
+        if (fd < 0)
+            throw std::runtime_error( "can't open " + filename );
+        struct stat st;
+        if (fstat( fd, &st ) != 0) {
+            close( fd );
+            throw std::runtime_error( "can't stat " + filename );
+        }
+        size_ = st.st_size;
+        if (size_ > 0) {
+            void* ptr = mmap( nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0 );
+            if (ptr == MAP_FAILED) {
+                close( fd );
+                throw std::runtime_error( "can't mmap " + filename );
+            }
+            data_ = (char const*) ptr;
+        }
+        close( fd );
+    #endif
+    }
+
+    ~MappedFile()
+    {
+    #if ! defined( _WIN32 )
+        if (data_ != nullptr)
+            munmap( (void*) data_, size_ );
+    #endif
+    }
+
+    char const* data() const { return data_; }
+    size_t size() const { return size_; }
+
+private:
+    // disable copying; would double munmap
+    MappedFile( MappedFile const& ) = delete;
+    MappedFile& operator=( MappedFile const& ) = delete;
+
+    char const* data_;
+    size_t size_;
+#if defined( _WIN32 )
+    std::vector< char > buffer_;
+#endif
+};
+
+// -----------------------------------------------------------------------------
+// npy type descriptor, e.g., '<f8', for each scalar type.
+template< typename T > const char* npy_descr();
+template<> const char* npy_descr< float  >() { return "<f4"; }
+template<> const char* npy_descr< double >() { return "<f8"; }
+template<> const char* npy_descr< std::complex<float>  >() { return "<c8"; }
+template<> const char* npy_descr< std::complex<double> >() { return "<c16"; }
+
+// Converts file entry to scalar_t. Complex to real is an error,
+// caught by npy_copy before copying.
+template< typename scalar_t, typename file_t >
+inline scalar_t npy_convert( file_t x ) { return scalar_t( x ); }
+
+template<>
+inline float npy_convert< float, std::complex<double> >( std::complex<double> x )
+    { return float( x.real() ); }
+
+template<>
+inline float npy_convert< float, std::complex<float> >( std::complex<float> x )
+    { return x.real(); }
+
+template<>
+inline double npy_convert< double, std::complex<double> >( std::complex<double> x )
+    { return x.real(); }
+
+template<>
+inline double npy_convert< double, std::complex<float> >( std::complex<float> x )
+    { return double( x.real() ); }
+
+// -----------------------------------------------------------------------------
+// Copies leading m-by-n block of file_m-by-file_n file data to A.
+// If fortran, data is column-major, else row-major (C order).
+// Entries need not be aligned in the file, so copy with memcpy.
+template< typename scalar_t, typename file_t >
+void npy_copy(
+    char const* data, bool fortran, int64_t file_m, int64_t file_n,
+    int64_t m, int64_t n, scalar_t* A, int64_t lda )
+{
+    if (fortran && std::is_same< scalar_t, file_t >::value) {
+        // same type and layout: straight column copies
+        for (int64_t j = 0; j < n; ++j) {
+            std::memcpy( &A[ j*lda ], data + j*file_m*sizeof(file_t),
+                         m*sizeof(file_t) );
+        }
+        return;
+    }
+    for (int64_t j = 0; j < n; ++j) {
+        for (int64_t i = 0; i < m; ++i) {
+            int64_t k = (fortran ? i + j*file_m : i*file_n + j);
+            file_t x;
+            std::memcpy( &x, data + k*sizeof(file_t), sizeof(file_t) );
+            A[ i + j*lda ] = npy_convert< scalar_t >( x );
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Returns value of key in npy header dict, e.g., for header
+// "{'descr': '<f8', 'fortran_order': False, 'shape': (3, 4), }"
+// and key "shape", returns "(3, 4)".
+static std::string npy_header_value( std::string const& header, std::string const& key )
+{
+    size_t pos = header.find( "'" + key + "'" );
+    if (pos == std::string::npos)
+        return "";
+    pos = header.find( ':', pos );
+    if (pos == std::string::npos)
+        return "";
+    pos = header.find_first_not_of( ' ', pos + 1 );
+    if (pos == std::string::npos)
+        return "";
+    size_t end = (header[ pos ] == '(')
+               ? header.find( ')', pos ) + 1
+               : header.find_first_of( ",}", pos );
+    return header.substr( pos, end - pos );
+}
+
+// -----------------------------------------------------------------------------
+/// Reads leading m-by-n block of a NumPy .npy file into A.
+/// The file can be float32, float64, complex64, or complex128 (little
+/// endian), in either Fortran (column-major) or C (row-major) order,
+/// with 1 or 2 dimensions. Entries are converted to scalar_t;
+/// complex files can be read only into complex matrices.
+///
+/// If throw_on_error is false, returns false instead of throwing
+/// when the file can't be read, e.g., for a cache miss.
+///
+/// @ingroup generate_matrix
+template< typename scalar_t >
+bool read_npy(
+    std::string const& filename,
+    int64_t m, int64_t n,
+    scalar_t* A, int64_t lda,
+    bool throw_on_error )
+{
+    try {
+        MappedFile file( filename );
+        char const* data = file.data();
+        size_t size = file.size();
+
+        // magic, version, header length
+        if (size < 10 || std::memcmp( data, "\x93NUMPY", 6 ) != 0)
+            throw std::runtime_error( filename + ": not an npy file" );
+        int major = (unsigned char) data[ 6 ];
+        size_t header_len, offset;
+        if (major == 1) {
+            header_len = (unsigned char) data[ 8 ]
+                       | (unsigned char) data[ 9 ] << 8;
+            offset = 10;
+        }
+        else {
+            if (size < 12)
+                throw std::runtime_error( filename + ": truncated npy header" );
+            header_len = (unsigned char) data[  8 ]
+                       | (unsigned char) data[  9 ] << 8
+                       | (unsigned char) data[ 10 ] << 16
+                       | size_t( (unsigned char) data[ 11 ] ) << 24;
+            offset = 12;
+        }
+        if (offset + header_len > size)
+            throw std::runtime_error( filename + ": truncated npy header" );
+        std::string header( data + offset, header_len );
+        data += offset + header_len;
+        size -= offset + header_len;
+
+        std::string descr   = npy_header_value( header, "descr" );
+        std::string fortran = npy_header_value( header, "fortran_order" );
+        std::string shape   = npy_header_value( header, "shape" );
+
+        // shape is (m,) or (m, n)
+        long long file_m = 0, file_n = 1;
+        int ndim = sscanf( shape.c_str(), "(%lld, %lld", &file_m, &file_n );
+        if (ndim < 1 || (ndim == 1 && shape.find( ',' ) == std::string::npos))
+            throw std::runtime_error( filename + ": can't parse shape " + shape );
+        if (ndim == 1)
+            file_n = 1;
+        if (file_m < m || file_n < n) {
+            char msg[ 80 ];
+            snprintf( msg, sizeof(msg), ": file is %lld-by-%lld, need %lld-by-%lld",
+                      file_m, file_n, (long long) m, (long long) n );
+            throw std::runtime_error( filename + msg );
+        }
+
+        bool is_fortran = (fortran == "True");
+        bool is_complex = blas::is_complex< scalar_t >::value;
+        size_t elem;
+        if      (descr == "'<f4'" ) elem = 4;
+        else if (descr == "'<f8'" ) elem = 8;
+        else if (descr == "'<c8'" ) elem = 8;
+        else if (descr == "'<c16'") elem = 16;
+        else
+            throw std::runtime_error( filename + ": unsupported npy type " + descr
+                                      + "; need <f4, <f8, <c8, or <c16" );
+        if (descr[ 2 ] == 'c' && ! is_complex)
+            throw std::runtime_error( filename + ": complex file for real matrix" );
+        if (size < size_t( file_m * file_n ) * elem)
+            throw std::runtime_error( filename + ": truncated npy data" );
+
+        if (descr == "'<f4'")
+            npy_copy< scalar_t, float >( data, is_fortran, file_m, file_n, m, n, A, lda );
+        else if (descr == "'<f8'")
+            npy_copy< scalar_t, double >( data, is_fortran, file_m, file_n, m, n, A, lda );
+        else if (descr == "'<c8'")
+            npy_copy< scalar_t, std::complex<float> >( data, is_fortran, file_m, file_n, m, n, A, lda );
+        else
+            npy_copy< scalar_t, std::complex<double> >( data, is_fortran, file_m, file_n, m, n, A, lda );
+    }
+    catch (std::exception const&) {
+        if (throw_on_error)
+            throw;
+        return false;
+    }
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+/// Reads leading m-by-n block of a matrix file into A, for
+/// `--matrix file:path`. Files ending in .npy are NumPy files (see read_npy);
+/// other files are raw, column-major arrays of scalar_t, with at least
+/// m-by-n entries, read as m-by-n.
+///
+/// @ingroup generate_matrix
+template< typename scalar_t >
+void read_matrix_file(
+    std::string const& filename,
+    int64_t m, int64_t n,
+    scalar_t* A, int64_t lda )
+{
+    size_t len = filename.size();
+    if (len >= 4 && filename.compare( len - 4, 4, ".npy" ) == 0) {
+        read_npy( filename, m, n, A, lda );
+    }
+    else {
+        MappedFile file( filename );
+        if (file.size() < size_t( m*n ) * sizeof(scalar_t))
+            throw std::runtime_error( filename + ": raw file too small for matrix" );
+        npy_copy< scalar_t, scalar_t >( file.data(), true, m, n, m, n, A, lda );
+    }
+}
+
+// -----------------------------------------------------------------------------
+/// Writes m-by-n A to a NumPy .npy file, in Fortran order, so read_npy
+/// can copy it by columns. Writes to a temporary file and renames it,
+/// so concurrent testers sharing a cache never see a partial file.
+///
+/// @ingroup generate_matrix
+template< typename scalar_t >
+void write_npy(
+    std::string const& filename,
+    int64_t m, int64_t n,
+    scalar_t const* A, int64_t lda )
+{
+    char dict[ 128 ];
+    snprintf( dict, sizeof(dict),
+              "{'descr': '%s', 'fortran_order': True, 'shape': (%lld, %lld), }",
+              npy_descr< scalar_t >(), (long long) m, (long long) n );
+
+    // pad with spaces and \n so data is 64-byte aligned
+    std::string header( dict );
+    size_t total = 10 + header.size() + 1;
+    header.append( (64 - total % 64) % 64, ' ' );
+    header += '\n';
+
+    std::string tmp = filename + ".tmp" + std::to_string( getpid() );
+    FILE* file = fopen( tmp.c_str(), "wb" );
+    if (file == nullptr)
+        throw std::runtime_error( "can't write " + tmp );
+    unsigned char preamble[ 10 ] = {
+        0x93, 'N', 'U', 'M', 'P', 'Y', 1, 0,
+        (unsigned char) (header.size() & 0xff),
+        (unsigned char) (header.size() >> 8) };
+    bool okay = fwrite( preamble, 1, 10, file ) == 10
+             && fwrite( header.data(), 1, header.size(), file ) == header.size();
+    for (int64_t j = 0; okay && j < n; ++j) {
+        okay = fwrite( &A[ j*lda ], sizeof(scalar_t), m, file ) == size_t( m );
+    }
+    okay = (fclose( file ) == 0) && okay;
+    if (! okay || rename( tmp.c_str(), filename.c_str() ) != 0) {
+        remove( tmp.c_str() );
+        throw std::runtime_error( "can't write " + filename );
+    }
+}
+
+// -----------------------------------------------------------------------------
+// explicit instantiations
+#define LAPACK_MATRIX_FILE_INSTANTIATE( scalar_t ) \
+    template void read_matrix_file( \
+        std::string const& filename, int64_t m, int64_t n, \
+        scalar_t* A, int64_t lda ); \
+    template bool read_npy( \
+        std::string const& filename, int64_t m, int64_t n, \
+        scalar_t* A, int64_t lda, bool throw_on_error ); \
+    template void write_npy( \
+        std::string const& filename, int64_t m, int64_t n, \
+        scalar_t const* A, int64_t lda );
+
+LAPACK_MATRIX_FILE_INSTANTIATE( float )
+LAPACK_MATRIX_FILE_INSTANTIATE( double )
+LAPACK_MATRIX_FILE_INSTANTIATE( std::complex<float> )
+LAPACK_MATRIX_FILE_INSTANTIATE( std::complex<double> )
+
+#undef LAPACK_MATRIX_FILE_INSTANTIATE
+
+} // namespace lapack
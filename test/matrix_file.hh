@@ -0,0 +1,37 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef MATRIX_FILE_HH
+#define MATRIX_FILE_HH
+
+#include <string>
+
+#include "lapack.hh"
+
+namespace lapack {
+
+// -----------------------------------------------------------------------------
+template< typename scalar_t >
+void read_matrix_file(
+    std::string const& filename,
+    int64_t m, int64_t n,
+    scalar_t* A, int64_t lda );
+
+template< typename scalar_t >
+bool read_npy(
+    std::string const& filename,
+    int64_t m, int64_t n,
+    scalar_t* A, int64_t lda,
+    bool throw_on_error=true );
+
+template< typename scalar_t >
+void write_npy(
+    std::string const& filename,
+    int64_t m, int64_t n,
+    scalar_t const* A, int64_t lda );
+
+} // namespace lapack
+
+#endif        // #ifndef MATRIX_FILE_HH
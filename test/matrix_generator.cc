@@ -8,9 +8,13 @@
 #include <vector>
 #include <limits>
 #include <complex>
+#include <thread>
+#include <cmath>
+#include <cstdint>
 
 #include "matrix_params.hh"
 #include "matrix_generator.hh"
+#include "matrix_file.hh"
 
 // -----------------------------------------------------------------------------
 // ANSI color codes
@@ -44,6 +48,305 @@ std::vector< std::string >
 // =============================================================================
 namespace lapack {
 
+// -----------------------------------------------------------------------------
+/// Calls func( begin, end ) on blocks of [ 0, n ), in parallel using
+/// std::threads if there are enough entries (total work) to pay off.
+///
+/// Internal function, called from generate_rand() and butterfly transforms.
+///
+/// @ingroup generate_matrix
+template< typename func_t >
+void parallel_blocks( int64_t n, int64_t entries, func_t func )
+{
+    const int64_t min_entries_per_thread = 64*1024;
+    int64_t nthreads = std::min( int64_t( std::thread::hardware_concurrency() ),
+                                 entries / min_entries_per_thread );
+    nthreads = std::max( std::min( nthreads, n ), int64_t( 1 ) );
+    if (nthreads == 1) {
+        func( 0, n );
+    }
+    else {
+        std::vector< std::thread > threads;
+        for (int64_t t = 0; t < nthreads; ++t) {
+            threads.push_back( std::thread(
+                func, n * t / nthreads, n * (t + 1) / nthreads ) );
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+/// Philox-4x32-10 counter-based random number generator
+/// [Salmon et al., Parallel random numbers: as easy as 1, 2, 3, SC 2011].
+/// Encrypts counter ctr with key, returning 4 random 32-bit words.
+/// Each output depends only on (key, ctr), so any entry of a random matrix
+/// can be computed independently of all others.
+///
+/// Internal function, called from generate_rand().
+///
+/// @ingroup generate_matrix
+inline void philox4x32(
+    uint32_t const ctr[4], uint32_t const key[2], uint32_t out[4] )
+{
+    const uint64_t M0 = 0xD2511F53, M1 = 0xCD9E8D57;
+    const uint32_t W0 = 0x9E3779B9, W1 = 0xBB67AE85;
+
+    uint32_t c0 = ctr[0], c1 = ctr[1], c2 = ctr[2], c3 = ctr[3];
+    uint32_t k0 = key[0], k1 = key[1];
+    for (int round = 0; round < 10; ++round) {
+        uint64_t p0 = M0 * c0;
+        uint64_t p1 = M1 * c2;
+        c0 = uint32_t( p1 >> 32 ) ^ c1 ^ k0;
+        c1 = uint32_t( p1 );
+        c2 = uint32_t( p0 >> 32 ) ^ c3 ^ k1;
+        c3 = uint32_t( p0 );
+        k0 += W0;
+        k1 += W1;
+    }
+    out[0] = c0;
+    out[1] = c1;
+    out[2] = c2;
+    out[3] = c3;
+}
+
+// -----------------------------------------------------------------------------
+/// Converts 2 random 32-bit words to uniform on (0, 1), with 53 random bits.
+/// Never returns exactly 0 or 1, as with larnv.
+template< typename real_t >
+inline real_t philox_uniform( uint32_t a, uint32_t b )
+{
+    const double scale = 1.0 / 9007199254740992.0;  // 2^-53
+    double u = ((uint64_t( a >> 5 ) << 26 | (b >> 6)) + 0.5) * scale;
+    // rounding to float could give 1
+    const real_t one_minus = std::nextafter( real_t( 1 ), real_t( 0 ) );
+    return std::min( real_t( u ), one_minus );
+}
+
+// -----------------------------------------------------------------------------
+/// Converts 4 random 32-bit words to 2 random values from larnv's
+/// distribution idist: 1 = uniform (0, 1), 2 = uniform (-1, 1),
+/// 3 = normal (0, 1), using Box-Muller.
+template< typename real_t >
+inline void philox_values(
+    int64_t idist, uint32_t const x[4], real_t& v0, real_t& v1 )
+{
+    double u0 = philox_uniform< double >( x[0], x[1] );
+    double u1 = philox_uniform< double >( x[2], x[3] );
+    if (idist == idist_rand) {
+        v0 = philox_uniform< real_t >( x[0], x[1] );
+        v1 = philox_uniform< real_t >( x[2], x[3] );
+    }
+    else if (idist == idist_rands) {
+        v0 = real_t( 2*u0 - 1 );
+        v1 = real_t( 2*u1 - 1 );
+    }
+    else {
+        const double twopi = 6.2831853071795864769;
+        double r = std::sqrt( -2 * std::log( u0 ) );
+        v0 = real_t( r * std::cos( twopi * u1 ) );
+        v1 = real_t( r * std::sin( twopi * u1 ) );
+    }
+}
+
+// Real entries use one value; complex entries use both.
+template< typename real_t >
+inline void philox_set( real_t& a, real_t v0, real_t v1 )
+{
+    a = v0;
+}
+
+template< typename real_t >
+inline void philox_set( std::complex< real_t >& a, real_t v0, real_t v1 )
+{
+    a = std::complex< real_t >( v0, v1 );
+}
+
+// -----------------------------------------------------------------------------
+/// Fills m-by-n matrix A with random entries from larnv's distribution idist
+/// (idist_rand, idist_rands, or idist_randn; complex entries have random
+/// real and imaginary parts, as with larnv).
+///
+/// Unlike larnv, this uses the counter-based Philox RNG: entry (i, j) uses
+/// counter i + j*m and a key from params.iseed, so large matrices are filled
+/// by column blocks in parallel, and the result is bit-for-bit the same
+/// regardless of the number of threads. Advances params.iseed so the next
+/// call gets a different key.
+///
+/// Internal function, called from generate_matrix().
+///
+/// @ingroup generate_matrix
+template< typename scalar_t >
+void generate_rand(
+    MatrixParams& params, int64_t idist,
+    int64_t m, int64_t n, scalar_t* A, int64_t lda )
+{
+    using real_t = blas::real_type<scalar_t>;
+
+    // iseed entries are in [0, 4095]; pack into 2 x 24-bit key
+    uint32_t key[2] = { uint32_t( params.iseed[0] << 12 | params.iseed[1] ),
+                        uint32_t( params.iseed[2] << 12 | params.iseed[3] ) };
+
+    // advance iseed by 2 as a 48-bit integer, keeping iseed[3] odd
+    params.iseed[3] += 2;
+    for (int i = 3; i > 0 && params.iseed[i] >= 4096; --i) {
+        params.iseed[i] -= 4096;
+        params.iseed[i-1] += 1;
+    }
+    params.iseed[0] %= 4096;
+
+    // fills columns [ j_begin, j_end )
+    auto fill = [=]( int64_t j_begin, int64_t j_end ) {
+        uint32_t ctr[4] = { 0, 0, 0, 0 }, x[4];
+        real_t v0, v1;
+        for (int64_t j = j_begin; j < j_end; ++j) {
+            for (int64_t i = 0; i < m; ++i) {
+                uint64_t index = uint64_t( i + j*m );
+                ctr[0] = uint32_t( index );
+                ctr[1] = uint32_t( index >> 32 );
+                philox4x32( ctr, key, x );
+                philox_values( idist, x, v0, v1 );
+                philox_set( A[ i + j*lda ], v0, v1 );
+            }
+        }
+    };
+
+    // each thread gets a block of columns
+    parallel_blocks( n, m*n, fill );
+}
+
+// -----------------------------------------------------------------------------
+/// Random orthogonal (unitary) n-by-n butterfly transform,
+/// $Q = P_L \cdots P_1 \Phi$, where $\Phi$ is diagonal with random signs
+/// (real) or random unit-modulus phases (complex), and each level $P_l$
+/// rotates disjoint pairs of entries (i, i + s) by random angles,
+/// for strides s = 1, 2, 4, ..., as in an FFT network.
+/// For n a power of 2, these log2(n) levels make Q dense; otherwise,
+/// the levels are repeated in reverse order so every entry mixes.
+/// Applying Q costs O(n log n) per vector, versus O(n^2) for a product
+/// of n Householder reflectors, but Q is not Haar distributed.
+///
+/// Internal class, used by generate_svd() and generate_heev() for _fast.
+///
+/// @ingroup generate_matrix
+template< typename scalar_t >
+class Butterfly
+{
+public:
+    using real_t = blas::real_type<scalar_t>;
+
+    Butterfly( MatrixParams& params, int64_t n ):
+        n_( n )
+    {
+        for (int64_t s = 1; s < n; s *= 2) {
+            strides_.push_back( s );
+        }
+        if (n & (n - 1)) {
+            // not a power of 2
+            for (int64_t l = int64_t( strides_.size() ) - 2; l >= 0; --l) {
+                strides_.push_back( strides_[ l ] );
+            }
+        }
+
+        // random angles in [0, 2 pi), indexed by first entry i of each pair
+        int64_t nlevels = strides_.size();
+        const real_t twopi = 2 * 3.14159265358979323846;
+        std::vector< real_t > theta( std::max( n * nlevels, int64_t( 1 ) ) );
+        generate_rand( params, idist_rand, n, nlevels, &theta[0], n );
+        cos_.resize( theta.size() );
+        sin_.resize( theta.size() );
+        for (size_t i = 0; i < theta.size(); ++i) {
+            cos_[ i ] = cos( twopi * theta[ i ] );
+            sin_[ i ] = sin( twopi * theta[ i ] );
+        }
+
+        // random signs or phases
+        std::vector< scalar_t > phi( std::max( n, int64_t( 1 ) ) );
+        generate_rand( params, idist_rands, n, 1, &phi[0], n );
+        phase_.resize( n );
+        for (int64_t i = 0; i < n; ++i) {
+            phase_[ i ] = (phi[ i ] == scalar_t( 0 ) ? 1 : phi[ i ] / std::abs( phi[ i ] ));
+        }
+    }
+
+    /// Overwrites m-by-n_ A with Q A (left), applying Q to each column.
+    void apply_left( int64_t ncol, scalar_t* A, int64_t lda ) const
+    {
+        parallel_blocks( ncol, ncol * n_ * strides_.size(),
+            [=]( int64_t j_begin, int64_t j_end ) {
+                for (int64_t j = j_begin; j < j_end; ++j) {
+                    scalar_t* x = &A[ j*lda ];
+                    for (int64_t i = 0; i < n_; ++i) {
+                        x[ i ] *= phase_[ i ];
+                    }
+                    for (size_t l = 0; l < strides_.size(); ++l) {
+                        int64_t s = strides_[ l ];
+                        real_t const* c  = &cos_[ l*n_ ];
+                        real_t const* sn = &sin_[ l*n_ ];
+                        for (int64_t base = 0; base < n_ - s; base += 2*s) {
+                            int64_t end = std::min( base + s, n_ - s );
+                            for (int64_t i = base; i < end; ++i) {
+                                scalar_t xi = x[ i ], xs = x[ i + s ];
+                                x[ i     ] =  c[ i ]*xi + sn[ i ]*xs;
+                                x[ i + s ] = -sn[ i ]*xi + c[ i ]*xs;
+                            }
+                        }
+                    }
+                }
+            } );
+    }
+
+    /// Overwrites nrow-by-n_ A with A Q^H (right), applying Q to each row.
+    /// Rows are done in small blocks so pairs of columns are contiguous
+    /// within a block and the block stays in cache across levels.
+    void apply_right( int64_t nrow, scalar_t* A, int64_t lda ) const
+    {
+        const int64_t nb = 16;
+        int64_t nblocks = (nrow + nb - 1) / nb;
+        parallel_blocks( nblocks, nrow * n_ * strides_.size(),
+            [=]( int64_t b_begin, int64_t b_end ) {
+                for (int64_t b = b_begin; b < b_end; ++b) {
+                    int64_t r0 = b*nb;
+                    int64_t r1 = std::min( r0 + nb, nrow );
+                    for (int64_t i = 0; i < n_; ++i) {
+                        scalar_t ph = conj( phase_[ i ] );
+                        for (int64_t r = r0; r < r1; ++r) {
+                            A[ r + i*lda ] *= ph;
+                        }
+                    }
+                    for (size_t l = 0; l < strides_.size(); ++l) {
+                        int64_t s = strides_[ l ];
+                        real_t const* c  = &cos_[ l*n_ ];
+                        real_t const* sn = &sin_[ l*n_ ];
+                        for (int64_t base = 0; base < n_ - s; base += 2*s) {
+                            int64_t end = std::min( base + s, n_ - s );
+                            for (int64_t i = base; i < end; ++i) {
+                                scalar_t* ai = &A[ i*lda ];
+                                scalar_t* as = &A[ (i + s)*lda ];
+                                for (int64_t r = r0; r < r1; ++r) {
+                                    scalar_t xi = ai[ r ], xs = as[ r ];
+                                    ai[ r ] =  c[ i ]*xi + sn[ i ]*xs;
+                                    as[ r ] = -sn[ i ]*xi + c[ i ]*xs;
+                                }
+                            }
+                        }
+                    }
+                }
+            } );
+    }
+
+private:
+    // For real, conj would return complex.
+    static real_t conj( real_t x ) { return x; }
+    static std::complex<real_t> conj( std::complex<real_t> x ) { return std::conj( x ); }
+
+    int64_t n_;
+    std::vector< int64_t > strides_;
+    std::vector< real_t > cos_, sin_;
+    std::vector< scalar_t > phase_;
+};
+
 // -----------------------------------------------------------------------------
 /// Generates sigma vector of singular or eigenvalues, according to distribution.
 ///
@@ -123,7 +426,7 @@ void generate_sigma(
 
         case Dist::logrand: {
             real_t range = log( 1/cond );
-            lapack::larnv( idist_rand, params.iseed, sigma.n, sigma(0) );
+            generate_rand( params, idist_rand, sigma.n, 1, sigma(0), sigma.n );
             for (int64_t i = 0; i < minmn; ++i) {
                 sigma[i] = exp( sigma[i] * range );
             }
@@ -139,7 +442,7 @@ void generate_sigma(
         case Dist::rands:
         case Dist::rand: {
             int64_t idist = (int64_t) dist;
-            lapack::larnv( idist, params.iseed, sigma.n, sigma(0) );
+            generate_rand( params, idist, sigma.n, 1, sigma(0), sigma.n );
             break;
         }
 
@@ -160,8 +463,10 @@ void generate_sigma(
 
     if (rand_sign) {
         // apply random signs
+        Vector<real_t> signs( minmn );
+        generate_rand( params, idist_rand, minmn, 1, signs(0), minmn );
         for (int64_t i = 0; i < minmn; ++i) {
-            if (rand() > RAND_MAX/2) {
+            if (signs[i] > 0.5) {
                 sigma[i] = -sigma[i];
             }
         }
@@ -244,7 +549,7 @@ void generate_correlation_factor( Matrix<std::complex<double>>& A )
 template< typename scalar_t >
 void generate_svd(
     MatrixParams& params,
-    Dist dist,
+    Dist dist, bool fast,
     blas::real_type<scalar_t> cond,
     blas::real_type<scalar_t> condD,
     blas::real_type<scalar_t> sigma_max,
@@ -258,10 +563,7 @@ void generate_svd(
     int64_t n = A.n;
     int64_t maxmn = std::max( m, n );
     int64_t minmn = std::min( m, n );
-    int64_t sizeU;
     int64_t info = 0;
-    Matrix<scalar_t> U( maxmn, minmn );
-    Vector<scalar_t> tau( minmn );
 
     // ----------
     generate_sigma( params, dist, false, cond, sigma_max, A, sigma );
@@ -278,32 +580,43 @@ void generate_svd(
         }
     }
 
-    // random U, m-by-minmn
-    // just make each random column into a Householder vector;
-    // no need to update subsequent columns (as in geqrf).
-    sizeU = U.size();
-    lapack::larnv( idist_randn, params.iseed, sizeU, U(0,0) );
-    for (int64_t j = 0; j < minmn; ++j) {
-        int64_t mj = m - j;
-        lapack::larfg( mj, U(j,j), U(j+1,j), 1, tau(j) );
+    if (fast) {
+        // A = U*A*V^H, with random butterfly U, m-by-m, and V, n-by-n
+        Butterfly<scalar_t> U( params, m );
+        U.apply_left( A.n, A(0,0), A.ld );
+        Butterfly<scalar_t> V( params, n );
+        V.apply_right( A.m, A(0,0), A.ld );
     }
+    else {
+        Matrix<scalar_t> U( maxmn, minmn );
+        Vector<scalar_t> tau( minmn );
+
+        // random U, m-by-minmn
+        // just make each random column into a Householder vector;
+        // no need to update subsequent columns (as in geqrf).
+        generate_rand( params, idist_randn, U.m, U.n, U(0,0), U.ld );
+        for (int64_t j = 0; j < minmn; ++j) {
+            int64_t mj = m - j;
+            lapack::larfg( mj, U(j,j), U(j+1,j), 1, tau(j) );
+        }
 
-    // A = U*A
-    lapack::unmqr( lapack::Side::Left, lapack::Op::NoTrans, A.m, A.n, minmn,
-                   U(0,0), U.ld, tau(0), A(0,0), A.ld );
-    require( info == 0 );
+        // A = U*A
+        lapack::unmqr( lapack::Side::Left, lapack::Op::NoTrans, A.m, A.n, minmn,
+                       U(0,0), U.ld, tau(0), A(0,0), A.ld );
+        require( info == 0 );
 
-    // random V, n-by-minmn (stored column-wise in U)
-    lapack::larnv( idist_randn, params.iseed, sizeU, U(0,0) );
-    for (int64_t j = 0; j < minmn; ++j) {
-        int64_t nj = n - j;
-        lapack::larfg( nj, U(j,j), U(j+1,j), 1, tau(j) );
-    }
+        // random V, n-by-minmn (stored column-wise in U)
+        generate_rand( params, idist_randn, U.m, U.n, U(0,0), U.ld );
+        for (int64_t j = 0; j < minmn; ++j) {
+            int64_t nj = n - j;
+            lapack::larfg( nj, U(j,j), U(j+1,j), 1, tau(j) );
+        }
 
-    // A = A*V^H
-    lapack::unmqr( lapack::Side::Right, lapack::Op::ConjTrans, A.m, A.n, minmn,
-                   U(0,0), U.ld, tau(0), A(0,0), A.ld );
-    require( info == 0 );
+        // A = A*V^H
+        lapack::unmqr( lapack::Side::Right, lapack::Op::ConjTrans, A.m, A.n, minmn,
+                       U(0,0), U.ld, tau(0), A(0,0), A.ld );
+        require( info == 0 );
+    }
 
     if (condD != 1) {
         // A = A*W, W orthogonal, such that A has unit column norms
@@ -313,7 +626,7 @@ void generate_svd(
         // A = A*D col scaling
         Vector<real_t> D( A.n );
         real_t range = log( condD );
-        lapack::larnv( idist_rand, params.iseed, D.n, D(0) );
+        generate_rand( params, idist_rand, D.n, 1, D(0), D.n );
         for (int64_t i = 0; i < D.n; ++i) {
             D[i] = exp( D[i] * range );
         }
@@ -342,7 +655,7 @@ void generate_svd(
 template< typename scalar_t >
 void generate_heev(
     MatrixParams& params,
-    Dist dist, bool rand_sign,
+    Dist dist, bool rand_sign, bool fast,
     blas::real_type<scalar_t> cond,
     blas::real_type<scalar_t> condD,
     blas::real_type<scalar_t> sigma_max,
@@ -356,33 +669,47 @@ void generate_heev(
 
     // locals
     int64_t n = A.n;
-    int64_t sizeU;
     int64_t info = 0;
-    Matrix<scalar_t> U( n, n );
-    Vector<scalar_t> tau( n );
 
     // ----------
     generate_sigma( params, dist, rand_sign, cond, sigma_max, A, sigma );
 
-    // random U, n-by-n
-    // just make each random column into a Householder vector;
-    // no need to update subsequent columns (as in geqrf).
-    sizeU = U.size();
-    lapack::larnv( idist_randn, params.iseed, sizeU, U(0,0) );
-    for (int64_t j = 0; j < n; ++j) {
-        int64_t nj = n - j;
-        lapack::larfg( nj, U(j,j), U(j+1,j), 1, tau(j) );
+    if (fast) {
+        // A = U*A*U^H, with random butterfly U, n-by-n
+        Butterfly<scalar_t> U( params, n );
+        U.apply_left( n, A(0,0), A.ld );
+        U.apply_right( n, A(0,0), A.ld );
+
+        // rounding differs in the two sides; make exactly Hermitian
+        for (int64_t j = 0; j < n; ++j) {
+            for (int64_t i = j + 1; i < n; ++i) {
+                *A(j,i) = blas::conj( *A(i,j) );
+            }
+        }
     }
+    else {
+        Matrix<scalar_t> U( n, n );
+        Vector<scalar_t> tau( n );
 
-    // A = U*A
-    lapack::unmqr( lapack::Side::Left, lapack::Op::NoTrans, n, n, n,
-                   U(0,0), U.ld, tau(0), A(0,0), A.ld );
-    require( info == 0 );
+        // random U, n-by-n
+        // just make each random column into a Householder vector;
+        // no need to update subsequent columns (as in geqrf).
+        generate_rand( params, idist_randn, U.m, U.n, U(0,0), U.ld );
+        for (int64_t j = 0; j < n; ++j) {
+            int64_t nj = n - j;
+            lapack::larfg( nj, U(j,j), U(j+1,j), 1, tau(j) );
+        }
 
-    // A = A*U^H
-    lapack::unmqr( lapack::Side::Right, lapack::Op::ConjTrans, n, n, n,
-                   U(0,0), U.ld, tau(0), A(0,0), A.ld );
-    require( info == 0 );
+        // A = U*A
+        lapack::unmqr( lapack::Side::Left, lapack::Op::NoTrans, n, n, n,
+                       U(0,0), U.ld, tau(0), A(0,0), A.ld );
+        require( info == 0 );
+
+        // A = A*U^H
+        lapack::unmqr( lapack::Side::Right, lapack::Op::ConjTrans, n, n, n,
+                       U(0,0), U.ld, tau(0), A(0,0), A.ld );
+        require( info == 0 );
+    }
 
     // make diagonal real
     // usually LAPACK ignores imaginary part anyway, but Matlab doesn't
@@ -394,7 +721,7 @@ void generate_heev(
         // A = D*A*D row & column scaling
         Vector<real_t> D( n );
         real_t range = log( condD );
-        lapack::larnv( idist_rand, params.iseed, n, D(0) );
+        generate_rand( params, idist_rand, n, 1, D(0), n );
         for (int64_t i = 0; i < n; ++i) {
             D[i] = exp( D[i] * range );
         }
@@ -408,8 +735,13 @@ void generate_heev(
 
 // -----------------------------------------------------------------------------
 /// Generates matrix using general eigenvalue decomposition, $A = V T V^H$,
-/// with orthogonal eigenvectors.
-/// Not yet implemented.
+/// with orthogonal V.
+/// Implemented only for _fast, where V is a random butterfly and
+/// T is upper bidiagonal with eigenvalues Lambda = diag(T) and a random
+/// superdiagonal, making A non-normal. Superdiagonal entries are at most
+/// half the smallest gap between eigenvalues, so eigenvectors stay well
+/// conditioned and computed eigenvalues match sigma; with repeated
+/// eigenvalues (e.g., _cluster0), T is diagonal.
 ///
 /// Internal function, called from generate_matrix().
 ///
@@ -417,13 +749,42 @@ void generate_heev(
 template< typename scalar_t >
 void generate_geev(
     MatrixParams& params,
-    Dist dist,
+    Dist dist, bool fast,
     blas::real_type<scalar_t> cond,
     blas::real_type<scalar_t> sigma_max,
     Matrix<scalar_t>& A,
     Vector< blas::real_type<scalar_t> >& sigma )
 {
-    throw std::exception();  // not implemented
+    if (! fast)
+        throw std::exception();  // not implemented
+
+    // check inputs
+    require( A.m == A.n );
+
+    int64_t n = A.n;
+
+    using real_t = blas::real_type<scalar_t>;
+
+    // T = Lambda + random superdiagonal
+    generate_sigma( params, dist, true, cond, sigma_max, A, sigma );
+    if (n > 1) {
+        std::vector< real_t > lambda( sigma(0), sigma(0) + n );
+        std::sort( lambda.begin(), lambda.end() );
+        real_t gap = lambda[ n-1 ] - lambda[ 0 ];
+        for (int64_t i = 0; i < n - 1; ++i) {
+            gap = std::min( gap, lambda[ i+1 ] - lambda[ i ] );
+        }
+        std::vector< scalar_t > super( n - 1 );
+        generate_rand( params, idist_rands, n - 1, 1, &super[0], n - 1 );
+        for (int64_t i = 0; i < n - 1; ++i) {
+            *A(i,i+1) = real_t( 0.5 ) * gap * super[ i ];
+        }
+    }
+
+    // A = V*T*V^H
+    Butterfly<scalar_t> V( params, n );
+    V.apply_left( n, A(0,0), A.ld );
+    V.apply_right( n, A(0,0), A.ld );
 }
 
 // -----------------------------------------------------------------------------
@@ -446,6 +807,29 @@ void generate_geevx(
     throw std::exception();  // not implemented
 }
 
+// -----------------------------------------------------------------------------
+/// Returns cache file name, without .npy extension, for matrix with given
+/// params and dimensions. The key is kind, cond, condD, dimensions,
+/// data type, and seed, e.g.,
+/// dir/svd_geo-cond1e+06-condD1-100x200-d-seed98.108.97.115
+///
+/// Internal function, called from generate_matrix().
+///
+/// @ingroup generate_matrix
+template< typename scalar_t >
+std::string matrix_cache_file( MatrixParams& params, int64_t m, int64_t n )
+{
+    char type = blas::is_complex< scalar_t >::value
+              ? (sizeof(scalar_t) == 8 ? 'c' : 'z')
+              : (sizeof(scalar_t) == 4 ? 's' : 'd');
+    char buf[ 256 ];
+    snprintf( buf, sizeof(buf), "-cond%.6g-condD%.6g-%lldx%lld-%c-seed%lld.%lld.%lld.%lld",
+              params.cond(), params.condD(), (long long) m, (long long) n, type,
+              (long long) params.iseed[0], (long long) params.iseed[1],
+              (long long) params.iseed[2], (long long) params.iseed[3] );
+    return params.cache_dir + "/" + params.kind() + buf;
+}
+
 // -----------------------------------------------------------------------------
 void generate_matrix_usage()
 {
@@ -472,7 +856,7 @@ void generate_matrix_usage()
     "spd^@     |  alias for poev\n"
     "heev^@    |  A = V Lambda V^H (eigenvalues mixed signs)\n"
     "syev^@    |  alias for heev\n"
-    "geev^@    |  A = V T V^H, Schur-form T                       [not yet implemented]\n"
+    "geev^@    |  A = V T V^H, Schur-form T                       [only with _fast]\n"
     "geevx^@   |  A = X T X^{-1}, Schur-form T, X ill-conditioned [not yet implemented]\n"
     "\n"
     "^ and @ denote optional suffixes described below.\n"
@@ -503,7 +887,15 @@ void generate_matrix_usage()
     "\n"
     "%s@ Modifier%s      |  %sDescription%s\n"
     "----------------|-------------\n"
+    "_fast           |  random butterfly U, V; O(n^2 log n) instead of O(n^3) (svd, poev, heev, geev)\n"
     "_dominant       |  make matrix diagonally dominant\n"
+    "\n"
+    "%sfile:path%s reads the leading m-by-n block of a matrix file instead:\n"
+    "path.npy        |  NumPy file, float32/64 or complex64/128, C or Fortran order\n"
+    "other path      |  raw column-major array of the test's data type\n"
+    "\n"
+    "%s--matrix-cache dir%s caches generated matrices in dir, keyed by\n"
+    "matrix, cond, condD, dimensions, data type, and seed.\n"
     "\n",
         ansi_bold, ansi_normal,
         ansi_bold, ansi_normal,
@@ -513,6 +905,8 @@ void generate_matrix_usage()
         ansi_bold, ansi_normal,
         ansi_bold, ansi_normal,
         ansi_bold, ansi_normal,
+        ansi_bold, ansi_normal,
+        ansi_bold, ansi_normal,
         ansi_bold, ansi_normal
     );
 }
@@ -542,7 +936,17 @@ void generate_matrix_usage()
 /// tables below. As indicated, kinds take an optional distribution suffix (^)
 /// and an optional scaling and modifier suffix (@).
 /// The default distribution is logrand.
-/// Examples: rand, rand_small, svd_arith, heev_geo_small.
+/// Examples: rand, rand_small, svd_arith, heev_geo_small, svd_geo_fast.
+///
+/// Alternatively, matrix = file:path reads the leading m-by-n block of a
+/// file, to replay captured or production matrices; see read_matrix_file().
+/// Then sigma is unknown (NaN).
+///
+/// If params.cache_dir is set (`tester --matrix-cache dir`), generated
+/// matrices and sigma are saved in dir as .npy files, keyed by kind, cond,
+/// condD, dimensions, data type, and seed, and read back on later runs
+/// instead of being regenerated. Either way, params.iseed is then set from
+/// the key, so subsequent matrices are the same on cache hits and misses.
 ///
 /// The **cond** parameter specifies the condition number $cond(S)$, where $S$ is either
 /// the singular values $\Sigma$ or the eigenvalues $\Lambda$, as described by the
@@ -594,7 +998,7 @@ void generate_matrix_usage()
 /// spd^@    | alias for poev
 /// heev^@   | $A = V \Lambda V^H$ (eigenvalues mixed signs)
 /// syev^@   | alias for heev
-/// geev^@   | $A = V T V^H$, Schur-form $T$                         [not yet implemented]
+/// geev^@   | $A = V T V^H$, Schur-form $T$                         [only with _fast]
 /// geevx^@  | $A = X T X^{-1}$, Schur-form $T$, $X$ ill-conditioned [not yet implemented]
 ///
 /// Note for geev that $cond(\Lambda)$ is specified, where $\Lambda = diag(T)$;
@@ -636,6 +1040,7 @@ void generate_matrix_usage()
 ///
 /// @ Modifier      |  Description
 /// ----------------|-------------
+/// _fast           |  $U$ and $V$ are random butterfly transforms, applied in $O(n^2 \log n)$ instead of $O(n^3)$; svd, poev, heev, geev only
 /// _dominant       |  diagonally dominant: set $A_{i,i} = \pm \max_i( \sum_j |A_{i,j}|, \sum_j |A_{j,i}| )$.
 ///
 /// Note _dominant changes the singular or eigenvalues, and the condition number.
@@ -689,6 +1094,13 @@ void generate_matrix(
     // set sigma to unknown (nan)
     lapack::laset( lapack::MatrixType::General, sigma.n, 1, nan, nan, sigma(0), sigma.n );
 
+    // ----- read matrix from file, e.g., file:A.npy
+    if (kind.compare( 0, 5, "file:" ) == 0) {
+        read_matrix_file( kind.substr( 5 ), A.m, A.n, A(0,0), A.ld );
+        params.cond_used() = testsweeper::no_data_flag;
+        return;
+    }
+
     // ----- decode matrix type
     auto token = tokens.begin();
     if (token == tokens.end()) {
@@ -789,6 +1201,30 @@ void generate_matrix(
         }
     }
 
+    // ----- decode fast modifier
+    bool fast = false;
+    if (token != tokens.end()) {
+        suffix = *token;
+        if (suffix == "fast") {
+            fast = true;
+
+            // move to next token
+            ++token;
+
+            // error if matrix type doesn't support it
+            if (! (type == TestMatrixType::svd   ||
+                   type == TestMatrixType::poev  ||
+                   type == TestMatrixType::heev  ||
+                   type == TestMatrixType::geev))
+            {
+                fprintf( stderr, "%sError in '%s': matrix '%s' doesn't support"
+                         " fast suffix.%s\n",
+                         ansi_red, kind.c_str(), base.c_str(), ansi_normal );
+                throw std::exception();
+            }
+        }
+    }
+
     // ----- decode modifier
     bool dominant = false;
     if (token != tokens.end()) {
@@ -892,6 +1328,34 @@ void generate_matrix(
                  ansi_red, kind.c_str(), ansi_normal );
     }
 
+    // ----- read from cache, if enabled and present
+    std::string cache_file;
+    int64_t iseed_next[4];
+    if (! params.cache_dir.empty()) {
+        cache_file = matrix_cache_file< scalar_t >( params, A.m, A.n );
+
+        // Next seed depends only on the key, so later matrices are
+        // the same whether this one is a cache hit or miss.
+        std::copy( params.iseed, params.iseed + 4, iseed_next );
+        uint32_t ctr[4] = { 0, 0, 0, 0 }, key[2] = { 0x434143, 0x4845 }, x[4];
+        for (int i = 0; i < 4; ++i) {
+            ctr[ i ] = uint32_t( iseed_next[ i ] );
+        }
+        philox4x32( ctr, key, x );
+        for (int i = 0; i < 4; ++i) {
+            iseed_next[ i ] = x[ i ] % 4096;
+        }
+        iseed_next[3] |= 1;  // must be odd
+
+        if (read_npy( cache_file + ".npy", A.m, A.n, A(0,0), A.ld, false )
+            && read_npy( cache_file + "-sigma.npy", sigma.n, 1,
+                         sigma(0), sigma.n, false ))
+        {
+            std::copy( iseed_next, iseed_next + 4, params.iseed );
+            return;
+        }
+    }
+
     // ----- generate matrix
     switch (type) {
         case TestMatrixType::zero:
@@ -917,7 +1381,7 @@ void generate_matrix(
             //int64_t idist = (int64_t) type;
             int64_t idist = 1;
             int64_t sizeA = A.ld * A.n;
-            lapack::larnv( idist, params.iseed, sizeA, A(0,0) );
+            generate_rand( params, idist, A.ld, A.n, A(0,0), A.ld );
             if (sigma_max != 1) {
                 scalar_t scale = sigma_max;
                 blas::scal( sizeA, scale, A(0,0), 1 );
@@ -930,19 +1394,19 @@ void generate_matrix(
             break;
 
         case TestMatrixType::svd:
-            generate_svd( params, dist, cond, condD, sigma_max, A, sigma );
+            generate_svd( params, dist, fast, cond, condD, sigma_max, A, sigma );
             break;
 
         case TestMatrixType::poev:
-            generate_heev( params, dist, false, cond, condD, sigma_max, A, sigma );
+            generate_heev( params, dist, false, fast, cond, condD, sigma_max, A, sigma );
             break;
 
         case TestMatrixType::heev:
-            generate_heev( params, dist, true, cond, condD, sigma_max, A, sigma );
+            generate_heev( params, dist, true, fast, cond, condD, sigma_max, A, sigma );
             break;
 
         case TestMatrixType::geev:
-            generate_geev( params, dist, cond, sigma_max, A, sigma );
+            generate_geev( params, dist, fast, cond, sigma_max, A, sigma );
             break;
 
         case TestMatrixType::geevx:
@@ -960,6 +1424,19 @@ void generate_matrix(
         // reset sigma to unknown (nan)
         lapack::laset( lapack::MatrixType::General, sigma.n, 1, nan, nan, sigma(0), sigma.n );
     }
+
+    // ----- save to cache
+    if (! cache_file.empty()) {
+        try {
+            write_npy( cache_file + ".npy", A.m, A.n, A(0,0), A.ld );
+            write_npy( cache_file + "-sigma.npy", sigma.n, 1, sigma(0), sigma.n );
+        }
+        catch (std::exception const& ex) {
+            fprintf( stderr, "%sWarning: can't cache matrix: %s%s\n",
+                     ansi_red, ex.what(), ansi_normal );
+        }
+        std::copy( iseed_next, iseed_next + 4, params.iseed );
+    }
 }
 
 
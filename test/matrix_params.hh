@@ -8,6 +8,8 @@
 
 #include "testsweeper.hh"
 
+#include <string>
+
 // =============================================================================
 class MatrixParams
 {
@@ -19,6 +21,9 @@ public:
     int64_t verbose;
     int64_t iseed[4];
 
+    // directory for caching generated matrices; empty for no cache
+    std::string cache_dir;
+
     // ---- test matrix generation parameters
     testsweeper::ParamString kind;
     testsweeper::ParamScientific cond, cond_used;
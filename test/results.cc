@@ -0,0 +1,397 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "results.hh"
+#include "lapack.hh"
+
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
+#include <stdexcept>
+#include <thread>
+
+#include <string.h>
+#include <sys/utsname.h>
+#include <unistd.h>
+
+#ifdef _OPENMP
+    #include <omp.h>
+#endif
+
+namespace {
+
+// -----------------------------------------------------------------------------
+// Returns BLAS backend, as far as can be told at compile time.
+const char* backend()
+{
+    #if defined(BLAS_HAVE_MKL)
+        return "MKL";
+    #elif defined(BLAS_HAVE_ESSL)
+        return "ESSL";
+    #elif defined(BLAS_HAVE_ACCELERATE)
+        return "Accelerate";
+    #else
+        return "generic";
+    #endif
+}
+
+// -----------------------------------------------------------------------------
+// Returns number of threads BLAS & LAPACK will use, from the backend if
+// lapack::get_num_threads can query it, else from the usual environment
+// variables, else OpenMP, else the number of hardware threads.
+int64_t num_threads()
+{
+    if (std::string( lapack::thread_backend() ) != "none")
+        return lapack::get_num_threads();
+
+    const char* vars[] = {
+        #if defined(BLAS_HAVE_MKL)
+            "MKL_NUM_THREADS",
+        #endif
+        "OPENBLAS_NUM_THREADS",
+        "OMP_NUM_THREADS",
+    };
+    for (const char* var : vars) {
+        const char* value = getenv( var );
+        if (value != nullptr && atoi( value ) > 0)
+            return atoi( value );
+    }
+    #ifdef _OPENMP
+        return omp_get_max_threads();
+    #else
+        return std::thread::hardware_concurrency();
+    #endif
+}
+
+// -----------------------------------------------------------------------------
+// Returns CPU model name from /proc/cpuinfo, or empty if not available.
+std::string cpu_name()
+{
+    std::ifstream cpuinfo( "/proc/cpuinfo" );
+    std::string line;
+    while (std::getline( cpuinfo, line )) {
+        if (line.compare( 0, 10, "model name" ) == 0) {
+            size_t pos = line.find( ':' );
+            if (pos != std::string::npos) {
+                pos = line.find_first_not_of( " \t", pos + 1 );
+                if (pos != std::string::npos)
+                    return line.substr( pos );
+            }
+        }
+    }
+    return "";
+}
+
+// -----------------------------------------------------------------------------
+std::string json_escape( std::string const& str )
+{
+    std::string out;
+    for (char ch : str) {
+        switch (ch) {
+            case '"':  out += "\\\""; break;
+            case '\\': out += "\\\\"; break;
+            case '\n': out += "\\n";  break;
+            case '\t': out += "\\t";  break;
+            default:
+                if ((unsigned char) ch < 0x20) {
+                    char buf[ 8 ];
+                    snprintf( buf, sizeof(buf), "\\u%04x", ch );
+                    out += buf;
+                }
+                else {
+                    out += ch;
+                }
+                break;
+        }
+    }
+    return out;
+}
+
+// -----------------------------------------------------------------------------
+std::string csv_escape( std::string const& str )
+{
+    if (str.find_first_of( ",\"\n" ) == std::string::npos)
+        return str;
+
+    std::string out = "\"";
+    for (char ch : str) {
+        if (ch == '"')
+            out += '"';
+        out += ch;
+    }
+    out += '"';
+    return out;
+}
+
+}  // namespace
+
+// -----------------------------------------------------------------------------
+/// Opens filename for appending; throws if it can't be opened.
+/// Gathers host & build information once, since it is the same for all records.
+ResultFile::ResultFile( std::string const& filename, const char* routine ):
+    file_( nullptr ),
+    csv_( false ),
+    routine_( routine )
+{
+    file_ = fopen( filename.c_str(), "a" );
+    if (file_ == nullptr) {
+        throw std::runtime_error( "can't open " + filename + ": "
+                                  + strerror( errno ) );
+    }
+    size_t len = filename.size();
+    csv_ = (len >= 4 && filename.compare( len - 4, 4, ".csv" ) == 0);
+    if (csv_) {
+        // existing file's header, if any, that records must follow
+        std::ifstream in( filename );
+        std::string line;
+        if (std::getline( in, line )) {
+            if (! line.empty() && line.back() == '\r')
+                line.pop_back();
+            size_t begin = 0;
+            while (begin <= line.size()) {
+                size_t end = line.find( ',', begin );
+                if (end == std::string::npos)
+                    end = line.size();
+                header_.push_back( line.substr( begin, end - begin ) );
+                begin = end + 1;
+            }
+        }
+    }
+
+    char date[ 32 ] = "";
+    time_t now = ::time( nullptr );
+    strftime( date, sizeof(date), "%Y-%m-%dT%H:%M:%SZ", gmtime( &now ) );
+
+    char host[ 256 ] = "";
+    gethostname( host, sizeof(host) );
+    host[ sizeof(host) - 1 ] = '\0';
+
+    std::string os;
+    struct utsname uts;
+    if (uname( &uts ) == 0) {
+        os = std::string( uts.sysname ) + " " + uts.release + " " + uts.machine;
+    }
+
+    int version = lapack::lapackpp_version();
+    char version_str[ 32 ];
+    snprintf( version_str, sizeof(version_str), "%d.%02d.%02d",
+              version / 10000, (version % 10000) / 100, version % 100 );
+
+    add( host_fields_, "date",      true, std::string( date ) );
+    add( host_fields_, "host",      true, std::string( host ) );
+    add( host_fields_, "os",        true, os );
+    add( host_fields_, "cpu",       true, cpu_name() );
+    add( host_fields_, "lapackpp",  true, std::string( version_str ) );
+    add( host_fields_, "id",        true, std::string( lapack::lapackpp_id() ) );
+    add( host_fields_, "backend",   true, std::string( backend() ) );
+    add( host_fields_, "threads",   true, num_threads() );
+}
+
+// -----------------------------------------------------------------------------
+ResultFile::~ResultFile()
+{
+    if (file_ != nullptr)
+        fclose( file_ );
+}
+
+// -----------------------------------------------------------------------------
+/// Adds field with value if used, else empty (null).
+void ResultFile::add(
+    std::vector< Field >& fields, const char* name, bool used,
+    std::string const& value )
+{
+    fields.push_back( { name, used ? value : "", true } );
+}
+
+void ResultFile::add(
+    std::vector< Field >& fields, const char* name, bool used, char value )
+{
+    fields.push_back( { name, used ? std::string( 1, value ) : "", true } );
+}
+
+void ResultFile::add(
+    std::vector< Field >& fields, const char* name, bool used, int64_t value )
+{
+    fields.push_back( { name, used ? std::to_string( value ) : "", false } );
+}
+
+/// Doubles that are no_data_flag, NaN, or Inf are written as null.
+void ResultFile::add(
+    std::vector< Field >& fields, const char* name, bool used, double value )
+{
+    std::string str;
+    if (used && value != testsweeper::no_data_flag && std::isfinite( value )) {
+        char buf[ 32 ];
+        snprintf( buf, sizeof(buf), "%.8g", value );
+        str = buf;
+    }
+    fields.push_back( { name, str, false } );
+}
+
+// -----------------------------------------------------------------------------
+/// Appends one record for the current test.
+/// The same fields are added for every routine, so CSV columns line up;
+/// fields the routine doesn't use are null (JSON) or empty (CSV).
+/// @throws std::runtime_error if an existing CSV file's header lacks
+/// one of the fields.
+void ResultFile::write( Params& params, int64_t iter )
+{
+    std::vector< Field > fields = host_fields_;
+
+    add( fields, "routine",    true,                     routine_ );
+    add( fields, "iter",       true,                     iter );
+
+    // ----- inputs
+    add( fields, "type",       params.datatype.used(),   testsweeper::datatype2char( params.datatype() ) );
+    add( fields, "layout",     params.layout.used(),     blas::layout2char( params.layout() ) );
+    add( fields, "side",       params.side.used(),       blas::side2char( params.side() ) );
+    add( fields, "itype",      params.itype.used(),      params.itype() );
+    add( fields, "uplo",       params.uplo.used(),       blas::uplo2char( params.uplo() ) );
+    add( fields, "trans",      params.trans.used(),      blas::op2char( params.trans() ) );
+    add( fields, "transA",     params.transA.used(),     blas::op2char( params.transA() ) );
+    add( fields, "transB",     params.transB.used(),     blas::op2char( params.transB() ) );
+    add( fields, "diag",       params.diag.used(),       blas::diag2char( params.diag() ) );
+    add( fields, "norm",       params.norm.used(),       lapack::norm2char( params.norm() ) );
+    add( fields, "direction",  params.direction.used(),  lapack::direction2char( params.direction() ) );
+    add( fields, "storev",     params.storev.used(),     lapack::storev2char( params.storev() ) );
+    add( fields, "jobz",       params.jobz.used(),       lapack::job2char( params.jobz() ) );
+    add( fields, "jobvl",      params.jobvl.used(),      lapack::job2char( params.jobvl() ) );
+    add( fields, "jobvr",      params.jobvr.used(),      lapack::job2char( params.jobvr() ) );
+    add( fields, "jobu",       params.jobu.used(),       lapack::job2char( params.jobu() ) );
+    add( fields, "jobvt",      params.jobvt.used(),      lapack::job2char( params.jobvt() ) );
+    add( fields, "matrixtype", params.matrixtype.used(), lapack::matrixtype2char( params.matrixtype() ) );
+    add( fields, "factored",   params.factored.used(),   lapack::factored2char( params.factored() ) );
+    add( fields, "equed",      params.equed.used(),      lapack::equed2char( params.equed() ) );
+
+    add( fields, "m",          params.dim.used(),        params.dim.m() );
+    add( fields, "n",          params.dim.used(),        params.dim.n() );
+    add( fields, "k",          params.dim.used(),        params.dim.k() );
+    add( fields, "i",          params.i.used(),          params.i() );
+    add( fields, "l",          params.l.used(),          params.l() );
+    add( fields, "ka",         params.ka.used(),         params.ka() );
+    add( fields, "kb",         params.kb.used(),         params.kb() );
+    add( fields, "kd",         params.kd.used(),         params.kd() );
+    add( fields, "kl",         params.kl.used(),         params.kl() );
+    add( fields, "ku",         params.ku.used(),         params.ku() );
+    add( fields, "nrhs",       params.nrhs.used(),       params.nrhs() );
+    add( fields, "nb",         params.nb.used(),         params.nb() );
+    add( fields, "vl",         params.vl.used(),         params.vl() );
+    add( fields, "vu",         params.vu.used(),         params.vu() );
+    add( fields, "il",         params.il.used(),         params.il() );
+    add( fields, "iu",         params.iu.used(),         params.iu() );
+    add( fields, "fraction_start", params.fraction_start.used(), params.fraction_start() );
+    add( fields, "fraction",   params.fraction.used(),   params.fraction() );
+    add( fields, "alpha",      params.alpha.used(),      params.alpha() );
+    add( fields, "beta",       params.beta.used(),       params.beta() );
+    add( fields, "incx",       params.incx.used(),       params.incx() );
+    add( fields, "incy",       params.incy.used(),       params.incy() );
+    add( fields, "align",      params.align.used(),      params.align() );
+    add( fields, "device",     params.device.used(),     params.device() );
+    add( fields, "matrix",     params.matrix.kind.used(),  params.matrix.kind() );
+    add( fields, "cond",       params.matrix.kind.used(),  params.matrix.cond_used() );
+    add( fields, "matrixB",    params.matrixB.kind.used(), params.matrixB.kind() );
+    add( fields, "condB",      params.matrixB.kind.used(), params.matrixB.cond_used() );
+    add( fields, "concurrent", params.concurrent.used(), params.concurrent() );
+
+    // ----- outputs
+    add( fields, "error",       params.error.used(),       params.error() );
+    add( fields, "error2",      params.error2.used(),      params.error2() );
+    add( fields, "error3",      params.error3.used(),      params.error3() );
+    add( fields, "error4",      params.error4.used(),      params.error4() );
+    add( fields, "error5",      params.error5.used(),      params.error5() );
+    add( fields, "ortho",       params.ortho.used(),       params.ortho() );
+    add( fields, "ortho_U",     params.ortho_U.used(),     params.ortho_U() );
+    add( fields, "ortho_V",     params.ortho_V.used(),     params.ortho_V() );
+    add( fields, "error_sigma", params.error_sigma.used(), params.error_sigma() );
+    add( fields, "time",        params.time.used(),        params.time() );
+    add( fields, "gflops",      params.gflops.used(),      params.gflops() );
+    add( fields, "gbytes",      params.gbytes.used(),      params.gbytes() );
+    add( fields, "iters",       params.iters.used(),       params.iters() );
+    add( fields, "ref_time",    params.ref_time.used(),    params.ref_time() );
+    add( fields, "ref_gflops",  params.ref_gflops.used(),  params.ref_gflops() );
+    add( fields, "ref_gbytes",  params.ref_gbytes.used(),  params.ref_gbytes() );
+    add( fields, "ref_iters",   params.ref_iters.used(),   params.ref_iters() );
+    add( fields, "gflops_pct",  params.gflops_pct.used(),  params.gflops_pct() );
+    add( fields, "gbytes_pct",  params.gbytes_pct.used(),  params.gbytes_pct() );
+    add( fields, "roofline_pct", params.roofline_pct.used(), params.roofline_pct() );
+    add( fields, "bound",       params.bound.used(),       params.bound() );
+    add( fields, "workspace_mib", params.workspace_mib.used(), params.workspace_mib() );
+    add( fields, "rss_mib",     params.rss_mib.used(),     params.rss_mib() );
+    add( fields, "throughput",  params.throughput.used(),  params.throughput() );
+    add( fields, "latency_p50", params.latency_p50.used(), params.latency_p50() );
+    add( fields, "latency_p99", params.latency_p99.used(), params.latency_p99() );
+    add( fields, "call_ns",     params.call_ns.used(),     params.call_ns() );
+    add( fields, "nothrow_ns",  params.nothrow_ns.used(),  params.nothrow_ns() );
+    add( fields, "inline_ns",   params.inline_ns.used(),   params.inline_ns() );
+    add( fields, "ref_call_ns", params.ref_call_ns.used(), params.ref_call_ns() );
+    add( fields, "overhead_ns", params.overhead_ns.used(), params.overhead_ns() );
+    add( fields, "driver",      params.driver.used(),      params.driver() );
+    add( fields, "nb_out",      params.nb_out.used(),      params.nb_out() );
+    // okay is -1 for no check
+    add( fields, "okay",        params.okay() >= 0,        params.okay() );
+
+    write_record( fields );
+}
+
+// -----------------------------------------------------------------------------
+void ResultFile::write_record( std::vector< Field > const& fields )
+{
+    if (csv_) {
+        if (header_.empty()) {
+            // new file: write header
+            const char* sep = "";
+            for (auto& field : fields) {
+                fprintf( file_, "%s%s", sep, field.name.c_str() );
+                header_.push_back( field.name );
+                sep = ",";
+            }
+            fprintf( file_, "\n" );
+        }
+
+        // map fields to the header's columns; columns this tester doesn't
+        // write, e.g., from a newer build, are empty
+        std::vector< std::string const* > values( header_.size(), nullptr );
+        for (auto& field : fields) {
+            auto iter = std::find( header_.begin(), header_.end(), field.name );
+            if (iter == header_.end()) {
+                throw std::runtime_error(
+                    "results file header has no '" + field.name + "' column;"
+                    " it was written by a different tester version;"
+                    " use a new --output file" );
+            }
+            values[ iter - header_.begin() ] = &field.value;
+        }
+        const char* sep = "";
+        for (auto value : values) {
+            fprintf( file_, "%s%s", sep,
+                     value ? csv_escape( *value ).c_str() : "" );
+            sep = ",";
+        }
+        fprintf( file_, "\n" );
+    }
+    else {
+        // JSON lines; omit null fields to keep records short
+        const char* sep = "";
+        fprintf( file_, "{" );
+        for (auto& field : fields) {
+            if (field.value.empty())
+                continue;
+            if (field.quote) {
+                fprintf( file_, "%s\"%s\": \"%s\"", sep, field.name.c_str(),
+                         json_escape( field.value ).c_str() );
+            }
+            else {
+                fprintf( file_, "%s\"%s\": %s", sep, field.name.c_str(),
+                         field.value.c_str() );
+            }
+            sep = ", ";
+        }
+        fprintf( file_, "}\n" );
+    }
+    fflush( file_ );
+}
@@ -0,0 +1,68 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef RESULTS_HH
+#define RESULTS_HH
+
+#include "test.hh"
+
+#include <stdio.h>
+
+#include <string>
+#include <vector>
+
+// -----------------------------------------------------------------------------
+/// Machine-readable record of tester results, written by `tester --output`
+/// and read by compare_results.py.
+///
+/// Each test appends one record with the routine, its used input parameters,
+/// its outputs (time, Gflop/s, error, ...), and host & build information
+/// (host, cpu, LAPACK++ version, BLAS backend, thread count).
+/// Files named *.csv get CSV with a header row; all other files get
+/// JSON lines, one object per record. The file is appended to,
+/// so several tester runs can share one file. When appending to an existing
+/// CSV file, records follow its header's columns; if this tester writes a
+/// column the header lacks, e.g., from an older build, write throws.
+///
+class ResultFile
+{
+public:
+    ResultFile( std::string const& filename, const char* routine );
+    ~ResultFile();
+
+    void write( Params& params, int64_t iter );
+
+private:
+    // A field's value is formatted when added; empty means null.
+    struct Field
+    {
+        std::string name;
+        std::string value;
+        bool quote;
+    };
+
+    void add( std::vector< Field >& fields, const char* name, bool used,
+              std::string const& value );
+    void add( std::vector< Field >& fields, const char* name, bool used,
+              char value );
+    void add( std::vector< Field >& fields, const char* name, bool used,
+              int64_t value );
+    void add( std::vector< Field >& fields, const char* name, bool used,
+              double value );
+
+    void write_record( std::vector< Field > const& fields );
+
+    // disable copying; would double fclose
+    ResultFile( ResultFile const& ) = delete;
+    ResultFile& operator=( ResultFile const& ) = delete;
+
+    FILE* file_;
+    bool csv_;
+    std::vector< std::string > header_;
+    std::string routine_;
+    std::vector< Field > host_fields_;
+};
+
+#endif  // RESULTS_HH
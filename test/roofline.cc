@@ -0,0 +1,187 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "roofline.hh"
+#include "lapack/flops.hh"
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace {
+
+// -----------------------------------------------------------------------------
+// Returns index into peak_gflops_ for datatype.
+int datatype_index( testsweeper::DataType datatype )
+{
+    switch (datatype) {
+        case testsweeper::DataType::Single:        return 0;
+        case testsweeper::DataType::Double:        return 1;
+        case testsweeper::DataType::SingleComplex: return 2;
+        case testsweeper::DataType::DoubleComplex: return 3;
+        default:
+            throw blas::Error( "roofline: unsupported datatype" );
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Returns Gflop/s of square gemm, doubling n until a call takes at least
+// 0.1 sec (or n = 8192), then keeping the best of 3 calls.
+template< typename scalar_t >
+double gemm_gflops()
+{
+    std::vector< scalar_t > A, B, C;
+    int64_t n = 256;
+    double time = 0;
+    for (;;) {
+        size_t size = (size_t) n * n;
+        A.assign( size, scalar_t( 0.5 ) );
+        B.assign( size, scalar_t( 0.25 ) );
+        C.assign( size, scalar_t( 0 ) );
+        time = testsweeper::get_wtime();
+        blas::gemm( blas::Layout::ColMajor, blas::Op::NoTrans, blas::Op::NoTrans,
+                    n, n, n, 1.0, &A[0], n, &B[0], n, 0.0, &C[0], n );
+        time = testsweeper::get_wtime() - time;
+        if (time >= 0.1 || n >= 8192)
+            break;
+        n *= 2;
+    }
+
+    double gflop = lapack::Gflop< scalar_t >::gemm( n, n, n );
+    double best = gflop / time;
+    for (int trial = 0; trial < 3; ++trial) {
+        time = testsweeper::get_wtime();
+        blas::gemm( blas::Layout::ColMajor, blas::Op::NoTrans, blas::Op::NoTrans,
+                    n, n, n, 1.0, &A[0], n, &B[0], n, 0.0, &C[0], n );
+        time = testsweeper::get_wtime() - time;
+        best = std::max( best, gflop / time );
+    }
+    return best;
+}
+
+// -----------------------------------------------------------------------------
+// Returns Gbyte/s of STREAM triad, a = b + s*c, counting 3 words per entry
+// as STREAM does. Each array is at least 4x the cache size.
+// Uses all hardware threads, each initializing (first touch) and
+// updating its own slice, since one core can't saturate memory bandwidth.
+double triad_gbytes( int64_t cache_size_mib )
+{
+    int64_t n = std::max( 4 * cache_size_mib * 1024 * 1024 / int64_t( sizeof(double) ),
+                          int64_t( 1 ) << 22 );
+    int64_t nthreads = std::max( 1u, std::thread::hardware_concurrency() );
+    std::unique_ptr< double[] > a( new double[ n ] );
+    std::unique_ptr< double[] > b( new double[ n ] );
+    std::unique_ptr< double[] > c( new double[ n ] );
+
+    // Runs func( begin, end ) on each thread's slice.
+    auto parallel = [&]( std::function< void ( int64_t, int64_t ) > func ) {
+        std::vector< std::thread > threads;
+        for (int64_t t = 0; t < nthreads; ++t) {
+            threads.push_back( std::thread(
+                func, n * t / nthreads, n * (t + 1) / nthreads ) );
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    };
+
+    double* a_ = a.get();
+    double* b_ = b.get();
+    double* c_ = c.get();
+    parallel( [=]( int64_t begin, int64_t end ) {
+        for (int64_t i = begin; i < end; ++i) {
+            a_[ i ] = 0;
+            b_[ i ] = 1;
+            c_[ i ] = 2;
+        }
+    } );
+
+    double s = 3.0;
+    double best = 0;
+    for (int trial = 0; trial < 5; ++trial) {
+        // thread start-up is included, but is small compared to the
+        // several ms the triad takes on arrays this size
+        double time = testsweeper::get_wtime();
+        parallel( [=]( int64_t begin, int64_t end ) {
+            for (int64_t i = begin; i < end; ++i) {
+                a_[ i ] = b_[ i ] + s*c_[ i ];
+            }
+        } );
+        time = testsweeper::get_wtime() - time;
+        best = std::max( best, 1e-9 * 3 * sizeof(double) * n / time );
+    }
+    return best;
+}
+
+}  // namespace
+
+// -----------------------------------------------------------------------------
+Roofline::Roofline():
+    peak_gflops_ { 0, 0, 0, 0 },
+    peak_gbytes_( 0 )
+{}
+
+// -----------------------------------------------------------------------------
+/// Measures peak Gflop/s for each data type and peak Gbyte/s.
+/// cache_size is in MiB, as for `tester --cache`.
+/// Takes about a second.
+void Roofline::measure( int64_t cache_size )
+{
+    peak_gflops_[ 0 ] = gemm_gflops< float >();
+    peak_gflops_[ 1 ] = gemm_gflops< double >();
+    peak_gflops_[ 2 ] = gemm_gflops< std::complex<float> >();
+    peak_gflops_[ 3 ] = gemm_gflops< std::complex<double> >();
+    peak_gbytes_ = triad_gbytes( cache_size );
+}
+
+// -----------------------------------------------------------------------------
+void Roofline::print() const
+{
+    printf( "roofline: peak gemm Gflop/s s %.1f, d %.1f, c %.1f, z %.1f; "
+            "STREAM triad Gbyte/s %.1f\n",
+            peak_gflops_[ 0 ], peak_gflops_[ 1 ],
+            peak_gflops_[ 2 ], peak_gflops_[ 3 ], peak_gbytes_ );
+}
+
+// -----------------------------------------------------------------------------
+double Roofline::peak_gflops( testsweeper::DataType datatype ) const
+{
+    return peak_gflops_[ datatype_index( datatype ) ];
+}
+
+// -----------------------------------------------------------------------------
+/// Sets params gflops_pct, gbytes_pct, roofline_pct, and bound from the
+/// test's gflops and gbytes, if the routine sets them.
+void Roofline::set_efficiency( Params& params ) const
+{
+    double gflops = params.gflops();
+    double gbytes = params.gbytes();
+    bool has_gflops = params.gflops.used()
+                      && gflops != testsweeper::no_data_flag && gflops > 0;
+    bool has_gbytes = params.gbytes.used()
+                      && gbytes != testsweeper::no_data_flag && gbytes > 0;
+
+    double peak = peak_gflops( params.datatype() );
+    if (has_gflops) {
+        params.gflops_pct() = 100 * gflops / peak;
+        params.roofline_pct() = params.gflops_pct();
+    }
+    if (has_gbytes) {
+        params.gbytes_pct() = 100 * gbytes / peak_gbytes_;
+
+        // Memory bound if intensity (flop/byte) * bandwidth < peak Gflop/s.
+        // Routines without flops (e.g., max norm) are memory bound.
+        double intensity = has_gflops ? gflops / gbytes : 0;
+        if (intensity * peak_gbytes_ < peak) {
+            params.roofline_pct() = params.gbytes_pct();
+            params.bound() = "memory";
+        }
+        else {
+            params.bound() = "compute";
+        }
+    }
+}
@@ -0,0 +1,38 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef ROOFLINE_HH
+#define ROOFLINE_HH
+
+#include "test.hh"
+
+// -----------------------------------------------------------------------------
+/// Roofline model of the machine, for `tester --roofline y`.
+///
+/// measure() calibrates peak Gflop/s per data type with a large BLAS gemm,
+/// and peak memory bandwidth with a STREAM triad on arrays much larger than
+/// the cache. set_efficiency() then compares a test's Gflop/s and Gbyte/s
+/// against those peaks. A routine whose arithmetic intensity (flop/byte)
+/// times peak bandwidth is below peak Gflop/s is memory bound; its roofline
+/// efficiency is % of peak bandwidth, otherwise % of peak Gflop/s.
+///
+class Roofline
+{
+public:
+    Roofline();
+
+    void measure( int64_t cache_size );
+    void print() const;
+    void set_efficiency( Params& params ) const;
+
+    double peak_gflops( testsweeper::DataType datatype ) const;
+    double peak_gbytes() const { return peak_gbytes_; }
+
+private:
+    double peak_gflops_[ 4 ];  // indexed s, d, c, z
+    double peak_gbytes_;
+};
+
+#endif  // ROOFLINE_HH
@@ -19,6 +19,10 @@
 #
 # run getrf, potrf with small, medium sizes
 #     ./run_tests.py -s -m getrf potrf
+#
+# save results, then compare with results from another build or backend
+#     ./run_tests.py --output new.json getrf potrf
+#     ./compare_results.py old.json new.json
 
 from __future__ import print_function
 
@@ -41,6 +45,7 @@ group_test.add_argument( '-t', '--test', action='store',
     default='./tester' )
 group_test.add_argument( '--xml', help='generate report.xml for jenkins' )
 group_test.add_argument( '--dry-run', action='store_true', help='print commands, but do not execute them' )
+group_test.add_argument( '--output', help='write results to OUTPUT for compare_results.py; *.csv for CSV, else JSON lines' )
 
 group_size = parser.add_argument_group( 'matrix dimensions (default is medium)' )
 group_size.add_argument(       '--quick',  action='store_true', help='run quick "sanity check" of few, small tests' )
@@ -105,6 +110,7 @@ group_opt.add_argument( '--align',  action='store', help='default=%(default)s',
 group_opt.add_argument( '--check',  action='store', help='default=y', default='' )  # default in test.cc
 group_opt.add_argument( '--ref',    action='store', help='default=y', default='' )  # default in test.cc
 group_opt.add_argument( '--verbose', action='store', help='default=0', default='' )  # default in test.cc
+group_opt.add_argument( '--repeat', action='store', help='default=1', default='' )  # default in test.cc
 
 # LAPACK only
 group_opt.add_argument( '--itype',  action='store', help='default=%(default)s', default='1,2,3' )
@@ -283,6 +289,8 @@ align  = ' --align '  + opts.align  if (opts.align)  else ''
 check  = ' --check '  + opts.check  if (opts.check)  else ''
 ref    = ' --ref '    + opts.ref    if (opts.ref)    else ''
 verbose = ' --verbose ' + opts.verbose if (opts.verbose) else ''
+repeat = ' --repeat '  + opts.repeat  if (opts.repeat)  else ''
+output = ' --output '  + opts.output  if (opts.output)  else ''
 
 # LAPACK only
 itype  = ' --itype '  + opts.itype  if (opts.itype)  else ''
@@ -315,7 +323,7 @@ iu     = ' --iu '     + opts.iu     if (opts.iu)     else ''
 mtype  = ' --matrixtype ' + opts.matrixtype if (opts.matrixtype) else ''
 
 # general options for all routines
-gen = check + ref + verbose
+gen = check + ref + verbose + repeat + output
 
 # ------------------------------------------------------------------------------
 # filters a comma separated list csv based on items in list values.
@@ -355,6 +363,8 @@ if (opts.lu and opts.host):
     [ 'gecon', gen + dtype + align + n ],
     [ 'gerfs', gen + dtype + align + n + trans ],
     [ 'geequ', gen + dtype + align + n ],
+    [ 'factor-lu', gen + dtype + n + trans ],
+    [ 'shifted-hessenberg', gen + dtype + nk ],
     ]
 
 if (opts.lu and opts.device):
@@ -394,6 +404,9 @@ if (opts.chol and opts.host):
     [ 'pocon', gen + dtype + align + n + uplo ],
     [ 'porfs', gen + dtype + align + n + uplo ],
     [ 'poequ', gen + dtype + align + n ],  # only diagonal elements (no uplo)
+    [ 'factor-cholesky', gen + dtype + n + uplo ],
+    [ 'potrf_update',   gen + dtype + align + nk + uplo ],
+    [ 'potrf_downdate', gen + dtype + align + nk + uplo ],
 
     # Packed
     [ 'ppsv',  gen + dtype + align + n + uplo ],
@@ -484,6 +497,8 @@ if (opts.hesv and opts.host):
     [ 'hetri', gen + dtype + align + n + uplo ],
     [ 'hecon', gen + dtype + align + n + uplo ],
     [ 'herfs', gen + dtype + align + n + uplo ],
+    [ 'factor-ldlt', gen + dtype + n + uplo ],
+    [ 'shifted-hermitian', gen + dtype + nk + uplo ],
 
     # Packed
     [ 'hpsv',  gen + dtype + align + n + uplo ],
@@ -503,11 +518,14 @@ if (opts.least_squares and opts.host):
     #[ 'gelsd',  gen + dtype + align + mn ],
     [ 'gelss',  gen + dtype + align + mn ],
     [ 'getsls', gen + dtype + align + mn + trans_nc ],
+    [ 'streaming-ls', gen + dtype + mn + nb ],  # m >= n
 
     # Generalized
     [ 'gglse', gen + dtype + align + mnk ],
     # todo: ggglm is failing
     #[ 'ggglm', gen + dtype + align + mnk ],
+    [ 'factor-lse', gen + dtype + mnk ],
+    [ 'factor-glm', gen + dtype + mnk ],
     ]
 
 # QR
@@ -521,6 +539,12 @@ if (opts.qr and opts.host):
     #[ 'unmqr', gen + dtype_real    + align + mnk + side + trans    ],  # real does trans = N, T, C
     #[ 'unmqr', gen + dtype_complex + align + mnk + side + trans_nc ],  # complex does trans = N, C, not T
     [ 'unhr_col', gen + dtype + align + n + tall ],
+    [ 'factor-qr', gen + dtype + mn ],  # m >= n
+    [ 'qr_update',     gen + dtype + mn ],
+    [ 'qr_insert_col', gen + dtype + mn ],
+    [ 'qr_delete_col', gen + dtype + mn ],
+    [ 'qr_insert_row', gen + dtype + mn ],
+    [ 'qr_delete_row', gen + dtype + mn ],
 
     # Triangle-pentagon
     [ 'tpqrt',  gen + dtype + align + mn + l + nb ],
@@ -586,6 +610,7 @@ if (opts.syev and opts.host):
     [ 'ungtr', gen + dtype + align + n + uplo ],
     [ 'unmtr', gen + dtype_real    + align + mn + uplo + side + trans    ],  # real does trans = N, T, C
     [ 'unmtr', gen + dtype_complex + align + mn + uplo + side + trans_nc ],  # complex does trans = N, C, not T
+    [ 'syev_update', gen + dtype_real + align + n + jobz + a ],
 
     # Packed
     [ 'hpev',  gen + dtype + align + n + jobz + uplo ],
@@ -620,6 +645,7 @@ if (opts.sygv and opts.host):
     [ 'hegvd', gen + dtype + align + n + itype + jobz + uplo ],
     #[ 'hegvr', gen + dtype + align + n + uplo ],
     [ 'hegst', gen + dtype + align + n + itype + uplo ],
+    [ 'generalized-eigen', gen + dtype + nk + itype + jobz + uplo ],
 
     # Packed
     [ 'hpgv',  gen + dtype + align + n + itype + jobz + uplo ],
@@ -677,6 +703,7 @@ if (opts.aux and opts.host):
     cmds += [
     [ 'lacpy', gen + dtype + align + mn + mtype ],
     [ 'laed4', gen + dtype_real + n ],
+    [ 'laed4_all', gen + dtype_real + n + a ],
     [ 'laset', gen + dtype + align + mn + mtype ],
     [ 'laswp', gen + dtype + align + mn ],
     ]
@@ -684,8 +711,8 @@ if (opts.aux and opts.host):
 # auxilary - householder
 if (opts.aux_house and opts.host):
     cmds += [
-    [ 'larfg', dtype         + n   + incx_pos ],
-    [ 'larfgp', dtype        + n   + incx_pos ],
+    [ 'larfg', dtype         + n   + incx_pos + repeat + output ],
+    [ 'larfgp', dtype        + n   + incx_pos + repeat + output ],
     [ 'larf',  gen + dtype + align + mn  + incx + side ],
     [ 'larfx', gen + dtype + align + mn  + side ],
     [ 'larfy', gen + dtype + align + n   + incx ],
@@ -795,6 +822,10 @@ def indent_xml( elem, level=0 ):
 start = time.time()
 print_tee( time.ctime() )
 
+# tester appends to output; start with an empty file
+if (opts.output and not opts.dry_run):
+    open( opts.output, 'w' ).close()
+
 failed_tests = []
 passed_tests = []
 ntests = len(opts.tests)
@@ -3,13 +3,24 @@
 // This program is free software: you can redistribute it and/or modify it under
 // the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <complex>
+#include <exception>
+#include <fstream>
+#include <memory>
+#include <thread>
 
 #include <stdio.h>
 #include <string.h>
+#include <stdlib.h>
 #include <unistd.h>
+#include <sys/resource.h>
 
 #include "test.hh"
+#include "results.hh"
+#include "roofline.hh"
 
 // -----------------------------------------------------------------------------
 using testsweeper::ParamType;
@@ -43,6 +54,8 @@ enum Section {
     blas2,
     blas3,
     gpu,
+    overhead,
+    autotune,
     num_sections,  // last
 };
 
@@ -66,6 +79,8 @@ const char* section_names[] = {
    "Level 2 BLAS (additional)",
    "Level 3 BLAS (additional)",
    "GPU device functions",
+   "wrapper overhead",
+   "autotuning",
 };
 
 // { "", nullptr, Section::newline } entries force newline in help
@@ -109,6 +124,10 @@ std::vector< testsweeper::routines_t > routines = {
     { "gbequ",              test_gbequ,     Section::gesv },
     { "",                   nullptr,        Section::newline },
 
+    { "factor-lu",          test_factor_lu, Section::gesv },
+    { "shifted-hessenberg", test_shifted_hessenberg, Section::gesv },
+    { "",                   nullptr,        Section::newline },
+
     // -----
     // Cholesky
     { "posv",               test_posv,      Section::posv },
@@ -133,6 +152,11 @@ std::vector< testsweeper::routines_t > routines = {
     { "pptri",              test_pptri,     Section::posv },
     { "",                   nullptr,        Section::newline },
 
+    { "factor-cholesky",    test_factor_cholesky, Section::posv },
+    { "potrf_update",       test_potrf_update,    Section::posv },
+    { "potrf_downdate",     test_potrf_downdate,  Section::posv },
+    { "",                   nullptr,        Section::newline },
+
     { "pocon",              test_pocon,     Section::posv },
     { "ppcon",              test_ppcon,     Section::posv },
     { "pbcon",              test_pbcon,     Section::posv },
@@ -225,6 +249,10 @@ std::vector< testsweeper::routines_t > routines = {
     { "hprfs",              test_hprfs,     Section::hesv }, // tested via LAPACKE, error < 3*eps
     { "",                   nullptr,        Section::newline },
 
+    { "factor-ldlt",        test_factor_ldlt, Section::hesv },
+    { "shifted-hermitian",  test_shifted_hermitian, Section::hesv },
+    { "",                   nullptr,        Section::newline },
+
     // -----
     // least squares
     { "gels",               test_gels,      Section::gels }, // tested via LAPACKE using gcc/MKL
@@ -232,10 +260,13 @@ std::vector< testsweeper::routines_t > routines = {
     { "gelsd",              test_gelsd,     Section::gels }, // TODO: Segfaults for some Z sizes. src/gelsd.cc:275 lrwork_ too small?
     { "gelss",              test_gelss,     Section::gels }, // tested via LAPACKE using gcc/MKL TODO rcond=n
     { "getsls",             test_getsls,    Section::gels }, // tested via LAPACKE using gcc/MKL
+    { "streaming-ls",       test_streaming_ls, Section::gels },
     { "",                   nullptr,        Section::newline },
 
     { "gglse",              test_gglse,     Section::gels }, // tested via LAPACKE using gcc/MKL
     { "ggglm",              test_ggglm,     Section::gels }, // tested via LAPACKE using gcc/MKL
+    { "factor-lse",         test_lse,       Section::gels },
+    { "factor-glm",         test_glm,       Section::gels },
     { "",                   nullptr,        Section::newline },
 
     // -----
@@ -262,6 +293,14 @@ std::vector< testsweeper::routines_t > routines = {
     { "ungrq",              test_ungrq,     Section::qr }, // tested numerically based on lapack; R, Q full sizes
     { "",                   nullptr,        Section::newline },
 
+    { "factor-qr",          test_factor_qr, Section::qr },
+    { "qr_update",          test_qr_update,     Section::qr },
+    { "qr_insert_col",      test_qr_insert_col, Section::qr },
+    { "qr_delete_col",      test_qr_delete_col, Section::qr },
+    { "qr_insert_row",      test_qr_insert_row, Section::qr },
+    { "qr_delete_row",      test_qr_delete_row, Section::qr },
+    { "",                   nullptr,        Section::newline },
+
     //{ "unmqr",              test_unmqr,     Section::qr }, // TODO segfaults
     //{ "unmlq",              test_unmlq,     Section::qr },
     //{ "unmql",              test_unmql,     Section::qr },
@@ -289,6 +328,7 @@ std::vector< testsweeper::routines_t > routines = {
     { "hpev",               test_hpev,      Section::heev }, // tested via LAPACKE
     { "hbev",               test_hbev,      Section::heev }, // tested via LAPACKE
     { "sturm",              test_sturm,     Section::heev },
+    { "syev_update",        test_syev_update, Section::heev },
     { "",                   nullptr,        Section::newline },
 
     { "heevx",              test_heevx,     Section::heev }, // tested via LAPACKE
@@ -332,6 +372,7 @@ std::vector< testsweeper::routines_t > routines = {
     { "hegvd",              test_hegvd,     Section::sygv }, // tested via LAPACKE using gcc/MKL
     { "hpgvd",              test_hpgvd,     Section::sygv }, // tested via LAPACKE using gcc/MKL
     { "hbgvd",              test_hbgvd,     Section::sygv }, // TODO Segfaults.. is the src correct?
+    { "generalized-eigen",  test_generalized_eigen, Section::sygv },
     { "",                   nullptr,        Section::newline },
 
     { "hegst",              test_hegst,     Section::sygv }, // tested via LAPACKE using gcc/MKL
@@ -388,6 +429,7 @@ std::vector< testsweeper::routines_t > routines = {
     // auxiliary
     { "lacpy",              test_lacpy,     Section::aux },
     { "laed4",              test_laed4,     Section::aux },
+    { "laed4_all",          test_laed4_all, Section::aux },
     { "laset",              test_laset,     Section::aux },
     { "laswp",              test_laswp,     Section::aux },
     { "",                   nullptr,        Section::newline },
@@ -448,6 +490,44 @@ std::vector< testsweeper::routines_t > routines = {
     { "dev-getrf",          test_getrf_device,  Section::gpu },
     { "dev-geqrf",          test_geqrf_device,  Section::gpu },
     { "",                   nullptr,            Section::newline },
+
+    //----------------------------------------
+    // wrapper overhead, lapack::foo vs. direct LAPACK_xfoo call
+    { "overhead-getrf",     test_overhead_getrf,    Section::overhead },
+    { "overhead-getrs",     test_overhead_getrs,    Section::overhead },
+    { "overhead-potrf",     test_overhead_potrf,    Section::overhead },
+    { "overhead-potrs",     test_overhead_potrs,    Section::overhead },
+    { "",                   nullptr,                Section::newline },
+
+    { "overhead-geqrf",     test_overhead_geqrf,    Section::overhead },
+    { "overhead-larfg",     test_overhead_larfg,    Section::overhead },
+    { "overhead-lartg",     test_overhead_lartg,    Section::overhead },
+    { "overhead-lacpy",     test_overhead_lacpy,    Section::overhead },
+    { "overhead-lange",     test_overhead_lange,    Section::overhead },
+    { "",                   nullptr,                Section::newline },
+
+    { "overhead-heev",      test_overhead_heev,     Section::overhead },
+    { "",                   nullptr,                Section::newline },
+
+    //----------------------------------------
+    // autotuning for eig_auto, svd_auto, block sizes, and backends
+    { "autotune-eig",       test_autotune_eig,      Section::autotune },
+    { "autotune-svd",       test_autotune_svd,      Section::autotune },
+    { "",                   nullptr,                Section::newline },
+
+    { "autotune-nb-getrf",  test_autotune_nb_getrf, Section::autotune },
+    { "autotune-nb-geqrf",  test_autotune_nb_geqrf, Section::autotune },
+    { "autotune-nb-potrf",  test_autotune_nb_potrf, Section::autotune },
+    { "autotune-nb-hetrd",  test_autotune_nb_hetrd, Section::autotune },
+    { "autotune-nb-gehrd",  test_autotune_nb_gehrd, Section::autotune },
+    { "",                   nullptr,                Section::newline },
+
+    { "autotune-backend-getrf", test_autotune_backend_getrf, Section::autotune },
+    { "autotune-backend-potrf", test_autotune_backend_potrf, Section::autotune },
+    { "autotune-backend-geqrf", test_autotune_backend_geqrf, Section::autotune },
+    { "autotune-backend-heevd", test_autotune_backend_heevd, Section::autotune },
+    { "autotune-backend-gesdd", test_autotune_backend_gesdd, Section::autotune },
+    { "",                   nullptr,                Section::newline },
 };
 
 // -----------------------------------------------------------------------------
@@ -456,6 +536,7 @@ std::vector< testsweeper::routines_t > routines = {
 
 Params::Params():
     ParamsBase(),
+    concurrent_supported( false ),
     matrix(),
     matrixB(),
 
@@ -464,7 +545,7 @@ Params::Params():
     // def = default
     // ----- test framework parameters
     //         name,       w,    type,             def, valid, help
-    check     ( "check",   0,    ParamType::Value, 'y', "ny",  "check the results" ),
+    check     ( "check",   0,    ParamType::Value, 'y', "nyf", "check the results; f = fast O(n^2) randomized checks where supported (svd, geev, gels), skipping other checks" ),
     error_exit( "error-exit", 0, ParamType::Value, 'n', "ny",  "check error exits" ),
     ref       ( "ref",     0,    ParamType::Value, 'n', "ny",  "run reference; sometimes check implies ref" ),
 
@@ -473,6 +554,18 @@ Params::Params():
     repeat    ( "repeat",  0,    ParamType::Value,   1,   1, 1000, "number of times to repeat each test" ),
     verbose   ( "verbose", 0,    ParamType::Value,   0,   0,   10, "verbose level" ),
     cache     ( "cache",   0,    ParamType::Value,  20,   1, 1024, "total cache size, in MiB" ),
+    concurrent( "concurrent", 0, ParamType::Value,   0,   0, 1024, "number of threads each repeatedly calling the routine on independent data; 0 is off" ),
+
+    //          name,      w, p, type,             def, min,  max, help
+    duration  ( "duration", 0, 1, ParamType::Value,  1,   0, 3600, "time in seconds to run each --concurrent, overhead-*, or autotune-* test" ),
+
+    //          name,      w,    type,             def, help
+    output    ( "output",  0,    ParamType::Value,  "",  "file to append results to, for compare_results.py; *.csv for CSV, else JSON lines" ),
+    matrix_cache( "matrix-cache", 0, ParamType::Value, "", "directory to cache generated test matrices in; see --help-matrix" ),
+    tuning    ( "tuning",  0,    ParamType::Value,  "",  "tuning table file that autotune-* tests update; see lapack::load_tuning_table" ),
+
+    //          name,       w,   type,             def, valid, help
+    roofline  ( "roofline", 0,   ParamType::Value, 'n', "ny",  "report % of peak Gflop/s and Gbyte/s, measured at startup by gemm and STREAM triad" ),
 
     // ----- routine parameters
     //          name,      w,    type,            def,                    char2enum,         enum2char,         enum2str,         help
@@ -515,6 +608,7 @@ Params::Params():
     ku        ( "ku",      6,    ParamType::List, 100,     0, 1000000, "upper bandwidth" ),
     nrhs      ( "nrhs",    6,    ParamType::List,  10,     0, 1000000, "number of right hand sides" ),
     nb        ( "nb",      4,    ParamType::List,  64,     0, 1000000, "block size" ),
+    nb_out    ( "nb",      4,    ParamType::Output, 0,     0, 1000000, "fastest block size found by autotune-nb-*" ),
     vl        ( "vl",      7, 2, ParamType::List, -inf, -inf,     inf, "lower bound of eigen/singular values to find" ),
     vu        ( "vu",      7, 2, ParamType::List,  inf, -inf,     inf, "upper bound of eigen/singular values to find" ),
 
@@ -557,6 +651,26 @@ Params::Params():
     ref_gbytes( "Ref.\nGbyte/s",         11, 4, ParamType::Output, testsweeper::no_data_flag,   0,   0, "reference Gbyte/s rate" ),
     ref_iters ( "Ref.\niters",            6,    ParamType::Output,                     0,   0,   0, "reference iterations to solution" ),
 
+    gflops_pct  ( "% peak\nGflop/s",     8, 1, ParamType::Output, testsweeper::no_data_flag,   0,   0, "Gflop/s as percent of peak gemm Gflop/s" ),
+    gbytes_pct  ( "% peak\nGbyte/s",     8, 1, ParamType::Output, testsweeper::no_data_flag,   0,   0, "Gbyte/s as percent of STREAM triad Gbyte/s" ),
+    roofline_pct( "% of\nroofline",      8, 1, ParamType::Output, testsweeper::no_data_flag,   0,   0, "percent of roofline bound, min( peak Gflop/s, intensity * peak Gbyte/s )" ),
+    bound       ( "bound",                7,    ParamType::Output, "",                               "whether routine is memory or compute bound in roofline model" ),
+
+    workspace_mib( "workspace\nMiB",     10, 2, ParamType::Output, testsweeper::no_data_flag,   0,   0, "peak LAPACK++ workspace allocated during the call, in MiB" ),
+    rss_mib      ( "RSS delta\nMiB",     10, 2, ParamType::Output, testsweeper::no_data_flag,   0,   0, "growth of process peak resident set size during the call, in MiB" ),
+
+    throughput ( "calls/s",              11, 1, ParamType::Output, testsweeper::no_data_flag,   0,   0, "calls per second, summed over --concurrent threads" ),
+    latency_p50( "p50\nlatency (us)",    12, 2, ParamType::Output, testsweeper::no_data_flag,   0,   0, "median time per call, in microseconds" ),
+    latency_p99( "p99\nlatency (us)",    12, 2, ParamType::Output, testsweeper::no_data_flag,   0,   0, "99th percentile time per call, in microseconds" ),
+
+    call_ns    ( "LAPACK++\nns/call",    11, 1, ParamType::Output, testsweeper::no_data_flag,   0,   0, "time per lapack:: call, in nanoseconds" ),
+    nothrow_ns ( "nothrow\nns/call",     11, 1, ParamType::Output, testsweeper::no_data_flag,   0,   0, "time per lapack::nothrow:: call, in nanoseconds" ),
+    inline_ns  ( "inline\nns/call",      11, 1, ParamType::Output, testsweeper::no_data_flag,   0,   0, "time per lapack::inlined:: call (lapack/inline.hh), in nanoseconds" ),
+    ref_call_ns( "Fortran\nns/call",     11, 1, ParamType::Output, testsweeper::no_data_flag,   0,   0, "time per direct Fortran call, in nanoseconds" ),
+    overhead_ns( "overhead\n(ns)",       11, 1, ParamType::Output, testsweeper::no_data_flag,   0,   0, "wrapper overhead per call, in nanoseconds" ),
+
+    driver    ( "driver",               10,    ParamType::Output, "",                               "fastest driver or backend found by autotune-*" ),
+
     // default -1 means "no check"
     //          name,     w, type,              def, min, max, help
     okay      ( "status", 6, ParamType::Output,  -1,   0,   0, "success indicator" ),
@@ -579,6 +693,9 @@ Params::Params():
     repeat();
     verbose();
     cache();
+    output();
+    matrix_cache();
+    roofline();
 
     // routine's parameters are marked by the test routine; see main
 }
@@ -637,6 +754,189 @@ void Params::get_range(
     *vu_arg = float(dvu);
 }
 
+// -----------------------------------------------------------------------------
+/// Marks that the calling tester supports --concurrent, i.e., that it calls
+/// run_concurrent when params.concurrent() > 0. Call while marking
+/// parameters (run = false); main skips --concurrent for other routines.
+/// @return params.concurrent().
+int64_t mark_concurrent( Params& params )
+{
+    params.concurrent_supported = true;
+    params.duration();
+    return params.concurrent();
+}
+
+// -----------------------------------------------------------------------------
+/// Throughput mode for --concurrent.
+/// Starts params.concurrent() threads, each with its own task from make_task,
+/// that repeatedly reset and call the routine for params.duration() seconds.
+/// Only call is timed. Sets outputs:
+/// - time:        wall-clock time for all threads, in seconds;
+/// - throughput:  calls per second, summed over threads,
+///                each thread's rate being its calls / its time in call;
+/// - latency_p50, latency_p99: percentiles of the time per call,
+///                in microseconds, over all calls from all threads.
+///
+/// make_task is called serially before any thread starts,
+/// so it need not be thread safe.
+void run_concurrent(
+    Params& params,
+    std::function< ConcurrentTask ( int64_t thread ) > make_task )
+{
+    using clock = std::chrono::steady_clock;
+    using seconds = std::chrono::duration< double >;
+
+    int64_t nthreads = params.concurrent();
+    require( nthreads > 0 );
+
+    std::vector< ConcurrentTask > tasks;
+    for (int64_t t = 0; t < nthreads; ++t) {
+        tasks.push_back( make_task( t ) );
+    }
+
+    std::vector< std::vector< double > > latency( nthreads );
+    std::vector< double > busy( nthreads, 0.0 );
+    std::vector< std::exception_ptr > errors( nthreads );
+    std::atomic< int64_t > ready( 0 );
+    std::atomic< bool > go( false );
+    clock::time_point deadline;
+
+    auto worker = [&]( int64_t t ) {
+        try {
+            ConcurrentTask& task = tasks[ t ];
+            ++ready;
+            while (! go) {
+                std::this_thread::yield();
+            }
+            do {
+                if (task.reset)
+                    task.reset();
+                clock::time_point t0 = clock::now();
+                task.call();
+                double dt = seconds( clock::now() - t0 ).count();
+                latency[ t ].push_back( dt );
+                busy[ t ] += dt;
+            } while (clock::now() < deadline);
+        }
+        catch (...) {
+            errors[ t ] = std::current_exception();
+        }
+    };
+
+    std::vector< std::thread > threads;
+    for (int64_t t = 0; t < nthreads; ++t) {
+        threads.push_back( std::thread( worker, t ) );
+    }
+    while (ready < nthreads) {
+        std::this_thread::yield();
+    }
+    clock::time_point start = clock::now();
+    deadline = start + std::chrono::duration_cast< clock::duration >(
+                           seconds( params.duration() ) );
+    go = true;
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    double elapsed = seconds( clock::now() - start ).count();
+
+    for (auto& error : errors) {
+        if (error)
+            std::rethrow_exception( error );
+    }
+
+    // merge latencies from all threads
+    std::vector< double > all;
+    double rate = 0;
+    for (int64_t t = 0; t < nthreads; ++t) {
+        all.insert( all.end(), latency[ t ].begin(), latency[ t ].end() );
+        if (busy[ t ] > 0)
+            rate += latency[ t ].size() / busy[ t ];
+    }
+    std::sort( all.begin(), all.end() );
+    int64_t calls = all.size();
+    require( calls > 0 );
+    auto percentile = [&]( double p ) {
+        return all[ int64_t( p * (calls - 1) + 0.5 ) ];
+    };
+
+    params.time()        = elapsed;
+    params.throughput()  = rate;
+    params.latency_p50() = 1e6 * percentile( 0.50 );
+    params.latency_p99() = 1e6 * percentile( 0.99 );
+}
+
+// -----------------------------------------------------------------------------
+// Returns field (e.g., "VmHWM:") from /proc/self/status, in bytes,
+// or -1 if not available (non-Linux).
+static int64_t proc_status_bytes( const char* field )
+{
+    int64_t bytes = -1;
+    FILE* status = fopen( "/proc/self/status", "r" );
+    if (status != nullptr) {
+        char line[ 256 ];
+        size_t len = strlen( field );
+        while (fgets( line, sizeof(line), status ) != nullptr) {
+            if (strncmp( line, field, len ) == 0) {
+                bytes = 1024 * strtoll( line + len, nullptr, 10 );  // kB
+                break;
+            }
+        }
+        fclose( status );
+    }
+    return bytes;
+}
+
+// -----------------------------------------------------------------------------
+// Returns peak RSS in bytes. On Linux, this is since the last reset_peak_rss;
+// elsewhere, it is the lifetime peak from getrusage.
+static int64_t peak_rss()
+{
+    int64_t bytes = proc_status_bytes( "VmHWM:" );
+    if (bytes < 0) {
+        struct rusage usage;
+        getrusage( RUSAGE_SELF, &usage );
+        #if defined( __APPLE__ )
+            bytes = usage.ru_maxrss;  // bytes
+        #else
+            bytes = 1024 * int64_t( usage.ru_maxrss );  // KiB
+        #endif
+    }
+    return bytes;
+}
+
+// -----------------------------------------------------------------------------
+// Resets peak RSS to current RSS, if possible (Linux >= 4.0), and
+// returns current RSS in bytes. Otherwise, returns current peak RSS,
+// so the difference measures only growth of the lifetime peak.
+static int64_t reset_peak_rss()
+{
+    FILE* clear_refs = fopen( "/proc/self/clear_refs", "w" );
+    if (clear_refs != nullptr) {
+        bool okay = (fputs( "5", clear_refs ) >= 0);
+        okay = (fclose( clear_refs ) == 0) && okay;
+        int64_t rss = proc_status_bytes( "VmRSS:" );
+        if (okay && rss >= 0)
+            return rss;
+    }
+    return peak_rss();
+}
+
+// -----------------------------------------------------------------------------
+MemoryMeter::MemoryMeter()
+{
+    workspace_ = lapack::workspace_bytes();
+    lapack::workspace_reset_high_water();
+    rss_ = reset_peak_rss();
+}
+
+// -----------------------------------------------------------------------------
+void MemoryMeter::stop( Params& params )
+{
+    const double MiB = 1024. * 1024.;
+    params.workspace_mib() = (lapack::workspace_high_water() - workspace_) / MiB;
+    params.rss_mib() = std::max( int64_t( 0 ), peak_rss() - rss_ ) / MiB;
+}
+
 // -----------------------------------------------------------------------------
 // Compare a == b, bitwise. Returns true if a and b are both the same NaN value,
 // unlike (a == b) which is false for NaNs.
@@ -741,11 +1041,61 @@ int main( int argc, char** argv )
             throw;
         }
 
+        params.matrix .cache_dir = params.matrix_cache();
+        params.matrixB.cache_dir = params.matrix_cache();
+
+        // autotune-* tests add to an existing tuning table, replacing
+        // entries they re-measure, rather than starting a new one
+        if (params.tuning.used() && ! params.tuning().empty()) {
+            lapack::clear_tuning_table();
+            if (std::ifstream( params.tuning() ))
+                lapack::load_tuning_table( params.tuning() );
+        }
+
         // show align column if it has non-default values
         if (params.align.size() != 1 || params.align() != 1) {
             params.align.width( 5 );
         }
 
+        // show throughput columns if routine supports --concurrent and it is on;
+        // skip other routines rather than run them single-threaded
+        bool skip_concurrent = false;
+        if (params.concurrent() > 0) {
+            if (params.concurrent_supported) {
+                params.throughput();
+                params.latency_p50();
+                params.latency_p99();
+            }
+            else {
+                params.msg();
+                skip_concurrent = true;
+            }
+        }
+
+        // show roofline columns for the rates the routine reports,
+        // and calibrate peak rates
+        std::unique_ptr< Roofline > roofline;
+        if (params.roofline() == 'y') {
+            if (params.gflops.used()) {
+                params.gflops_pct();
+                params.roofline_pct();
+            }
+            if (params.gbytes.used()) {
+                params.gbytes_pct();
+                params.roofline_pct();
+                params.bound();
+            }
+            roofline.reset( new Roofline() );
+            roofline->measure( params.cache() );
+            roofline->print();
+        }
+
+        // record results for compare_results.py
+        std::unique_ptr< ResultFile > results;
+        if (! params.output().empty()) {
+            results.reset( new ResultFile( params.output(), routine ) );
+        }
+
         // run tests
         int repeat = params.repeat();
         testsweeper::DataType last = params.datatype();
@@ -759,19 +1109,28 @@ int main( int argc, char** argv )
             }
             for (int iter = 0; iter < repeat; ++iter) {
                 try {
-                    test_routine( params, true );
+                    if (skip_concurrent)
+                        params.msg() = "skipping: --concurrent not supported";
+                    else
+                        test_routine( params, true );
                 }
                 catch (const std::exception& ex) {
                     fprintf( stderr, "%s%sError: %s%s\n",
                              ansi_bold, ansi_red, ex.what(), ansi_normal );
                     params.okay() = false;
                 }
+                if (roofline) {
+                    roofline->set_efficiency( params );
+                }
                 if (iter == 0) {
                     print_matrix_header( params.matrix,  "test matrix A", &matrix,  &cond,  &condD   );
                     print_matrix_header( params.matrixB, "test matrix B", &matrixB, &condB, &condD_B );
                 }
                 params.print();
                 fflush( stdout );
+                if (results) {
+                    results->write( params, iter );
+                }
                 status += ! params.okay();
                 params.reset_output();
             }
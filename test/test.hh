@@ -11,6 +11,8 @@
 #include "matrix_params.hh"
 #include "matrix_generator.hh"
 
+#include <functional>
+
 // -----------------------------------------------------------------------------
 using llong = long long;
 
@@ -25,6 +27,9 @@ public:
 
     Params();
 
+    /// Set by mark_concurrent if the routine's tester supports --concurrent.
+    bool concurrent_supported;
+
     void get_range(
         int64_t n, lapack::Range* range,
         double* vl, double* vu,
@@ -50,6 +55,12 @@ public:
     testsweeper::ParamInt    repeat;
     testsweeper::ParamInt    verbose;
     testsweeper::ParamInt    cache;
+    testsweeper::ParamInt    concurrent;
+    testsweeper::ParamDouble duration;
+    testsweeper::ParamString output;
+    testsweeper::ParamString matrix_cache;
+    testsweeper::ParamString tuning;
+    testsweeper::ParamChar   roofline;
 
     // ----- routine parameters
     testsweeper::ParamEnum< testsweeper::DataType > datatype;
@@ -84,6 +95,7 @@ public:
     testsweeper::ParamInt    ku;
     testsweeper::ParamInt    nrhs;
     testsweeper::ParamInt    nb;
+    testsweeper::ParamInt    nb_out;
     testsweeper::ParamDouble vl;
     testsweeper::ParamDouble vu;
     testsweeper::ParamInt    il;
@@ -120,6 +132,26 @@ public:
     testsweeper::ParamDouble     ref_gbytes;
     testsweeper::ParamInt        ref_iters;
 
+    testsweeper::ParamDouble     gflops_pct;
+    testsweeper::ParamDouble     gbytes_pct;
+    testsweeper::ParamDouble     roofline_pct;
+    testsweeper::ParamString     bound;
+
+    testsweeper::ParamDouble     workspace_mib;
+    testsweeper::ParamDouble     rss_mib;
+
+    testsweeper::ParamDouble     throughput;
+    testsweeper::ParamDouble     latency_p50;
+    testsweeper::ParamDouble     latency_p99;
+
+    testsweeper::ParamDouble     call_ns;
+    testsweeper::ParamDouble     nothrow_ns;
+    testsweeper::ParamDouble     inline_ns;
+    testsweeper::ParamDouble     ref_call_ns;
+    testsweeper::ParamDouble     overhead_ns;
+
+    testsweeper::ParamString     driver;
+
     testsweeper::ParamOkay       okay;
     testsweeper::ParamString     msg;
 };
@@ -160,6 +192,40 @@ void require_( bool cond, const char* condstr, const char* file, int line )
 
 #define require( cond ) require_( (cond), #cond, __FILE__, __LINE__ )
 
+// -----------------------------------------------------------------------------
+/// One thread's work in run_concurrent.
+/// reset restores inputs that call overwrites (e.g., A in getrf);
+/// it is not timed. call is the routine being measured.
+struct ConcurrentTask
+{
+    std::function< void () > reset;
+    std::function< void () > call;
+};
+
+void run_concurrent(
+    Params& params,
+    std::function< ConcurrentTask ( int64_t thread ) > make_task );
+
+int64_t mark_concurrent( Params& params );
+
+// -----------------------------------------------------------------------------
+/// Measures memory used by a LAPACK++ call: the high-water mark of workspace
+/// it allocates, from lapack::workspace_high_water(), and the growth of the
+/// process's peak resident set size (RSS), which includes memory allocated
+/// by the underlying LAPACK and BLAS. Construct just before the call
+/// (after flush_cache), and call stop() just after it, which sets
+/// params.workspace_mib and params.rss_mib.
+class MemoryMeter
+{
+public:
+    MemoryMeter();
+    void stop( Params& params );
+
+private:
+    int64_t workspace_;
+    int64_t rss_;
+};
+
 // -----------------------------------------------------------------------------
 // LAPACK
 // LU, general
@@ -194,6 +260,8 @@ void test_gtequ ( Params& params, bool run );
 void test_posv  ( Params& params, bool run );
 void test_posvx ( Params& params, bool run );
 void test_potrf ( Params& params, bool run );
+void test_potrf_update   ( Params& params, bool run );
+void test_potrf_downdate ( Params& params, bool run );
 void test_potri ( Params& params, bool run );
 void test_potrs ( Params& params, bool run );
 void test_pocon ( Params& params, bool run );
@@ -292,6 +360,11 @@ void test_ggglm ( Params& params, bool run );
 // QR, LQ, QL, RQ
 void test_geqr  ( Params& params, bool run );
 void test_geqrf ( Params& params, bool run );
+void test_qr_update     ( Params& params, bool run );
+void test_qr_insert_col ( Params& params, bool run );
+void test_qr_delete_col ( Params& params, bool run );
+void test_qr_insert_row ( Params& params, bool run );
+void test_qr_delete_row ( Params& params, bool run );
 void test_gelqf ( Params& params, bool run );
 void test_geqlf ( Params& params, bool run );
 void test_gerqf ( Params& params, bool run );
@@ -331,6 +404,7 @@ void test_heevd ( Params& params, bool run );
 void test_heevr ( Params& params, bool run );
 void test_hetrd ( Params& params, bool run );
 void test_sturm ( Params& params, bool run );
+void test_syev_update( Params& params, bool run );
 void test_ungtr ( Params& params, bool run );
 void test_unmtr ( Params& params, bool run );
 
@@ -402,6 +476,7 @@ void test_gesvj ( Params& params, bool run );
 // auxiliary
 void test_lacpy ( Params& params, bool run );
 void test_laed4 ( Params& params, bool run );
+void test_laed4_all( Params& params, bool run );
 void test_laset ( Params& params, bool run );
 void test_laswp ( Params& params, bool run );
 
@@ -453,4 +528,45 @@ void test_potrf_device ( Params& params, bool run );
 void test_getrf_device ( Params& params, bool run );
 void test_geqrf_device ( Params& params, bool run );
 
+//----------------------------------------
+// wrapper overhead, lapack::foo vs. direct LAPACK_xfoo call
+void test_overhead_getrf ( Params& params, bool run );
+void test_overhead_getrs ( Params& params, bool run );
+void test_overhead_potrf ( Params& params, bool run );
+void test_overhead_potrs ( Params& params, bool run );
+void test_overhead_geqrf ( Params& params, bool run );
+void test_overhead_larfg ( Params& params, bool run );
+void test_overhead_lartg ( Params& params, bool run );
+void test_overhead_lacpy ( Params& params, bool run );
+void test_overhead_lange ( Params& params, bool run );
+void test_overhead_heev  ( Params& params, bool run );
+
+//----------------------------------------
+// factorization objects, lapack/factor.hh
+void test_factor_lu       ( Params& params, bool run );
+void test_factor_cholesky ( Params& params, bool run );
+void test_factor_ldlt     ( Params& params, bool run );
+void test_factor_qr       ( Params& params, bool run );
+void test_streaming_ls    ( Params& params, bool run );
+void test_shifted_hessenberg( Params& params, bool run );
+void test_shifted_hermitian ( Params& params, bool run );
+void test_generalized_eigen ( Params& params, bool run );
+void test_lse             ( Params& params, bool run );
+void test_glm             ( Params& params, bool run );
+
+//----------------------------------------
+// autotuning for eig_auto, svd_auto, block sizes, and backends
+void test_autotune_eig   ( Params& params, bool run );
+void test_autotune_svd   ( Params& params, bool run );
+void test_autotune_nb_getrf ( Params& params, bool run );
+void test_autotune_nb_geqrf ( Params& params, bool run );
+void test_autotune_nb_potrf ( Params& params, bool run );
+void test_autotune_nb_hetrd ( Params& params, bool run );
+void test_autotune_nb_gehrd ( Params& params, bool run );
+void test_autotune_backend_getrf ( Params& params, bool run );
+void test_autotune_backend_potrf ( Params& params, bool run );
+void test_autotune_backend_geqrf ( Params& params, bool run );
+void test_autotune_backend_heevd ( Params& params, bool run );
+void test_autotune_backend_gesdd ( Params& params, bool run );
+
 #endif  //  #ifndef TEST_HH
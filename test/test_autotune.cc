@@ -0,0 +1,822 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+// Autotuning benchmarks for lapack::eig_auto and lapack::svd_auto,
+// and for block sizes returned by LAPACK++'s ilaenv override.
+// For each problem, times every driver eig_auto or svd_auto can use,
+// by forcing it with set_eig_driver or set_svd_driver, and reports the
+// fastest driver, its time, and, as ref_time, the time of the built-in
+// default driver. With --tuning file, the fastest driver is recorded in
+// the tuning table, which is saved to file after each test, e.g.,
+//
+//     tester --type d,z --dim 100:2000:100 --jobz n,v --fraction 0.1,1
+//            --tuning lapackpp_tuning.txt autotune-eig
+//
+// Then set $LAPACKPP_TUNING_FILE=lapackpp_tuning.txt to use the table.
+// Likewise, autotune-nb-* search block sizes for getrf, geqrf, potrf,
+// hetrd (sytrd), and gehrd; these need CMake -Dilaenv_override=yes.
+// autotune-backend-* time getrf, potrf, geqrf, heevd (syevd), and gesdd in
+// each LAPACK backend, routing to the fastest; these need CMake
+// -Ddispatch=yes and backends listed in the tuning file, e.g.,
+//
+//     backend openblas /usr/lib/libopenblas.so
+//     backend reference /usr/lib/liblapack.so
+//
+// See also `make autotune`.
+
+#include "test.hh"
+#include "lapack.hh"
+
+#include <algorithm>
+#include <limits>
+#include <string>
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// Restores eig_auto and svd_auto to use the tuning table,
+// even if a driver throws.
+class DriverOverride {
+public:
+    ~DriverOverride()
+    {
+        lapack::set_eig_driver( lapack::EigDriver::Auto );
+        lapack::set_svd_driver( lapack::SvdDriver::Auto );
+    }
+};
+
+// -----------------------------------------------------------------------------
+// Returns minimum time of calls to run; calls reset before each, untimed.
+// Repeats until --duration is spent, between 1 and 10 times.
+template< typename Run, typename Reset >
+double time_driver( Params& params, Run run, Reset reset )
+{
+    double best = std::numeric_limits<double>::infinity();
+    double total = 0;
+    for (int trial = 0; trial < 10; ++trial) {
+        reset();
+        testsweeper::flush_cache( params.cache() );
+        double time = testsweeper::get_wtime();
+        run();
+        time = testsweeper::get_wtime() - time;
+        best = std::min( best, time );
+        total += time;
+        if (total >= params.duration())
+            break;
+    }
+    return best;
+}
+
+// -----------------------------------------------------------------------------
+inline char type_char( Params& params )
+{
+    return testsweeper::datatype2char( params.datatype() );
+}
+
+// -----------------------------------------------------------------------------
+// Marks parameters common to autotune-* tests.
+inline void mark_autotune( Params& params )
+{
+    params.matrix.mark();
+    params.duration();
+    params.tuning();
+    params.ref_time();
+    params.driver();
+}
+
+// -----------------------------------------------------------------------------
+template< typename scalar_t >
+void test_autotune_eig_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+    using lapack::EigDriver;
+
+    // get & mark input values
+    lapack::Job jobz = params.jobz();
+    lapack::Uplo uplo = params.uplo();
+    int64_t n = params.dim.n();
+    int64_t verbose = params.verbose();
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+    mark_autotune( params );
+
+    // get_range fills in range, il, iu from il, iu, or fraction
+    real_t  vl, vu;
+    int64_t il, iu;
+    lapack::Range range;
+    params.get_range( n, &range, &vl, &vu, &il, &iu );
+
+    if (! run)
+        return;
+
+    if (range == lapack::Range::Value) {
+        params.msg() = "skipping: autotune supports only il, iu, or fraction";
+        return;
+    }
+    if (il > iu) {
+        params.msg() = "skipping: requires 1 <= il <= iu <= n";
+        return;
+    }
+    int64_t nwanted = (range == lapack::Range::All ? n : iu - il + 1);
+
+    // ---------- setup
+    int64_t lda = blas::max( 1, n );
+    size_t size_A = (size_t) lda * n;
+    std::vector< scalar_t > A0( size_A ), A( size_A ), Z( size_A );
+    std::vector< real_t > W( n ), W_ref( n );
+    lapack::generate_matrix( params.matrix, n, n, &A0[0], lda );
+
+    std::vector< EigDriver > drivers = {
+        EigDriver::ev, EigDriver::evd, EigDriver::evr, EigDriver::evx,
+    };
+    #if LAPACK_VERSION >= 30700  // >= 3.7
+        // LAPACK's 2-stage drivers don't yet compute eigenvectors
+        if (jobz == lapack::Job::NoVec) {
+            drivers.insert( drivers.end(), {
+                EigDriver::ev_2stage, EigDriver::evd_2stage,
+                EigDriver::evr_2stage, EigDriver::evx_2stage } );
+        }
+    #endif
+    EigDriver default_driver = lapack::default_eig_driver( jobz, n, nwanted );
+
+    // ---------- time each driver
+    DriverOverride restore;
+    double best_time = std::numeric_limits<double>::infinity();
+    double default_time = testsweeper::no_data_flag;
+    EigDriver best = default_driver;
+    real_t error = 0;
+    bool first = true;
+    for (auto driver : drivers) {
+        lapack::set_eig_driver( driver );
+        int64_t info = 0, nfound = 0;
+        double time = time_driver(
+            params,
+            [&]() {
+                if (range == lapack::Range::All) {
+                    info = lapack::eig_auto( jobz, uplo, n, &A[0], lda, &W[0] );
+                }
+                else {
+                    info = lapack::eig_auto( jobz, uplo, n, &A[0], lda, il, iu,
+                                             &nfound, &W[0], &Z[0], lda );
+                }
+            },
+            [&]() { std::copy( A0.begin(), A0.end(), A.begin() ); } );
+        if (info != 0) {
+            fprintf( stderr, "lapack::eig_auto with %s returned error %lld\n",
+                     lapack::eigdriver2str( driver ), (long long) info );
+            continue;
+        }
+        if (verbose >= 1) {
+            printf( "    %-12s %10.4f\n", lapack::eigdriver2str( driver ), time );
+        }
+
+        // ---------- check eigenvalues agree with the first driver's
+        if (params.check() == 'y') {
+            if (first) {
+                W_ref = W;
+                first = false;
+            }
+            else {
+                real_t Wnorm = 0, diff = 0;
+                for (int64_t i = 0; i < nwanted; ++i) {
+                    Wnorm = blas::max( Wnorm, std::abs( W_ref[ i ] ) );
+                    diff  = blas::max( diff,  std::abs( W[ i ] - W_ref[ i ] ) );
+                }
+                if (Wnorm != 0)
+                    diff /= Wnorm;
+                error = blas::max( error, diff / n );
+            }
+        }
+
+        if (time < best_time) {
+            best_time = time;
+            best = driver;
+        }
+        if (driver == default_driver)
+            default_time = time;
+    }
+
+    params.time() = best_time;
+    params.ref_time() = default_time;
+    params.driver() = lapack::eigdriver2str( best );
+
+    if (! params.tuning().empty()) {
+        lapack::set_eig_tuning( type_char( params ), jobz, n, nwanted, best );
+        lapack::save_tuning_table( params.tuning() );
+    }
+
+    if (params.check() == 'y') {
+        params.error() = error;
+        params.okay() = (error < tol);
+    }
+}
+
+// -----------------------------------------------------------------------------
+template< typename scalar_t >
+void test_autotune_svd_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+    using lapack::SvdDriver;
+
+    // get & mark input values
+    lapack::Job jobz = params.jobz();
+    int64_t m = params.dim.m();
+    int64_t n = params.dim.n();
+    int64_t minmn = blas::min( m, n );
+    int64_t verbose = params.verbose();
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+    mark_autotune( params );
+
+    // get_range fills in range, il, iu from il, iu, or fraction
+    real_t  vl, vu;
+    int64_t il, iu;
+    lapack::Range range;
+    params.get_range( minmn, &range, &vl, &vu, &il, &iu );
+
+    if (! run)
+        return;
+
+    if (range == lapack::Range::Value) {
+        params.msg() = "skipping: autotune supports only il, iu, or fraction";
+        return;
+    }
+    if (il > iu) {
+        params.msg() = "skipping: requires 1 <= il <= iu <= min( m, n )";
+        return;
+    }
+    int64_t nwanted = (range == lapack::Range::All ? minmn : iu - il + 1);
+
+    // jobz = Vec means both U and VT; thin vectors for all singular values
+    lapack::Job job_all = (jobz == lapack::Job::NoVec ? lapack::Job::NoVec
+                                                      : lapack::Job::SomeVec);
+    lapack::Job job_idx = (jobz == lapack::Job::NoVec ? lapack::Job::NoVec
+                                                      : lapack::Job::Vec);
+
+    // ---------- setup
+    int64_t lda  = blas::max( 1, m );
+    int64_t ldu  = blas::max( 1, m );
+    int64_t ldvt = blas::max( 1, minmn );
+    std::vector< scalar_t > A0( lda*n ), A( lda*n );
+    std::vector< scalar_t > U( ldu*minmn ), VT( ldvt*n );
+    std::vector< real_t > S( minmn ), S_ref( minmn );
+    lapack::generate_matrix( params.matrix, m, n, &A0[0], lda );
+
+    std::vector< SvdDriver > drivers = {
+        SvdDriver::gesvd, SvdDriver::gesdd,
+    };
+    #if LAPACK_VERSION >= 30600  // >= 3.6
+        drivers.push_back( SvdDriver::gesvdx );
+    #endif
+    SvdDriver default_driver
+        = lapack::default_svd_driver( jobz, m, n, nwanted );
+
+    // ---------- time each driver
+    DriverOverride restore;
+    double best_time = std::numeric_limits<double>::infinity();
+    double default_time = testsweeper::no_data_flag;
+    SvdDriver best = default_driver;
+    real_t error = 0;
+    bool first = true;
+    for (auto driver : drivers) {
+        lapack::set_svd_driver( driver );
+        int64_t info = 0, nfound = 0;
+        double time = time_driver(
+            params,
+            [&]() {
+                if (range == lapack::Range::All) {
+                    info = lapack::svd_auto( job_all, job_all, m, n, &A[0], lda,
+                                             &S[0], &U[0], ldu, &VT[0], ldvt );
+                }
+                else {
+                    info = lapack::svd_auto( job_idx, job_idx, m, n, &A[0], lda,
+                                             il, iu, &nfound, &S[0],
+                                             &U[0], ldu, &VT[0], ldvt );
+                }
+            },
+            [&]() { std::copy( A0.begin(), A0.end(), A.begin() ); } );
+        if (info != 0) {
+            fprintf( stderr, "lapack::svd_auto with %s returned error %lld\n",
+                     lapack::svddriver2str( driver ), (long long) info );
+            continue;
+        }
+        if (verbose >= 1) {
+            printf( "    %-12s %10.4f\n", lapack::svddriver2str( driver ), time );
+        }
+
+        // ---------- check singular values agree with the first driver's
+        if (params.check() == 'y') {
+            if (first) {
+                S_ref = S;
+                first = false;
+            }
+            else {
+                real_t diff = 0;
+                for (int64_t i = 0; i < nwanted; ++i)
+                    diff = blas::max( diff, std::abs( S[ i ] - S_ref[ i ] ) );
+                if (minmn > 0 && S_ref[ 0 ] != 0)
+                    diff /= S_ref[ 0 ];
+                error = blas::max( error, diff / blas::max( 1, minmn ) );
+            }
+        }
+
+        if (time < best_time) {
+            best_time = time;
+            best = driver;
+        }
+        if (driver == default_driver)
+            default_time = time;
+    }
+
+    params.time() = best_time;
+    params.ref_time() = default_time;
+    params.driver() = lapack::svddriver2str( best );
+
+    if (! params.tuning().empty()) {
+        lapack::set_svd_tuning( type_char( params ), jobz, m, n, nwanted, best );
+        lapack::save_tuning_table( params.tuning() );
+    }
+
+    if (params.check() == 'y') {
+        params.error() = error;
+        params.okay() = (error < tol);
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Blocked routines whose block size autotune-nb-* searches.
+enum class NbRoutine { getrf, geqrf, potrf, hetrd, gehrd };
+
+// Returns LAPACK name that routine passes to ilaenv, e.g., dgetrf, zhetrd.
+template< typename scalar_t >
+std::string nb_routine_name( char type, NbRoutine routine )
+{
+    std::string name( 1, type );
+    bool is_complex = blas::is_complex< scalar_t >::value;
+    switch (routine) {
+        case NbRoutine::getrf: name += "getrf"; break;
+        case NbRoutine::geqrf: name += "geqrf"; break;
+        case NbRoutine::potrf: name += "potrf"; break;
+        case NbRoutine::hetrd: name += (is_complex ? "hetrd" : "sytrd"); break;
+        case NbRoutine::gehrd: name += "gehrd"; break;
+    }
+    return name;
+}
+
+// -----------------------------------------------------------------------------
+// Times routine for each candidate block size, set via lapack::set_block_size
+// and LAPACK++'s ilaenv override, and reports the fastest, its time, and,
+// as ref_time, the time with the backend's block size.
+template< typename scalar_t >
+void test_autotune_nb_work( Params& params, bool run, NbRoutine routine )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    int64_t n = params.dim.n();
+    int64_t verbose = params.verbose();
+    params.matrix.mark();
+    params.duration();
+    params.tuning();
+    params.ref_time();
+    params.nb_out();
+
+    // getrf, geqrf are m-by-n; potrf, hetrd are n-by-n with uplo; gehrd n-by-n
+    int64_t m = n;
+    lapack::Uplo uplo = lapack::Uplo::Lower;
+    if (routine == NbRoutine::getrf || routine == NbRoutine::geqrf)
+        m = params.dim.m();
+    else if (routine == NbRoutine::potrf || routine == NbRoutine::hetrd)
+        uplo = params.uplo();
+
+    if (! run)
+        return;
+
+    if (! lapack::ilaenv_override_enabled()) {
+        params.msg() = "skipping: requires LAPACK++ built with ilaenv_override";
+        return;
+    }
+
+    // ---------- setup
+    std::string name = nb_routine_name< scalar_t >( type_char( params ), routine );
+    int64_t minmn = blas::min( m, n );
+    // ilaenv looks up block sizes by max( n1, n2 ), which is max( m, n )
+    int64_t size = blas::max( m, n );
+    int64_t lda = blas::max( 1, m );
+    size_t size_A = (size_t) lda * n;
+    std::vector< scalar_t > A0( size_A ), A( size_A ), tau( blas::max( 1, n ) );
+    std::vector< real_t > D( blas::max( 1, n ) ), E( blas::max( 1, n ) );
+    std::vector< int64_t > ipiv( blas::max( 1, minmn ) );
+    lapack::generate_matrix( params.matrix, m, n, &A0[0], lda );
+    if (routine == NbRoutine::potrf) {
+        // make positive definite
+        for (int64_t i = 0; i < n; ++i)
+            A0[ i + i*lda ] = std::abs( A0[ i + i*lda ] ) + real_t( n );
+    }
+
+    auto call = [&]() {
+        switch (routine) {
+            case NbRoutine::getrf:
+                lapack::getrf( m, n, &A[0], lda, &ipiv[0] );
+                break;
+            case NbRoutine::geqrf:
+                lapack::geqrf( m, n, &A[0], lda, &tau[0] );
+                break;
+            case NbRoutine::potrf:
+                lapack::potrf( uplo, n, &A[0], lda );
+                break;
+            case NbRoutine::hetrd:
+                lapack::hetrd( uplo, n, &A[0], lda, &D[0], &E[0], &tau[0] );
+                break;
+            case NbRoutine::gehrd:
+                lapack::gehrd( n, 1, n, &A[0], lda, &tau[0] );
+                break;
+        }
+    };
+    auto reset = [&]() { std::copy( A0.begin(), A0.end(), A.begin() ); };
+
+    // ---------- time backend's default block size
+    // remove any entry for this size, e.g., from a previous run
+    lapack::set_block_size( name, 0, -1, size );
+    int64_t calls = lapack::ilaenv_override_calls();
+    double default_time = time_driver( params, call, reset );
+    if (lapack::ilaenv_override_calls() == calls) {
+        params.msg() = "skipping: LAPACK backend doesn't call ilaenv";
+        return;
+    }
+
+    // ---------- time each candidate block size
+    const int64_t candidates[] = { 8, 16, 24, 32, 48, 64, 96, 128, 192, 256 };
+    double best_time = std::numeric_limits<double>::infinity();
+    int64_t best = 0;
+    for (int64_t nb : candidates) {
+        if (nb >= minmn && nb != candidates[ 0 ])
+            break;
+        lapack::set_block_size( name, nb, -1, size );
+        double time = time_driver( params, call, reset );
+        if (verbose >= 1)
+            printf( "    nb %4lld %10.4f\n", (long long) nb, time );
+        if (time < best_time) {
+            best_time = time;
+            best = nb;
+        }
+    }
+    // keep entry only if saved to tuning file
+    if (params.tuning().empty())
+        lapack::set_block_size( name, 0, -1, size );
+
+    params.time() = best_time;
+    params.ref_time() = default_time;
+    params.nb_out() = best;
+
+    if (! params.tuning().empty()) {
+        lapack::set_block_size( name, best, -1, size );
+        lapack::save_tuning_table( params.tuning() );
+    }
+    params.okay() = true;
+}
+
+// -----------------------------------------------------------------------------
+// Routines that autotune-backend-* route among backends.
+enum class BackendRoutine { getrf, potrf, geqrf, heevd, gesdd };
+
+// Returns LAPACK name that routine is dispatched by, e.g., dgetrf, zheevd.
+template< typename scalar_t >
+std::string backend_routine_name( char type, BackendRoutine routine )
+{
+    std::string name( 1, type );
+    bool is_complex = blas::is_complex< scalar_t >::value;
+    switch (routine) {
+        case BackendRoutine::getrf: name += "getrf"; break;
+        case BackendRoutine::potrf: name += "potrf"; break;
+        case BackendRoutine::geqrf: name += "geqrf"; break;
+        case BackendRoutine::heevd: name += (is_complex ? "heevd" : "syevd"); break;
+        case BackendRoutine::gesdd: name += "gesdd"; break;
+    }
+    return name;
+}
+
+// -----------------------------------------------------------------------------
+// Times routine in the default LAPACK and each backend, routed via
+// lapack::set_backend, and reports the fastest backend, its time, and,
+// as ref_time, the default's time. With --check y, also checks that each
+// backend's results agree with the default's, which catches, e.g., a
+// backend with a different integer size.
+template< typename scalar_t >
+void test_autotune_backend_work(
+    Params& params, bool run, BackendRoutine routine )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    int64_t n = params.dim.n();
+    int64_t verbose = params.verbose();
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+    mark_autotune( params );
+
+    // getrf, geqrf, gesdd are m-by-n; potrf, heevd are n-by-n with uplo
+    int64_t m = n;
+    lapack::Uplo uplo = lapack::Uplo::Lower;
+    lapack::Job jobz = lapack::Job::NoVec;
+    if (routine == BackendRoutine::getrf || routine == BackendRoutine::geqrf
+        || routine == BackendRoutine::gesdd)
+        m = params.dim.m();
+    if (routine == BackendRoutine::potrf || routine == BackendRoutine::heevd)
+        uplo = params.uplo();
+    if (routine == BackendRoutine::heevd || routine == BackendRoutine::gesdd)
+        jobz = params.jobz();
+
+    if (! run)
+        return;
+
+    if (! lapack::dispatch_enabled()) {
+        params.msg() = "skipping: requires LAPACK++ built with dispatch";
+        return;
+    }
+    std::vector< std::string > backends = lapack::get_backends();
+    if (backends.empty()) {
+        params.msg() = "skipping: no backends; add them to the tuning file";
+        return;
+    }
+    backends.insert( backends.begin(), "default" );
+
+    // ---------- setup
+    std::string name = backend_routine_name< scalar_t >( type_char( params ), routine );
+    int64_t minmn = blas::min( m, n );
+    int64_t size = (routine == BackendRoutine::potrf
+                    || routine == BackendRoutine::heevd ? n : blas::max( m, n ));
+    int64_t lda = blas::max( 1, m );
+    int64_t ldu = blas::max( 1, m );
+    int64_t ldvt = blas::max( 1, minmn );
+    size_t size_A = (size_t) lda * n;
+    std::vector< scalar_t > A0( size_A ), A( size_A ), tau( blas::max( 1, minmn ) );
+    std::vector< scalar_t > U( ldu * minmn ), VT( ldvt * n );
+    std::vector< real_t > S( blas::max( 1, minmn ) );
+    std::vector< int64_t > ipiv( blas::max( 1, minmn ) );
+    lapack::generate_matrix( params.matrix, m, n, &A0[0], lda );
+    if (routine == BackendRoutine::potrf) {
+        // make positive definite
+        for (int64_t i = 0; i < n; ++i)
+            A0[ i + i*lda ] = std::abs( A0[ i + i*lda ] ) + real_t( n );
+    }
+
+    int64_t info = 0;
+    auto call = [&]() {
+        switch (routine) {
+            case BackendRoutine::getrf:
+                info = lapack::getrf( m, n, &A[0], lda, &ipiv[0] );
+                break;
+            case BackendRoutine::potrf:
+                info = lapack::potrf( uplo, n, &A[0], lda );
+                break;
+            case BackendRoutine::geqrf:
+                info = lapack::geqrf( m, n, &A[0], lda, &tau[0] );
+                break;
+            case BackendRoutine::heevd:
+                info = lapack::heevd( jobz, uplo, n, &A[0], lda, &S[0] );
+                break;
+            case BackendRoutine::gesdd:
+                info = lapack::gesdd( jobz == lapack::Job::NoVec
+                                          ? lapack::Job::NoVec
+                                          : lapack::Job::SomeVec,
+                                      m, n, &A[0], lda, &S[0],
+                                      &U[0], ldu, &VT[0], ldvt );
+                break;
+        }
+    };
+    auto reset = [&]() { std::copy( A0.begin(), A0.end(), A.begin() ); };
+
+    // results compared: eigen or singular values, else the factored matrix
+    bool values = (routine == BackendRoutine::heevd
+                   || routine == BackendRoutine::gesdd);
+    std::vector< scalar_t > A_ref;
+    std::vector< real_t > S_ref;
+
+    // ---------- time each backend
+    // remove any route for this size, e.g., from a previous run
+    lapack::set_backend( name, "", size );
+    double best_time = std::numeric_limits<double>::infinity();
+    double default_time = testsweeper::no_data_flag;
+    std::string best = "default";
+    real_t error = 0;
+    for (auto const& backend : backends) {
+        lapack::set_backend( name, backend, size );
+        double time = time_driver( params, call, reset );
+        if (info != 0) {
+            fprintf( stderr, "lapack::%s in backend %s returned error %lld\n",
+                     name.c_str(), backend.c_str(), (long long) info );
+            continue;
+        }
+        if (verbose >= 1) {
+            printf( "    %-12s %10.4f\n", backend.c_str(), time );
+        }
+
+        // ---------- check results agree with the default's
+        if (params.check() == 'y') {
+            if (backend == "default") {
+                A_ref = A;
+                S_ref = S;
+            }
+            else if (! A_ref.empty()) {
+                real_t norm = 0, diff = 0;
+                if (values) {
+                    for (size_t i = 0; i < S.size(); ++i) {
+                        norm = blas::max( norm, std::abs( S_ref[ i ] ) );
+                        diff = blas::max( diff, std::abs( S[ i ] - S_ref[ i ] ) );
+                    }
+                }
+                else {
+                    for (size_t i = 0; i < A.size(); ++i) {
+                        norm = blas::max( norm, std::abs( A_ref[ i ] ) );
+                        diff = blas::max( diff, std::abs( A[ i ] - A_ref[ i ] ) );
+                    }
+                }
+                if (norm != 0)
+                    diff /= norm;
+                error = blas::max( error, diff / blas::max( 1, size ) );
+            }
+        }
+
+        if (time < best_time) {
+            best_time = time;
+            best = backend;
+        }
+        if (backend == "default")
+            default_time = time;
+    }
+    // keep route only if saved to tuning file
+    lapack::set_backend( name, "", size );
+
+    params.time() = best_time;
+    params.ref_time() = default_time;
+    params.driver() = best;
+
+    if (! params.tuning().empty()) {
+        lapack::set_backend( name, best, size );
+        lapack::save_tuning_table( params.tuning() );
+    }
+
+    if (params.check() == 'y') {
+        params.error() = error;
+        params.okay() = (error < tol);
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_autotune_eig( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Integer:
+            throw std::exception();
+            break;
+
+        case testsweeper::DataType::Single:
+            test_autotune_eig_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_autotune_eig_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_autotune_eig_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_autotune_eig_work< std::complex<double> >( params, run );
+            break;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_autotune_svd( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Integer:
+            throw std::exception();
+            break;
+
+        case testsweeper::DataType::Single:
+            test_autotune_svd_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_autotune_svd_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_autotune_svd_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_autotune_svd_work< std::complex<double> >( params, run );
+            break;
+    }
+}
+
+// -----------------------------------------------------------------------------
+static void test_autotune_nb( Params& params, bool run, NbRoutine routine )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Integer:
+            throw std::exception();
+            break;
+
+        case testsweeper::DataType::Single:
+            test_autotune_nb_work< float >( params, run, routine );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_autotune_nb_work< double >( params, run, routine );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_autotune_nb_work< std::complex<float> >( params, run, routine );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_autotune_nb_work< std::complex<double> >( params, run, routine );
+            break;
+    }
+}
+
+// -----------------------------------------------------------------------------
+static void test_autotune_backend(
+    Params& params, bool run, BackendRoutine routine )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Integer:
+            throw std::exception();
+            break;
+
+        case testsweeper::DataType::Single:
+            test_autotune_backend_work< float >( params, run, routine );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_autotune_backend_work< double >( params, run, routine );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_autotune_backend_work< std::complex<float> >( params, run, routine );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_autotune_backend_work< std::complex<double> >( params, run, routine );
+            break;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_autotune_nb_getrf( Params& params, bool run )
+{
+    test_autotune_nb( params, run, NbRoutine::getrf );
+}
+
+void test_autotune_nb_geqrf( Params& params, bool run )
+{
+    test_autotune_nb( params, run, NbRoutine::geqrf );
+}
+
+void test_autotune_nb_potrf( Params& params, bool run )
+{
+    test_autotune_nb( params, run, NbRoutine::potrf );
+}
+
+void test_autotune_nb_hetrd( Params& params, bool run )
+{
+    test_autotune_nb( params, run, NbRoutine::hetrd );
+}
+
+void test_autotune_nb_gehrd( Params& params, bool run )
+{
+    test_autotune_nb( params, run, NbRoutine::gehrd );
+}
+
+// -----------------------------------------------------------------------------
+void test_autotune_backend_getrf( Params& params, bool run )
+{
+    test_autotune_backend( params, run, BackendRoutine::getrf );
+}
+
+void test_autotune_backend_potrf( Params& params, bool run )
+{
+    test_autotune_backend( params, run, BackendRoutine::potrf );
+}
+
+void test_autotune_backend_geqrf( Params& params, bool run )
+{
+    test_autotune_backend( params, run, BackendRoutine::geqrf );
+}
+
+void test_autotune_backend_heevd( Params& params, bool run )
+{
+    test_autotune_backend( params, run, BackendRoutine::heevd );
+}
+
+void test_autotune_backend_gesdd( Params& params, bool run )
+{
+    test_autotune_backend( params, run, BackendRoutine::gesdd );
+}
@@ -0,0 +1,1207 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+// Tests factorization objects lapack::LU, Cholesky, LDLT, QR, StreamingLS,
+// ShiftedHessenberg, ShiftedHermitian, GeneralizedEigen, LSE, and GLM
+// (lapack/factor.hh).
+// LU, Cholesky, LDLT, and QR each factor A, then refactors 2A in the same object, which must reuse its
+// storage, and checks the solve's backward error, that logdet grows by
+// n log 2, and that rcond matches the lapack:: con routine.
+// time is the refactor & solve; ref_time is the same with the lapack::
+// wrappers, which allocate workspace on every call.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "lapack/factor.hh"
+#include "print_matrix.hh"
+#include "error.hh"
+
+#include <cmath>
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// @return relative backward error || B - op(A) X ||_1 / (n ||A||_1 ||X||_1),
+// for A general (uplo = General) or Hermitian (uplo = Lower or Upper).
+// Overwrites B with the residual.
+template< typename scalar_t >
+blas::real_type< scalar_t > backward_error(
+    lapack::Uplo uplo, lapack::Op trans, int64_t n, int64_t nrhs,
+    scalar_t const* A, int64_t lda,
+    scalar_t const* X, scalar_t* B, int64_t ldb )
+{
+    using real_t = blas::real_type< scalar_t >;
+    const scalar_t one = 1.0;
+    real_t Anorm;
+    if (uplo == lapack::Uplo::General) {
+        blas::gemm( blas::Layout::ColMajor, trans, blas::Op::NoTrans,
+                    n, nrhs, n,
+                    -one, A, lda, X, ldb, one, B, ldb );
+        Anorm = lapack::lange( lapack::Norm::One, n, n, A, lda );
+    }
+    else {
+        blas::hemm( blas::Layout::ColMajor, blas::Side::Left, uplo, n, nrhs,
+                    -one, A, lda, X, ldb, one, B, ldb );
+        Anorm = lapack::lanhe( lapack::Norm::One, uplo, n, A, lda );
+    }
+    real_t error = lapack::lange( lapack::Norm::One, n, nrhs, B, ldb );
+    real_t Xnorm = lapack::lange( lapack::Norm::One, n, nrhs, X, ldb );
+    if (n > 0 && Anorm > 0 && Xnorm > 0)
+        error /= (n * Anorm * Xnorm);
+    return error;
+}
+
+// -----------------------------------------------------------------------------
+// Marks params common to all factor-* tests.
+inline void mark_factor( Params& params )
+{
+    params.nrhs();
+    params.matrix.mark();
+    params.ref_time();
+    params.error();
+    params.error2();
+    params.error2.name( "logdet\nerror" );
+    params.error3();
+    params.error3.name( "rcond\nerror" );
+}
+
+// -----------------------------------------------------------------------------
+template< typename scalar_t >
+void test_factor_lu_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    lapack::Op trans = params.trans();
+    int64_t n = params.dim.n();
+    int64_t nrhs = params.nrhs();
+    int64_t verbose = params.verbose();
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+    mark_factor( params );
+
+    if (! run)
+        return;
+
+    // ---------- setup
+    int64_t lda = blas::max( 1, n );
+    int64_t ldb = blas::max( 1, n );
+    std::vector< scalar_t > A( lda*n ), A2( lda*n );
+    std::vector< scalar_t > B0( ldb*nrhs ), X( ldb*nrhs ), R( ldb*nrhs );
+    lapack::generate_matrix( params.matrix, n, n, &A[0], lda );
+    for (size_t i = 0; i < A.size(); ++i)
+        A2[ i ] = real_t( 2 ) * A[ i ];
+    int64_t idist = 1;
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+    lapack::larnv( idist, iseed, B0.size(), &B0[0] );
+
+    // ---------- run test
+    lapack::LU< scalar_t > lu( n, n );
+    lu.factor( &A[0], lda );
+    scalar_t sign1;
+    real_t logdet1 = lu.logdet( &sign1 );
+    scalar_t const* data = lu.data();
+
+    X = B0;
+    double time = testsweeper::get_wtime();
+    int64_t info = lu.factor( &A2[0], lda );
+    lu.solve( trans, nrhs, &X[0], ldb );
+    params.time() = testsweeper::get_wtime() - time;
+    if (info != 0)
+        fprintf( stderr, "lapack::LU::factor returned error %lld\n", llong( info ) );
+    if (verbose >= 2) {
+        printf( "X = " ); print_matrix( n, nrhs, &X[0], ldb );
+    }
+
+    if (params.check() == 'y') {
+        // ---------- check error
+        R = B0;
+        params.error() = backward_error(
+            lapack::Uplo::General, trans, n, nrhs, &A2[0], lda, &X[0], &R[0], ldb );
+
+        // det( 2A ) = 2^n det( A ), same sign
+        scalar_t sign2;
+        real_t logdet2 = lu.logdet( &sign2 );
+        params.error2() = std::abs( logdet2 - logdet1 - n*std::log( 2. ) )
+                          / blas::max( 1, n )
+                          + std::abs( sign2 - sign1 );
+
+        // rcond matches gecon
+        real_t Anorm = lapack::lange( lapack::Norm::One, n, n, &A2[0], lda );
+        real_t rcond_ref;
+        lapack::gecon( lapack::Norm::One, n, lu.data(), lu.lda(), Anorm, &rcond_ref );
+        params.error3() = std::abs( lu.rcond() - rcond_ref ) / rcond_ref;
+
+        params.okay() = (params.error() < tol
+                         && params.error2() < 3*tol
+                         && params.error3() < 3*tol
+                         && lu.data() == data);
+    }
+
+    if (params.ref() == 'y') {
+        // ---------- run reference
+        std::vector< int64_t > ipiv( n );
+        X = B0;
+        time = testsweeper::get_wtime();
+        lapack::getrf( n, n, &A2[0], lda, &ipiv[0] );
+        lapack::getrs( trans, n, nrhs, &A2[0], lda, &ipiv[0], &X[0], ldb );
+        params.ref_time() = testsweeper::get_wtime() - time;
+    }
+}
+
+// -----------------------------------------------------------------------------
+template< typename scalar_t >
+void test_factor_cholesky_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    lapack::Uplo uplo = params.uplo();
+    int64_t n = params.dim.n();
+    int64_t nrhs = params.nrhs();
+    int64_t verbose = params.verbose();
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+    mark_factor( params );
+
+    if (! run) {
+        params.matrix.kind.set_default( "rand_dominant" );
+        return;
+    }
+
+    // ---------- setup
+    int64_t lda = blas::max( 1, n );
+    int64_t ldb = blas::max( 1, n );
+    std::vector< scalar_t > A( lda*n ), A2( lda*n );
+    std::vector< scalar_t > B0( ldb*nrhs ), X( ldb*nrhs ), R( ldb*nrhs );
+    lapack::generate_matrix( params.matrix, n, n, &A[0], lda );
+    for (size_t i = 0; i < A.size(); ++i)
+        A2[ i ] = real_t( 2 ) * A[ i ];
+    int64_t idist = 1;
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+    lapack::larnv( idist, iseed, B0.size(), &B0[0] );
+
+    // ---------- run test
+    lapack::Cholesky< scalar_t > chol( uplo, n );
+    chol.factor( &A[0], lda );
+    real_t logdet1 = chol.logdet();
+    scalar_t const* data = chol.data();
+
+    X = B0;
+    double time = testsweeper::get_wtime();
+    int64_t info = chol.factor( &A2[0], lda );
+    chol.solve( nrhs, &X[0], ldb );
+    params.time() = testsweeper::get_wtime() - time;
+    if (info != 0)
+        fprintf( stderr, "lapack::Cholesky::factor returned error %lld\n", llong( info ) );
+    if (verbose >= 2) {
+        printf( "X = " ); print_matrix( n, nrhs, &X[0], ldb );
+    }
+
+    if (params.check() == 'y') {
+        // ---------- check error
+        R = B0;
+        params.error() = backward_error(
+            uplo, lapack::Op::NoTrans, n, nrhs, &A2[0], lda, &X[0], &R[0], ldb );
+
+        real_t logdet2 = chol.logdet();
+        params.error2() = std::abs( logdet2 - logdet1 - n*std::log( 2. ) )
+                          / blas::max( 1, n );
+
+        real_t Anorm = lapack::lanhe( lapack::Norm::One, uplo, n, &A2[0], lda );
+        real_t rcond_ref;
+        lapack::pocon( uplo, n, chol.data(), chol.lda(), Anorm, &rcond_ref );
+        params.error3() = std::abs( chol.rcond() - rcond_ref ) / rcond_ref;
+
+        params.okay() = (params.error() < tol
+                         && params.error2() < 3*tol
+                         && params.error3() < 3*tol
+                         && chol.data() == data);
+    }
+
+    if (params.ref() == 'y') {
+        // ---------- run reference
+        X = B0;
+        time = testsweeper::get_wtime();
+        lapack::potrf( uplo, n, &A2[0], lda );
+        lapack::potrs( uplo, n, nrhs, &A2[0], lda, &X[0], ldb );
+        params.ref_time() = testsweeper::get_wtime() - time;
+    }
+}
+
+// -----------------------------------------------------------------------------
+template< typename scalar_t >
+void test_factor_ldlt_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    lapack::Uplo uplo = params.uplo();
+    int64_t n = params.dim.n();
+    int64_t nrhs = params.nrhs();
+    int64_t verbose = params.verbose();
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+    mark_factor( params );
+
+    if (! run)
+        return;
+
+    // ---------- setup
+    int64_t lda = blas::max( 1, n );
+    int64_t ldb = blas::max( 1, n );
+    std::vector< scalar_t > A( lda*n ), A2( lda*n );
+    std::vector< scalar_t > B0( ldb*nrhs ), X( ldb*nrhs ), R( ldb*nrhs );
+    lapack::generate_matrix( params.matrix, n, n, &A[0], lda );
+    // Hermitian, so diagonal is real
+    for (int64_t i = 0; i < n; ++i)
+        A[ i + i*lda ] = std::real( A[ i + i*lda ] );
+    for (size_t i = 0; i < A.size(); ++i)
+        A2[ i ] = real_t( 2 ) * A[ i ];
+    int64_t idist = 1;
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+    lapack::larnv( idist, iseed, B0.size(), &B0[0] );
+
+    // ---------- run test
+    lapack::LDLT< scalar_t > ldlt( uplo, n );
+    ldlt.factor( &A[0], lda );
+    real_t sign1;
+    real_t logdet1 = ldlt.logdet( &sign1 );
+    scalar_t const* data = ldlt.data();
+
+    X = B0;
+    double time = testsweeper::get_wtime();
+    int64_t info = ldlt.factor( &A2[0], lda );
+    ldlt.solve( nrhs, &X[0], ldb );
+    params.time() = testsweeper::get_wtime() - time;
+    if (info != 0)
+        fprintf( stderr, "lapack::LDLT::factor returned error %lld\n", llong( info ) );
+    if (verbose >= 2) {
+        printf( "X = " ); print_matrix( n, nrhs, &X[0], ldb );
+    }
+
+    if (params.check() == 'y') {
+        // ---------- check error
+        R = B0;
+        params.error() = backward_error(
+            uplo, lapack::Op::NoTrans, n, nrhs, &A2[0], lda, &X[0], &R[0], ldb );
+
+        real_t sign2;
+        real_t logdet2 = ldlt.logdet( &sign2 );
+        params.error2() = std::abs( logdet2 - logdet1 - n*std::log( 2. ) )
+                          / blas::max( 1, n )
+                          + std::abs( sign2 - sign1 );
+
+        real_t Anorm = lapack::lanhe( lapack::Norm::One, uplo, n, &A2[0], lda );
+        std::vector< int64_t > ipiv( ldlt.ipiv(), ldlt.ipiv() + n );
+        real_t rcond_ref;
+        lapack::hecon( uplo, n, ldlt.data(), ldlt.lda(), &ipiv[0], Anorm,
+                       &rcond_ref );
+        params.error3() = std::abs( ldlt.rcond() - rcond_ref ) / rcond_ref;
+
+        params.okay() = (params.error() < tol
+                         && params.error2() < 3*tol
+                         && params.error3() < 3*tol
+                         && ldlt.data() == data);
+    }
+
+    if (params.ref() == 'y') {
+        // ---------- run reference
+        std::vector< int64_t > ipiv( n );
+        X = B0;
+        time = testsweeper::get_wtime();
+        lapack::hetrf( uplo, n, &A2[0], lda, &ipiv[0] );
+        lapack::hetrs( uplo, n, nrhs, &A2[0], lda, &ipiv[0], &X[0], ldb );
+        params.ref_time() = testsweeper::get_wtime() - time;
+    }
+}
+
+// -----------------------------------------------------------------------------
+template< typename scalar_t >
+void test_factor_qr_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    int64_t m = params.dim.m();
+    int64_t n = params.dim.n();
+    int64_t nrhs = params.nrhs();
+    int64_t verbose = params.verbose();
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+    params.nrhs();
+    params.matrix.mark();
+    params.ref_time();
+    params.error();
+    params.error2();
+    params.error2.name( "Q^H Q\nerror" );
+    params.error3();
+    params.error3.name( "rcond\nerror" );
+
+    if (! run)
+        return;
+
+    if (m < n) {
+        params.msg() = "skipping: requires m >= n";
+        return;
+    }
+
+    // ---------- setup
+    const scalar_t one = 1.0;
+    int64_t lda = blas::max( 1, m );
+    int64_t ldb = blas::max( 1, m );
+    std::vector< scalar_t > A( lda*n ), A2( lda*n );
+    std::vector< scalar_t > B0( ldb*nrhs ), X( ldb*nrhs ), R( ldb*nrhs );
+    std::vector< scalar_t > AR( n*nrhs );
+    lapack::generate_matrix( params.matrix, m, n, &A[0], lda );
+    for (size_t i = 0; i < A.size(); ++i)
+        A2[ i ] = real_t( 2 ) * A[ i ];
+    int64_t idist = 1;
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+    lapack::larnv( idist, iseed, B0.size(), &B0[0] );
+
+    // ---------- run test
+    lapack::QR< scalar_t > qr( m, n );
+    qr.factor( &A[0], lda );
+    scalar_t const* data = qr.data();
+
+    X = B0;
+    double time = testsweeper::get_wtime();
+    qr.factor( &A2[0], lda );
+    qr.solve( nrhs, &X[0], ldb );
+    params.time() = testsweeper::get_wtime() - time;
+    if (verbose >= 2) {
+        printf( "X = " ); print_matrix( n, nrhs, &X[0], ldb );
+    }
+
+    if (params.check() == 'y') {
+        // ---------- check error
+        // Least squares: || A^H (B - A X) ||_1 / (m ||A||_1 (||A||_1 ||X||_1 + ||B||_1)).
+        R = B0;
+        blas::gemm( blas::Layout::ColMajor, blas::Op::NoTrans, blas::Op::NoTrans,
+                    m, nrhs, n,
+                    -one, &A2[0], lda, &X[0], ldb, one, &R[0], ldb );
+        blas::gemm( blas::Layout::ColMajor, blas::Op::ConjTrans, blas::Op::NoTrans,
+                    n, nrhs, m,
+                    one, &A2[0], lda, &R[0], ldb, 0.0, &AR[0], blas::max( 1, n ) );
+        real_t Anorm = lapack::lange( lapack::Norm::One, m, n, &A2[0], lda );
+        real_t Xnorm = lapack::lange( lapack::Norm::One, n, nrhs, &X[0], ldb );
+        real_t Bnorm = lapack::lange( lapack::Norm::One, m, nrhs, &B0[0], ldb );
+        real_t error = lapack::lange( lapack::Norm::One, n, nrhs, &AR[0],
+                                      blas::max( 1, n ) );
+        if (Anorm > 0 && Bnorm > 0)
+            error /= (m * Anorm * (Anorm * Xnorm + Bnorm));
+        params.error() = error;
+
+        // apply_Q: Q Q^H B = B
+        R = B0;
+        qr.apply_Q( lapack::Side::Left, lapack::Op::ConjTrans, m, nrhs, &R[0], ldb );
+        qr.apply_Q( lapack::Side::Left, lapack::Op::NoTrans,   m, nrhs, &R[0], ldb );
+        blas::axpy( R.size(), -one, &B0[0], 1, &R[0], 1 );
+        params.error2() = lapack::lange( lapack::Norm::One, m, nrhs, &R[0], ldb )
+                          / (m * blas::max( Bnorm, eps ));
+
+        real_t rcond_ref;
+        lapack::trcon( lapack::Norm::One, lapack::Uplo::Upper, lapack::Diag::NonUnit,
+                       n, qr.data(), qr.lda(), &rcond_ref );
+        params.error3() = std::abs( qr.rcond() - rcond_ref ) / rcond_ref;
+
+        params.okay() = (params.error() < tol
+                         && params.error2() < tol
+                         && params.error3() < 3*tol
+                         && qr.data() == data);
+    }
+
+    if (params.ref() == 'y') {
+        // ---------- run reference
+        std::vector< scalar_t > tau( n );
+        X = B0;
+        time = testsweeper::get_wtime();
+        lapack::geqrf( m, n, &A2[0], lda, &tau[0] );
+        lapack::unmqr( lapack::Side::Left, lapack::Op::ConjTrans, m, nrhs, n,
+                       &A2[0], lda, &tau[0], &X[0], ldb );
+        lapack::trtrs( lapack::Uplo::Upper, lapack::Op::NoTrans,
+                       lapack::Diag::NonUnit, n, nrhs, &A2[0], lda, &X[0], ldb );
+        params.ref_time() = testsweeper::get_wtime() - time;
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Adds A in row blocks of nb rows with random weights, and compares the
+// solution and residual norm with gels on the weighted A, all at once.
+template< typename scalar_t >
+void test_streaming_ls_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    int64_t m = params.dim.m();
+    int64_t n = params.dim.n();
+    int64_t nrhs = params.nrhs();
+    int64_t nb = params.nb();
+    int64_t verbose = params.verbose();
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+    params.matrix.mark();
+    params.ref_time();
+    params.error();
+    params.error2();
+    params.error2.name( "rnorm\nerror" );
+
+    if (! run)
+        return;
+
+    if (m < n || nb < 1) {
+        params.msg() = "skipping: requires m >= n and nb >= 1";
+        return;
+    }
+
+    // ---------- setup
+    int64_t lda = blas::max( 1, m );
+    int64_t ldb = blas::max( 1, m );
+    int64_t ldx = blas::max( 1, n );
+    std::vector< scalar_t > A( lda*n ), B( ldb*nrhs ), X( ldx*nrhs );
+    std::vector< real_t > weights( m ), rnorm( nrhs );
+    lapack::generate_matrix( params.matrix, m, n, &A[0], lda );
+    int64_t idist = 1;
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+    lapack::larnv( idist, iseed, B.size(), &B[0] );
+    // weights in [0.5, 1.5)
+    lapack::larnv( idist, iseed, weights.size(), &weights[0] );
+    for (auto& w : weights)
+        w += 0.5;
+
+    // ---------- run test
+    double time = testsweeper::get_wtime();
+    lapack::StreamingLS< scalar_t > ls( n, nrhs );
+    for (int64_t i = 0; i < m; i += nb) {
+        int64_t ib = blas::min( nb, m - i );
+        ls.add( ib, &A[ i ], lda, &B[ i ], ldb, &weights[ i ] );
+    }
+    ls.solve( &X[0], ldx );
+    ls.residual_norm( &rnorm[0] );
+    params.time() = testsweeper::get_wtime() - time;
+    if (verbose >= 2) {
+        printf( "X = " ); print_matrix( n, nrhs, &X[0], ldx );
+    }
+
+    if (params.check() == 'y' || params.ref() == 'y') {
+        // ---------- run reference: gels on W^{1/2} A, W^{1/2} B
+        for (int64_t i = 0; i < m; ++i) {
+            real_t sw = std::sqrt( weights[ i ] );
+            blas::scal( n,    sw, &A[ i ], lda );
+            blas::scal( nrhs, sw, &B[ i ], ldb );
+        }
+        time = testsweeper::get_wtime();
+        int64_t info = lapack::gels( lapack::Op::NoTrans, m, n, nrhs,
+                                     &A[0], lda, &B[0], ldb );
+        params.ref_time() = testsweeper::get_wtime() - time;
+        if (info != 0)
+            fprintf( stderr, "lapack::gels returned error %lld\n", llong( info ) );
+
+        // ---------- check error
+        // || X - X_ref ||_1 / || X_ref ||_1, and max_j |rnorm_j - rnorm_ref_j| / rnorm_ref_j
+        real_t Xnorm = lapack::lange( lapack::Norm::One, n, nrhs, &B[0], ldb );
+        for (int64_t j = 0; j < nrhs; ++j)
+            blas::axpy( n, -1.0, &B[ j*ldb ], 1, &X[ j*ldx ], 1 );
+        real_t error = lapack::lange( lapack::Norm::One, n, nrhs, &X[0], ldx );
+        if (Xnorm > 0)
+            error /= Xnorm;
+
+        real_t error2 = 0;
+        for (int64_t j = 0; j < nrhs; ++j) {
+            real_t rnorm_ref = blas::nrm2( m - n, &B[ n + j*ldb ], 1 );
+            if (rnorm_ref > 0)
+                error2 = blas::max( error2, std::abs( rnorm[ j ] - rnorm_ref ) / rnorm_ref );
+        }
+        params.error() = error;
+        params.error2() = error2;
+        // X is as accurate as the conditioning allows; compare loosely
+        params.okay() = (error < 100*tol && error2 < tol);
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Solves (A - sigma_s I) X_s = B for nshift = k random shifts, after one
+// Hessenberg reduction, and checks each shift's backward error.
+// ref_time is gesv for each shift.
+template< typename scalar_t >
+void test_shifted_hessenberg_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    int64_t n = params.dim.n();
+    int64_t nshift = params.dim.k();
+    int64_t nrhs = params.nrhs();
+    int64_t verbose = params.verbose();
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+    params.matrix.mark();
+    params.ref_time();
+    params.error();
+    params.error2();
+    params.error2.name( "single\nerror" );
+
+    if (! run)
+        return;
+
+    // ---------- setup
+    int64_t lda = blas::max( 1, n );
+    int64_t ldb = blas::max( 1, n );
+    std::vector< scalar_t > A( lda*n ), As( lda*n );
+    std::vector< scalar_t > B( ldb*nrhs ), R( ldb*nrhs ), X( ldb*nrhs*nshift );
+    std::vector< scalar_t > sigma( nshift );
+    lapack::generate_matrix( params.matrix, n, n, &A[0], lda );
+    int64_t idist = 1;
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+    lapack::larnv( idist, iseed, B.size(), &B[0] );
+    lapack::larnv( idist, iseed, sigma.size(), &sigma[0] );
+
+    // ---------- run test
+    double time = testsweeper::get_wtime();
+    lapack::ShiftedHessenberg< scalar_t > hess( n );
+    hess.factor( &A[0], lda );
+    hess.solve( nshift, &sigma[0], nrhs, &B[0], ldb, &X[0], ldb );
+    params.time() = testsweeper::get_wtime() - time;
+    if (verbose >= 2) {
+        printf( "X = " ); print_matrix( n, nrhs*nshift, &X[0], ldb );
+    }
+
+    if (params.check() == 'y') {
+        // ---------- check error
+        // max over shifts of || B - (A - sigma_s I) X_s ||_1
+        //                    / (n ||A - sigma_s I||_1 ||X_s||_1)
+        real_t error = 0;
+        for (int64_t s = 0; s < nshift; ++s) {
+            As = A;
+            for (int64_t i = 0; i < n; ++i)
+                As[ i + i*lda ] -= sigma[ s ];
+            R = B;
+            error = blas::max( error, backward_error(
+                lapack::Uplo::General, lapack::Op::NoTrans, n, nrhs,
+                &As[0], lda, &X[ s*nrhs*ldb ], &R[0], ldb ) );
+        }
+
+        // single shift solve matches batched solve
+        real_t error2 = 0;
+        if (nshift > 0) {
+            R = B;
+            hess.solve( sigma[ 0 ], nrhs, &R[0], ldb );
+            blas::axpy( R.size(), -1.0, &X[0], 1, &R[0], 1 );
+            real_t Xnorm = lapack::lange( lapack::Norm::One, n, nrhs, &X[0], ldb );
+            error2 = lapack::lange( lapack::Norm::One, n, nrhs, &R[0], ldb );
+            if (Xnorm > 0)
+                error2 /= Xnorm;
+        }
+        params.error() = error;
+        params.error2() = error2;
+        params.okay() = (error < tol && error2 < tol);
+    }
+
+    if (params.ref() == 'y') {
+        // ---------- run reference
+        std::vector< int64_t > ipiv( n );
+        time = testsweeper::get_wtime();
+        for (int64_t s = 0; s < nshift; ++s) {
+            As = A;
+            for (int64_t i = 0; i < n; ++i)
+                As[ i + i*lda ] -= sigma[ s ];
+            std::copy( B.begin(), B.end(), &X[ s*nrhs*ldb ] );
+            lapack::gesv( n, nrhs, &As[0], lda, &ipiv[0], &X[ s*nrhs*ldb ], ldb );
+        }
+        params.ref_time() = testsweeper::get_wtime() - time;
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Solves (A - sigma_s I) X_s = B for Hermitian A and nshift = k random shifts,
+// complex for complex types, after one tridiagonal reduction, and checks
+// each shift's backward error. ref_time is gesv for each shift.
+template< typename scalar_t >
+void test_shifted_hermitian_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    lapack::Uplo uplo = params.uplo();
+    int64_t n = params.dim.n();
+    int64_t nshift = params.dim.k();
+    int64_t nrhs = params.nrhs();
+    int64_t verbose = params.verbose();
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+    params.matrix.mark();
+    params.ref_time();
+    params.error();
+    params.error2();
+    params.error2.name( "single\nerror" );
+
+    if (! run)
+        return;
+
+    // ---------- setup
+    int64_t lda = blas::max( 1, n );
+    int64_t ldb = blas::max( 1, n );
+    std::vector< scalar_t > A( lda*n ), As( lda*n );
+    std::vector< scalar_t > B( ldb*nrhs ), R( ldb*nrhs ), X( ldb*nrhs*nshift );
+    std::vector< scalar_t > sigma( nshift );
+    lapack::generate_matrix( params.matrix, n, n, &A[0], lda );
+    // Hermitian, so diagonal is real
+    for (int64_t i = 0; i < n; ++i)
+        A[ i + i*lda ] = std::real( A[ i + i*lda ] );
+    int64_t idist = 1;
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+    lapack::larnv( idist, iseed, B.size(), &B[0] );
+    lapack::larnv( idist, iseed, sigma.size(), &sigma[0] );
+
+    // ---------- run test
+    double time = testsweeper::get_wtime();
+    lapack::ShiftedHermitian< scalar_t > herm( uplo, n );
+    herm.factor( &A[0], lda );
+    herm.solve( nshift, &sigma[0], nrhs, &B[0], ldb, &X[0], ldb );
+    params.time() = testsweeper::get_wtime() - time;
+    if (verbose >= 2) {
+        printf( "X = " ); print_matrix( n, nrhs*nshift, &X[0], ldb );
+    }
+
+    if (params.check() == 'y') {
+        // ---------- check error
+        // max over shifts of || B - (A - sigma_s I) X_s ||_1
+        //                    / (n (||A||_1 + |sigma_s|) ||X_s||_1)
+        real_t Anorm = lapack::lanhe( lapack::Norm::One, uplo, n, &A[0], lda );
+        real_t error = 0;
+        for (int64_t s = 0; s < nshift; ++s) {
+            scalar_t* Xs = &X[ s*nrhs*ldb ];
+            R = B;
+            blas::hemm( blas::Layout::ColMajor, blas::Side::Left, uplo, n, nrhs,
+                        -1.0, &A[0], lda, Xs, ldb, 1.0, &R[0], ldb );
+            blas::axpy( R.size(), sigma[ s ], Xs, 1, &R[0], 1 );
+            real_t Rnorm = lapack::lange( lapack::Norm::One, n, nrhs, &R[0], ldb );
+            real_t Xnorm = lapack::lange( lapack::Norm::One, n, nrhs, Xs, ldb );
+            real_t denom = n * (Anorm + std::abs( sigma[ s ] )) * Xnorm;
+            if (denom > 0)
+                error = blas::max( error, Rnorm / denom );
+        }
+
+        // single shift solve matches batched solve
+        real_t error2 = 0;
+        if (nshift > 0) {
+            R = B;
+            herm.solve( sigma[ 0 ], nrhs, &R[0], ldb );
+            blas::axpy( R.size(), -1.0, &X[0], 1, &R[0], 1 );
+            real_t Xnorm = lapack::lange( lapack::Norm::One, n, nrhs, &X[0], ldb );
+            error2 = lapack::lange( lapack::Norm::One, n, nrhs, &R[0], ldb );
+            if (Xnorm > 0)
+                error2 /= Xnorm;
+        }
+        params.error() = error;
+        params.error2() = error2;
+        params.okay() = (error < tol && error2 < tol);
+    }
+
+    if (params.ref() == 'y') {
+        // ---------- run reference, on the full Hermitian A
+        for (int64_t j = 0; j < n; ++j) {
+            for (int64_t i = 0; i < j; ++i) {
+                if (uplo == lapack::Uplo::Lower)
+                    A[ i + j*lda ] = blas::conj( A[ j + i*lda ] );
+                else
+                    A[ j + i*lda ] = blas::conj( A[ i + j*lda ] );
+            }
+        }
+        std::vector< int64_t > ipiv( n );
+        time = testsweeper::get_wtime();
+        for (int64_t s = 0; s < nshift; ++s) {
+            As = A;
+            for (int64_t i = 0; i < n; ++i)
+                As[ i + i*lda ] -= sigma[ s ];
+            std::copy( B.begin(), B.end(), &X[ s*nrhs*ldb ] );
+            lapack::gesv( n, nrhs, &As[0], lda, &ipiv[0], &X[ s*nrhs*ldb ], ldb );
+        }
+        params.ref_time() = testsweeper::get_wtime() - time;
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Solves the generalized eigenproblem for batch = k random Hermitian A with
+// one B, after one Cholesky factorization, and checks each residual and
+// that eigenvalues match hegvd. ref_time is hegvd for each A.
+template< typename scalar_t >
+void test_generalized_eigen_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    int64_t itype = params.itype();
+    lapack::Job jobz = params.jobz();
+    lapack::Uplo uplo = params.uplo();
+    int64_t n = params.dim.n();
+    int64_t batch = params.dim.k();
+    int64_t verbose = params.verbose();
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+    params.matrixB.mark();
+    params.ref_time();
+    params.error();
+    params.error2();
+    params.error2.name( "eig\nerror" );
+
+    if (! run) {
+        params.matrixB.kind.set_default( "rand_dominant" );
+        return;
+    }
+
+    // ---------- setup
+    int64_t lda = blas::max( 1, n );
+    int64_t ldw = blas::max( 1, n );
+    std::vector< scalar_t > A( lda*n*batch ), Z( lda*n*batch ), B( lda*n );
+    std::vector< real_t > W( ldw*batch ), W_ref( ldw*batch );
+    lapack::generate_matrix( params.matrixB, n, n, &B[0], lda );
+    int64_t idist = 1;
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+    lapack::larnv( idist, iseed, A.size(), &A[0] );
+    std::vector< scalar_t* > Zarray( batch );
+    for (int64_t b = 0; b < batch; ++b) {
+        // Hermitian, so diagonal is real
+        for (int64_t i = 0; i < n; ++i)
+            A[ i + i*lda + b*lda*n ] = std::real( A[ i + i*lda + b*lda*n ] );
+        Zarray[ b ] = &Z[ b*lda*n ];
+    }
+    Z = A;
+
+    // ---------- run test
+    double time = testsweeper::get_wtime();
+    lapack::GeneralizedEigen< scalar_t > geig( itype, uplo, n );
+    int64_t info = geig.factor( &B[0], lda );
+    if (info == 0)
+        info = geig.solve( jobz, batch, &Zarray[0], lda, &W[0], ldw );
+    params.time() = testsweeper::get_wtime() - time;
+    if (info != 0) {
+        fprintf( stderr, "lapack::GeneralizedEigen returned error %lld\n",
+                 (long long) info );
+    }
+    if (verbose >= 2) {
+        printf( "W = " ); print_matrix( n, batch, &W[0], ldw );
+    }
+
+    if (params.ref() == 'y' || params.check() == 'y') {
+        // ---------- run reference
+        std::vector< scalar_t > Aref( lda*n ), Bref( lda*n );
+        time = testsweeper::get_wtime();
+        for (int64_t b = 0; b < batch; ++b) {
+            std::copy( &A[ b*lda*n ], &A[ b*lda*n ] + lda*n, Aref.begin() );
+            Bref = B;
+            lapack::hegvd( itype, jobz, uplo, n, &Aref[0], lda, &Bref[0], lda,
+                           &W_ref[ b*ldw ] );
+        }
+        params.ref_time() = testsweeper::get_wtime() - time;
+    }
+
+    if (params.check() == 'y') {
+        // ---------- check error
+        // max over A of, for itype = 1, || A Z - B Z Lambda ||_1
+        //                       / (n (||A||_1 + ||B||_1 max |lambda|) ||Z||_1),
+        // or for itype = 2, 3, || A B Z - Z Lambda ||_1 or || B A Z - Z Lambda ||_1
+        //                       / (n (||A||_1 ||B||_1 + max |lambda|) ||Z||_1).
+        real_t Bnorm = lapack::lanhe( lapack::Norm::One, uplo, n, &B[0], lda );
+        std::vector< scalar_t > R( lda*n ), T( lda*n );
+        real_t error = 0;
+        for (int64_t b = 0; b < batch && jobz == lapack::Job::Vec; ++b) {
+            scalar_t const* Ab = &A[ b*lda*n ];
+            scalar_t const* Zb = Zarray[ b ];
+            real_t const* Wb = &W[ b*ldw ];
+            real_t Anorm = lapack::lanhe( lapack::Norm::One, uplo, n, Ab, lda );
+            real_t Znorm = lapack::lange( lapack::Norm::One, n, n, Zb, lda );
+            real_t Wmax = 0;
+            for (int64_t i = 0; i < n; ++i)
+                Wmax = blas::max( Wmax, std::abs( Wb[ i ] ) );
+
+            // T = Z Lambda
+            std::copy( Zb, Zb + lda*n, T.begin() );
+            for (int64_t j = 0; j < n; ++j)
+                blas::scal( n, Wb[ j ], &T[ j*lda ], 1 );
+            real_t denom;
+            if (itype == 1) {
+                // R = A Z - B T
+                blas::hemm( blas::Layout::ColMajor, blas::Side::Left, uplo, n, n,
+                            1.0, Ab, lda, Zb, lda, 0.0, &R[0], lda );
+                blas::hemm( blas::Layout::ColMajor, blas::Side::Left, uplo, n, n,
+                            -1.0, &B[0], lda, &T[0], lda, 1.0, &R[0], lda );
+                denom = n * (Anorm + Bnorm * Wmax) * Znorm;
+            }
+            else {
+                // R = X Y Z - T, with X Y = A B (itype 2) or B A (itype 3)
+                scalar_t const* X = (itype == 2 ? Ab : &B[0]);
+                scalar_t const* Y = (itype == 2 ? &B[0] : Ab);
+                std::vector< scalar_t > YZ( lda*n );
+                blas::hemm( blas::Layout::ColMajor, blas::Side::Left, uplo, n, n,
+                            1.0, Y, lda, Zb, lda, 0.0, &YZ[0], lda );
+                R = T;
+                blas::hemm( blas::Layout::ColMajor, blas::Side::Left, uplo, n, n,
+                            1.0, X, lda, &YZ[0], lda, -1.0, &R[0], lda );
+                denom = n * (Anorm * Bnorm + Wmax) * Znorm;
+            }
+            real_t Rnorm = lapack::lange( lapack::Norm::One, n, n, &R[0], lda );
+            if (denom > 0)
+                error = blas::max( error, Rnorm / denom );
+        }
+
+        // eigenvalues match hegvd, and single solve matches batched solve
+        real_t error2 = (info != 0 ? 1 : 0);
+        if (batch > 0 && n > 0) {
+            error2 += rel_error( W, W_ref );
+            std::vector< real_t > W0( n ), W1( &W[0], &W[0] + n );
+            std::copy( &A[0], &A[0] + lda*n, R.begin() );
+            geig.solve( jobz, &R[0], lda, &W0[0] );
+            error2 += rel_error( W0, W1 );
+        }
+        params.error() = error;
+        params.error2() = error2;
+        params.okay() = (error < tol && error2 < tol);
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Solves LSE for nrhs pairs (c, d), with m = dim.m, n = dim.n, p = dim.k,
+// after factoring B once, and checks the constraint residual and that X
+// matches gglse. ref_time is gglse for each pair.
+template< typename scalar_t >
+void test_lse_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    int64_t m = params.dim.m();
+    int64_t n = params.dim.n();
+    int64_t p = params.dim.k();
+    int64_t nrhs = params.nrhs();
+    int64_t verbose = params.verbose();
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+    params.matrix.mark();
+    params.matrixB.mark();
+    params.ref_time();
+    params.error();
+    params.error2();
+    params.msg();
+
+    if (! run) {
+        // Use well-conditioned matrices per LAWN 41.
+        params.matrix .kind.set_default( "svd" );
+        params.matrixB.kind.set_default( "svd" );
+        params.matrix .cond() = 100;
+        params.matrixB.cond() = 10;
+        return;
+    }
+
+    // skip invalid sizes
+    if (! ((0 <= p) && (p <= n) && (n <= m+p))) {
+        params.msg() = "skipping: requires 0 <= p <= n <= m+p";
+        return;
+    }
+
+    // ---------- setup
+    int64_t lda = blas::max( 1, m );
+    int64_t ldb = blas::max( 1, p );
+    int64_t ldx = blas::max( 1, n );
+    std::vector< scalar_t > A( lda*n ), B( ldb*n );
+    std::vector< scalar_t > C( lda*nrhs ), D( ldb*nrhs );
+    std::vector< scalar_t > X( ldx*nrhs ), X_ref( ldx*nrhs );
+    lapack::generate_matrix( params.matrix,  m, n, &A[0], lda );
+    lapack::generate_matrix( params.matrixB, p, n, &B[0], ldb );
+    int64_t idist = 1;
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+    lapack::larnv( idist, iseed, C.size(), &C[0] );
+    lapack::larnv( idist, iseed, D.size(), &D[0] );
+
+    // ---------- run test
+    double time = testsweeper::get_wtime();
+    lapack::LSE< scalar_t > lse( m, n, p );
+    int64_t info = lse.factor_B( &B[0], ldb );
+    if (info == 0)
+        info = lse.factor_A( &A[0], lda );
+    if (info == 0)
+        lse.solve( nrhs, &C[0], lda, &D[0], ldb, &X[0], ldx );
+    params.time() = testsweeper::get_wtime() - time;
+    if (info != 0) {
+        fprintf( stderr, "lapack::LSE returned error %lld\n", (long long) info );
+    }
+    if (verbose >= 2) {
+        printf( "X = " ); print_matrix( n, nrhs, &X[0], ldx );
+    }
+
+    if (params.ref() == 'y' || params.check() == 'y') {
+        // ---------- run reference, gglse for each pair
+        std::vector< scalar_t > Aref( lda*n ), Bref( ldb*n ), c( lda ), d( ldb );
+        time = testsweeper::get_wtime();
+        for (int64_t j = 0; j < nrhs; ++j) {
+            Aref = A;
+            Bref = B;
+            std::copy( &C[ j*lda ], &C[ j*lda ] + lda, c.begin() );
+            std::copy( &D[ j*ldb ], &D[ j*ldb ] + ldb, d.begin() );
+            lapack::gglse( m, n, p, &Aref[0], lda, &Bref[0], ldb, &c[0], &d[0],
+                           &X_ref[ j*ldx ] );
+        }
+        params.ref_time() = testsweeper::get_wtime() - time;
+    }
+
+    if (params.check() == 'y') {
+        // ---------- check error
+        // constraint || D - B X ||_1 / (n ||B||_1 ||X||_1),
+        // and || X - X_ref ||_2 / || X_ref ||_2.
+        real_t error = 0;
+        if (p > 0) {
+            real_t Bnorm = lapack::lange( lapack::Norm::One, p, n, &B[0], ldb );
+            real_t Xnorm = lapack::lange( lapack::Norm::One, n, nrhs, &X[0], ldx );
+            std::vector< scalar_t > R = D;
+            blas::gemm( blas::Layout::ColMajor, blas::Op::NoTrans, blas::Op::NoTrans,
+                        p, nrhs, n, -1.0, &B[0], ldb, &X[0], ldx, 1.0, &R[0], ldb );
+            error = lapack::lange( lapack::Norm::One, p, nrhs, &R[0], ldb );
+            if (Bnorm * Xnorm > 0)
+                error /= (n * Bnorm * Xnorm);
+        }
+        real_t error2 = (info != 0 ? 1 : 0);
+        if (n > 0 && nrhs > 0)
+            error2 += rel_error( X, X_ref );
+        params.error() = error;
+        params.error2() = error2;
+        params.okay() = (error < tol && error2 < tol);
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Solves GLM for nrhs d's, with n = dim.n, m = dim.m, p = dim.k, after
+// factoring A once, and checks the residual || D - A X - B Y || and that
+// X and Y match ggglm. ref_time is ggglm for each d.
+template< typename scalar_t >
+void test_glm_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    int64_t n = params.dim.n();
+    int64_t m = params.dim.m();
+    int64_t p = params.dim.k();
+    int64_t nrhs = params.nrhs();
+    int64_t verbose = params.verbose();
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+    params.matrix.mark();
+    params.matrixB.mark();
+    params.ref_time();
+    params.error();
+    params.error2();
+    params.msg();
+
+    if (! run) {
+        // Use well-conditioned matrices per LAWN 41.
+        params.matrix .kind.set_default( "svd" );
+        params.matrixB.kind.set_default( "svd" );
+        params.matrix .cond() = 100;
+        params.matrixB.cond() = 10;
+        return;
+    }
+
+    // skip invalid sizes
+    if (! ((0 <= m) && (m <= n) && (n <= m+p))) {
+        params.msg() = "skipping: requires 0 <= m <= n <= m+p";
+        return;
+    }
+
+    // ---------- setup
+    int64_t lda = blas::max( 1, n );
+    int64_t ldx = blas::max( 1, m );
+    int64_t ldy = blas::max( 1, p );
+    std::vector< scalar_t > A( lda*m ), B( lda*p ), D( lda*nrhs );
+    std::vector< scalar_t > X( ldx*nrhs ), X_ref( ldx*nrhs );
+    std::vector< scalar_t > Y( ldy*nrhs ), Y_ref( ldy*nrhs );
+    lapack::generate_matrix( params.matrix,  n, m, &A[0], lda );
+    lapack::generate_matrix( params.matrixB, n, p, &B[0], lda );
+    int64_t idist = 1;
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+    lapack::larnv( idist, iseed, D.size(), &D[0] );
+
+    // ---------- run test
+    double time = testsweeper::get_wtime();
+    lapack::GLM< scalar_t > glm( n, m, p );
+    int64_t info = glm.factor_A( &A[0], lda );
+    if (info == 0)
+        info = glm.factor_B( &B[0], lda );
+    if (info == 0)
+        glm.solve( nrhs, &D[0], lda, &X[0], ldx, &Y[0], ldy );
+    params.time() = testsweeper::get_wtime() - time;
+    if (info != 0) {
+        fprintf( stderr, "lapack::GLM returned error %lld\n", (long long) info );
+    }
+    if (verbose >= 2) {
+        printf( "X = " ); print_matrix( m, nrhs, &X[0], ldx );
+        printf( "Y = " ); print_matrix( p, nrhs, &Y[0], ldy );
+    }
+
+    if (params.ref() == 'y' || params.check() == 'y') {
+        // ---------- run reference, ggglm for each d
+        std::vector< scalar_t > Aref( lda*m ), Bref( lda*p ), d( lda );
+        time = testsweeper::get_wtime();
+        for (int64_t j = 0; j < nrhs; ++j) {
+            Aref = A;
+            Bref = B;
+            std::copy( &D[ j*lda ], &D[ j*lda ] + lda, d.begin() );
+            lapack::ggglm( n, m, p, &Aref[0], lda, &Bref[0], lda, &d[0],
+                           &X_ref[ j*ldx ], &Y_ref[ j*ldy ] );
+        }
+        params.ref_time() = testsweeper::get_wtime() - time;
+    }
+
+    if (params.check() == 'y') {
+        // ---------- check error
+        // || D - A X - B Y ||_1 / (n (||A||_1 ||X||_1 + ||B||_1 ||Y||_1)),
+        // and || X - X_ref ||_2 / || X_ref ||_2 + || Y - Y_ref ||_2 / || Y_ref ||_2.
+        real_t Anorm = lapack::lange( lapack::Norm::One, n, m, &A[0], lda );
+        real_t Bnorm = lapack::lange( lapack::Norm::One, n, p, &B[0], lda );
+        real_t Xnorm = lapack::lange( lapack::Norm::One, m, nrhs, &X[0], ldx );
+        real_t Ynorm = lapack::lange( lapack::Norm::One, p, nrhs, &Y[0], ldy );
+        std::vector< scalar_t > R = D;
+        blas::gemm( blas::Layout::ColMajor, blas::Op::NoTrans, blas::Op::NoTrans,
+                    n, nrhs, m, -1.0, &A[0], lda, &X[0], ldx, 1.0, &R[0], lda );
+        blas::gemm( blas::Layout::ColMajor, blas::Op::NoTrans, blas::Op::NoTrans,
+                    n, nrhs, p, -1.0, &B[0], lda, &Y[0], ldy, 1.0, &R[0], lda );
+        real_t error = lapack::lange( lapack::Norm::One, n, nrhs, &R[0], lda );
+        real_t denom = n * (Anorm * Xnorm + Bnorm * Ynorm);
+        if (denom > 0)
+            error /= denom;
+
+        real_t error2 = (info != 0 ? 1 : 0);
+        if (m > 0 && nrhs > 0)
+            error2 += rel_error( X, X_ref );
+        if (p > 0 && nrhs > 0)
+            error2 += rel_error( Y, Y_ref );
+        params.error() = error;
+        params.error2() = error2;
+        params.okay() = (error < tol && error2 < tol);
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Dispatches on datatype to the given instantiations of a test_factor_*_work.
+typedef void (*factor_work_t)( Params& params, bool run );
+
+static void test_factor(
+    Params& params, bool run,
+    factor_work_t work_s, factor_work_t work_d,
+    factor_work_t work_c, factor_work_t work_z )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Integer:
+            throw std::exception();
+            break;
+
+        case testsweeper::DataType::Single:
+            work_s( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            work_d( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            work_c( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            work_z( params, run );
+            break;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_factor_lu( Params& params, bool run )
+{
+    test_factor( params, run,
+                 test_factor_lu_work< float >,
+                 test_factor_lu_work< double >,
+                 test_factor_lu_work< std::complex<float> >,
+                 test_factor_lu_work< std::complex<double> > );
+}
+
+void test_factor_cholesky( Params& params, bool run )
+{
+    test_factor( params, run,
+                 test_factor_cholesky_work< float >,
+                 test_factor_cholesky_work< double >,
+                 test_factor_cholesky_work< std::complex<float> >,
+                 test_factor_cholesky_work< std::complex<double> > );
+}
+
+void test_factor_ldlt( Params& params, bool run )
+{
+    test_factor( params, run,
+                 test_factor_ldlt_work< float >,
+                 test_factor_ldlt_work< double >,
+                 test_factor_ldlt_work< std::complex<float> >,
+                 test_factor_ldlt_work< std::complex<double> > );
+}
+
+void test_factor_qr( Params& params, bool run )
+{
+    test_factor( params, run,
+                 test_factor_qr_work< float >,
+                 test_factor_qr_work< double >,
+                 test_factor_qr_work< std::complex<float> >,
+                 test_factor_qr_work< std::complex<double> > );
+}
+
+void test_streaming_ls( Params& params, bool run )
+{
+    test_factor( params, run,
+                 test_streaming_ls_work< float >,
+                 test_streaming_ls_work< double >,
+                 test_streaming_ls_work< std::complex<float> >,
+                 test_streaming_ls_work< std::complex<double> > );
+}
+
+void test_shifted_hessenberg( Params& params, bool run )
+{
+    test_factor( params, run,
+                 test_shifted_hessenberg_work< float >,
+                 test_shifted_hessenberg_work< double >,
+                 test_shifted_hessenberg_work< std::complex<float> >,
+                 test_shifted_hessenberg_work< std::complex<double> > );
+}
+
+void test_shifted_hermitian( Params& params, bool run )
+{
+    test_factor( params, run,
+                 test_shifted_hermitian_work< float >,
+                 test_shifted_hermitian_work< double >,
+                 test_shifted_hermitian_work< std::complex<float> >,
+                 test_shifted_hermitian_work< std::complex<double> > );
+}
+
+void test_generalized_eigen( Params& params, bool run )
+{
+    test_factor( params, run,
+                 test_generalized_eigen_work< float >,
+                 test_generalized_eigen_work< double >,
+                 test_generalized_eigen_work< std::complex<float> >,
+                 test_generalized_eigen_work< std::complex<double> > );
+}
+
+void test_lse( Params& params, bool run )
+{
+    test_factor( params, run,
+                 test_lse_work< float >,
+                 test_lse_work< double >,
+                 test_lse_work< std::complex<float> >,
+                 test_lse_work< std::complex<double> > );
+}
+
+void test_glm( Params& params, bool run )
+{
+    test_factor( params, run,
+                 test_glm_work< float >,
+                 test_glm_work< double >,
+                 test_glm_work< std::complex<float> >,
+                 test_glm_work< std::complex<double> > );
+}
@@ -28,8 +28,9 @@ void test_gbtrf_work( Params& params, bool run )
 
     // mark non-standard output values
     params.ref_time();
-    //params.ref_gflops();
-    //params.gflops();
+    params.ref_gflops();
+    params.gflops();
+    params.gbytes();
 
     if (! run)
         return;
@@ -59,8 +60,10 @@ void test_gbtrf_work( Params& params, bool run )
     }
 
     params.time() = time;
-    //double gflop = lapack::Gflop< scalar_t >::gbtrf( m, n, kl, ku );
-    //params.gflops() = gflop / time;
+    double gflop = lapack::Gflop< scalar_t >::gbtrf( m, n, kl, ku );
+    params.gflops() = gflop / time;
+    double gbyte = lapack::Gbyte< scalar_t >::gbtrf( m, n, kl, ku );
+    params.gbytes() = gbyte / time;
 
     if (params.ref() == 'y' || params.check() == 'y') {
         // ---------- run reference
@@ -73,7 +76,7 @@ void test_gbtrf_work( Params& params, bool run )
         }
 
         params.ref_time() = time;
-        //params.ref_gflops() = gflop / time;
+        params.ref_gflops() = gflop / time;
 
         // ---------- check error compared to reference
         real_t error = 0;
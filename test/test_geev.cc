@@ -41,6 +41,8 @@ void test_geev_work( Params& params, bool run )
     real_t tol = params.tol() * eps;
 
     // mark non-standard output values
+    params.workspace_mib();
+    params.rss_mib();
     params.error2();
     params.error3();
     params.error4();
@@ -92,11 +94,13 @@ void test_geev_work( Params& params, bool run )
 
     // ---------- run test
     testsweeper::flush_cache( params.cache() );
+    MemoryMeter memory;
     double time = testsweeper::get_wtime();
     //printf (" test start\n");
     int64_t info_tst = lapack::geev( jobvl, jobvr, n, &A_tst[0], lda, &W_tst[0], &VL_tst[0], ldvl, &VR_tst[0], ldvr );
     //printf (" test done\n");
     time = testsweeper::get_wtime() - time;
+    memory.stop( params );
     if (info_tst != 0) {
         fprintf( stderr, "lapack::geev returned error %lld\n", (lld) info_tst );
     }
@@ -116,7 +120,7 @@ void test_geev_work( Params& params, bool run )
     }
 
     bool okay = true;
-    if (params.check() == 'y') {
+    if (params.check() != 'n') {
         // ---------- check numerical error
         // formula from get22; differs from LAWN 41, usess ||V||_1 instead of n
         // 1. || A^H Vl - Vl W^H ||_1 / (||V||_1 ||A||_1)
@@ -129,14 +133,16 @@ void test_geev_work( Params& params, bool run )
                               real_t( testsweeper::no_data_flag ) };
         if (jobvl == lapack::Job::Vec) {
             check_geev( blas::Op::ConjTrans, n, &A_ref[0], lda, &W_tst[0],
-                        &VL_tst[0], ldvl, verbose, &results[0] );
+                        &VL_tst[0], ldvl, verbose, &results[0],
+                        params.check() == 'f' );
             okay = (okay && results[0] < tol && results[1] < tol);
             params.error () = results[0];
             params.error2() = results[1];
         }
         if (jobvr == lapack::Job::Vec) {
             check_geev( blas::Op::NoTrans, n, &A_ref[0], lda, &W_tst[0],
-                        &VR_tst[0], ldvr, verbose, &results[2] );
+                        &VR_tst[0], ldvr, verbose, &results[2],
+                        params.check() == 'f' );
             okay = (okay && results[2] < tol && results[3] < tol);
             params.error3() = results[2];
             params.error4() = results[3];
@@ -32,6 +32,8 @@ void test_gels_work( Params& params, bool run )
     real_t tol = params.tol() * eps;
 
     // mark non-standard output values
+    params.workspace_mib();
+    params.rss_mib();
     params.ref_time();
     // params.ref_gflops();
     params.error2();
@@ -60,9 +62,11 @@ void test_gels_work( Params& params, bool run )
 
     // ---------- run test
     testsweeper::flush_cache( params.cache() );
+    MemoryMeter memory;
     double time = testsweeper::get_wtime();
     int64_t info_tst = lapack::gels( trans, m, n, nrhs, &A_tst[0], lda, &B_tst[0], ldb );
     time = testsweeper::get_wtime() - time;
+    memory.stop( params );
     if (info_tst != 0) {
         fprintf( stderr, "lapack::gels returned error %lld\n", (lld) info_tst );
     }
@@ -71,14 +75,14 @@ void test_gels_work( Params& params, bool run )
     // double gflop = lapack::Gflop< scalar_t >::gels( trans, m, n, nrhs );
     // params.gflops() = gflop / time;
 
-    if (params.check() == 'y') {
+    if (params.check() != 'n') {
         // ---------- check error
         real_t error[2];
         check_gels( false, trans, m, n, nrhs,
                     &A_ref[0], lda, // original A
                     &B_tst[0], ldb, // X
                     &B_ref[0], ldb, // original B
-                    error );
+                    error, params.check() == 'f' );
         params.error()  = error[0];
         params.error2() = error[1];
         params.okay() = (error[0] < tol) && (error[1] < tol);
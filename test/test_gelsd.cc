@@ -31,6 +31,8 @@ void test_gelsd_work( Params& params, bool run )
     real_t tol = params.tol() * eps;
 
     // mark non-standard output values
+    params.workspace_mib();
+    params.rss_mib();
     params.ref_time();
     // params.ref_gflops();
     // params.gflops();
@@ -66,9 +68,11 @@ void test_gelsd_work( Params& params, bool run )
 
     // ---------- run test
     testsweeper::flush_cache( params.cache() );
+    MemoryMeter memory;
     double time = testsweeper::get_wtime();
     int64_t info_tst = lapack::gelsd( m, n, nrhs, &A_tst[0], lda, &B_tst[0], ldb, &S_tst[0], rcond, &rank_tst );
     time = testsweeper::get_wtime() - time;
+    memory.stop( params );
     if (info_tst != 0) {
         fprintf( stderr, "lapack::gelsd returned error %lld\n", (lld) info_tst );
     }
@@ -77,14 +81,14 @@ void test_gelsd_work( Params& params, bool run )
     // double gflop = lapack::Gflop< scalar_t >::gelsd( m, n, nrhs );
     // params.gflops() = gflop / time;
 
-    if (params.check() == 'y') {
+    if (params.check() != 'n') {
         // ---------- check error
         real_t error[2];
         check_gels( false, blas::Op::NoTrans, m, n, nrhs,
                     &A_ref[0], lda, // original A
                     &B_tst[0], ldb, // X
                     &B_ref[0], ldb, // original B
-                    error );
+                    error, params.check() == 'f' );
         params.error()  = error[0];
         params.error2() = error[1];
         params.okay() = (error[0] < tol) && (error[1] < tol);
@@ -32,6 +32,7 @@ void test_geqrf_work( Params& params, bool run )
     //params.ref_time();
     //params.ref_gflops();
     params.gflops();
+    params.gbytes();
     params.ortho();
 
     if (! run)
@@ -63,6 +64,8 @@ void test_geqrf_work( Params& params, bool run )
     params.time() = time;
     double gflop = lapack::Gflop< scalar_t >::geqrf( m, n );
     params.gflops() = gflop / time;
+    double gbyte = lapack::Gbyte< scalar_t >::geqrf( m, n );
+    params.gbytes() = gbyte / time;
 
     if (params.check() == 'y') {
         // ---------- check error
@@ -31,6 +31,8 @@ void test_gesdd_work( Params& params, bool run )
     real_t tol = params.tol() * eps;
 
     // mark non-standard output values
+    params.workspace_mib();
+    params.rss_mib();
     params.ref_time();
     //params.ref_gflops();
     //params.gflops();
@@ -65,9 +67,11 @@ void test_gesdd_work( Params& params, bool run )
 
     // ---------- run test
     testsweeper::flush_cache( params.cache() );
+    MemoryMeter memory;
     double time = testsweeper::get_wtime();
     int64_t info_tst = lapack::gesdd( jobu, m, n, &A_tst[0], lda, &S_tst[0], &U_tst[0], ldu, &VT_tst[0], ldvt );
     time = testsweeper::get_wtime() - time;
+    memory.stop( params );
     if (info_tst != 0) {
         fprintf( stderr, "lapack::gesdd returned error %lld\n", (lld) info_tst );
     }
@@ -86,7 +90,7 @@ void test_gesdd_work( Params& params, bool run )
                          (real_t) testsweeper::no_data_flag,
                          (real_t) testsweeper::no_data_flag,
                          (real_t) testsweeper::no_data_flag };
-    if (params.check() == 'y') {
+    if (params.check() != 'n') {
         // U2 or VT2 points to A if overwriting
         scalar_t* U2    = &U_tst[0];
         int64_t   ldu2  = ldu;
@@ -103,7 +107,8 @@ void test_gesdd_work( Params& params, bool run )
             }
         }
         check_svd( jobu, jobu, m, n, &A_ref[0], lda,
-                   &S_tst[0], U2, ldu2, VT2, ldvt2, errors );
+                   &S_tst[0], U2, ldu2, VT2, ldvt2, errors,
+                   params.check() == 'f' );
     }
 
     if (params.ref() == 'y') {
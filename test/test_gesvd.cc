@@ -33,6 +33,8 @@ void test_gesvd_work( Params& params, bool run )
     real_t tol = params.tol() * eps;
 
     // mark non-standard output values
+    params.workspace_mib();
+    params.rss_mib();
     params.ref_time();
     //params.ref_gflops();
     //params.gflops();
@@ -84,9 +86,11 @@ void test_gesvd_work( Params& params, bool run )
 
     // ---------- run test
     testsweeper::flush_cache( params.cache() );
+    MemoryMeter memory;
     double time = testsweeper::get_wtime();
     int64_t info_tst = lapack::gesvd( jobu, jobvt, m, n, &A_tst[0], lda, &S_tst[0], &U_tst[0], ldu, &VT_tst[0], ldvt );
     time = testsweeper::get_wtime() - time;
+    memory.stop( params );
     if (info_tst != 0) {
         fprintf( stderr, "lapack::gesvd returned error %lld\n", (lld) info_tst );
     }
@@ -112,7 +116,7 @@ void test_gesvd_work( Params& params, bool run )
                          (real_t) testsweeper::no_data_flag,
                          (real_t) testsweeper::no_data_flag,
                          (real_t) testsweeper::no_data_flag };
-    if (params.check() == 'y') {
+    if (params.check() != 'n') {
         // U2 or VT2 points to A if overwriting
         scalar_t* U2    = &U_tst[0];
         int64_t   ldu2  = ldu;
@@ -127,7 +131,8 @@ void test_gesvd_work( Params& params, bool run )
             ldvt2 = lda;
         }
         check_svd( jobu, jobvt, m, n, &A_ref[0], lda,
-                   &S_tst[0], U2, ldu2, VT2, ldvt2, errors );
+                   &S_tst[0], U2, ldu2, VT2, ldvt2, errors,
+                   params.check() == 'f' );
 
         if (verbose >= 2) {
             printf( "U2 = "  ); print_matrix( m, u_ncol, U2, ldu2 );
@@ -10,6 +10,7 @@
 #include "error.hh"
 #include "lapacke_wrappers.hh"
 
+#include <memory>
 #include <vector>
 
 // -----------------------------------------------------------------------------
@@ -25,12 +26,14 @@ void test_getrs_work( Params& params, bool run )
     int64_t nrhs = params.nrhs();
     int64_t align = params.align();
     int64_t verbose = params.verbose();
+    int64_t concurrent = mark_concurrent( params );
     params.matrix.mark();
 
     // mark non-standard output values
     params.ref_time();
     params.ref_gflops();
     params.gflops();
+    params.gbytes();
 
     if (! run)
         return;
@@ -80,6 +83,28 @@ void test_getrs_work( Params& params, bool run )
         assert_throw( lapack::getrf(  n,  n, &A[0], n-1, &ipiv_tst[0] ), lapack::Error );
     }
 
+    if (concurrent > 0) {
+        // ---------- run throughput test; no check or reference
+        // factors A and ipiv are shared read-only; each thread has its own B
+        scalar_t const* A_ptr = &A[0];
+        int64_t const* ipiv_ptr = &ipiv_tst[0];
+        scalar_t const* B0 = &B_ref[0];
+        run_concurrent( params, [=]( int64_t thread ) {
+            auto B = std::make_shared< std::vector< scalar_t > >( size_B );
+            ConcurrentTask task;
+            task.reset = [=]() {
+                std::copy( B0, B0 + size_B, B->begin() );
+            };
+            task.call = [=]() {
+                lapack::getrs( trans, n, nrhs, A_ptr, lda, ipiv_ptr, B->data(), ldb );
+            };
+            return task;
+        } );
+        double gflop = lapack::Gflop< scalar_t >::getrs( n, nrhs );
+        params.gflops() = gflop * params.throughput();
+        return;
+    }
+
     // ---------- run test
     testsweeper::flush_cache( params.cache() );
     double time = testsweeper::get_wtime();
@@ -92,6 +117,8 @@ void test_getrs_work( Params& params, bool run )
     params.time() = time;
     double gflop = lapack::Gflop< scalar_t >::getrs( n, nrhs );
     params.gflops() = gflop / time;
+    double gbyte = lapack::Gbyte< scalar_t >::getrs( n, nrhs );
+    params.gbytes() = gbyte / time;
 
     if (verbose >= 2) {
         printf( "B2 = " ); print_matrix( n, nrhs, &B_tst[0], ldb );
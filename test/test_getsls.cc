@@ -74,14 +74,14 @@ void test_getsls_work( Params& params, bool run )
     // double gflop = lapack::Gflop< scalar_t >::getsls( trans, m, n, nrhs );
     // params.gflops() = gflop / time;
 
-    if (params.check() == 'y') {
+    if (params.check() != 'n') {
         // ---------- check error
         real_t error[2];
         check_gels( false, trans, m, n, nrhs,
                     &A_ref[0], lda, // original A
                     &B_tst[0], ldb, // X
                     &B_ref[0], ldb, // original B
-                    error );
+                    error, params.check() == 'f' );
         params.error()  = error[0];
         params.error2() = error[1];
         params.okay() = (error[0] < tol) && (error[1] < tol);
@@ -11,6 +11,7 @@
 #include "lapacke_wrappers.hh"
 #include "scale.hh"
 
+#include <memory>
 #include <vector>
 
 // -----------------------------------------------------------------------------
@@ -30,10 +31,13 @@ void test_heev_work( Params& params, bool run )
     int64_t n = params.dim.n();
     int64_t align = params.align();
     int64_t verbose = params.verbose();
+    int64_t concurrent = mark_concurrent( params );
     real_t tol = params.tol() * eps;
     params.matrix.mark();
 
     // mark non-standard output values
+    params.workspace_mib();
+    params.rss_mib();
     params.ref_time();
     // params.ref_gflops();
     // params.gflops();
@@ -64,12 +68,32 @@ void test_heev_work( Params& params, bool run )
         printf( "A = " ); print_matrix( n, n, &A[0], lda );
     }
 
+    if (concurrent > 0) {
+        // ---------- run throughput test; no check or reference
+        scalar_t const* A0 = &A[0];
+        run_concurrent( params, [=]( int64_t thread ) {
+            auto Z      = std::make_shared< std::vector< scalar_t > >( size_Z );
+            auto Lambda = std::make_shared< std::vector< real_t > >( n );
+            ConcurrentTask task;
+            task.reset = [=]() {
+                std::copy( A0, A0 + size_A, Z->begin() );
+            };
+            task.call = [=]() {
+                lapack::heev( jobz, uplo, n, Z->data(), ldz, Lambda->data() );
+            };
+            return task;
+        } );
+        return;
+    }
+
     // ---------- run test
     testsweeper::flush_cache( params.cache() );
+    MemoryMeter memory;
     double time = testsweeper::get_wtime();
     int64_t info_tst = lapack::heev(
         jobz, uplo, n, &Z[0], lda, &Lambda_tst[0] );
     time = testsweeper::get_wtime() - time;
+    memory.stop( params );
     if (info_tst != 0) {
         fprintf( stderr, "lapack::heev returned error %lld\n", (lld) info_tst );
     }
@@ -33,6 +33,8 @@ void test_heevd_work( Params& params, bool run )
     params.matrix.mark();
 
     // mark non-standard output values
+    params.workspace_mib();
+    params.rss_mib();
     params.ref_time();
     // params.ref_gflops();
     // params.gflops();
@@ -65,10 +67,12 @@ void test_heevd_work( Params& params, bool run )
 
     // ---------- run test
     testsweeper::flush_cache( params.cache() );
+    MemoryMeter memory;
     double time = testsweeper::get_wtime();
     int64_t info_tst = lapack::heevd(
         jobz, uplo, n, &Z[0], lda, &Lambda_tst[0] );
     time = testsweeper::get_wtime() - time;
+    memory.stop( params );
     if (info_tst != 0) {
         fprintf( stderr, "lapack::heevd returned error %lld\n", (lld) info_tst );
     }
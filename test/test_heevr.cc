@@ -40,6 +40,8 @@ void test_heevr_work( Params& params, bool run )
     params.get_range( n, &range, &vl, &vu, &il, &iu );
 
     // mark non-standard output values
+    params.workspace_mib();
+    params.rss_mib();
     params.ref_time();
     // params.ref_gflops();
     // params.gflops();
@@ -88,12 +90,14 @@ void test_heevr_work( Params& params, bool run )
 
     // ---------- run test
     testsweeper::flush_cache( params.cache() );
+    MemoryMeter memory;
     double time = testsweeper::get_wtime();
     int64_t info_tst = lapack::heevr(
                            jobz, range, uplo, n, &A_tst[0], lda,
                            vl, vu, il, iu, abstol, &nfound,
                            &Lambda_tst[0], &Z[0], ldz, &isuppz_tst[0] );
     time = testsweeper::get_wtime() - time;
+    memory.stop( params );
     if (info_tst != 0) {
         fprintf( stderr, "lapack::heevr returned error %lld\n", (lld) info_tst );
     }
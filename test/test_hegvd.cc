@@ -37,6 +37,8 @@ void test_hegvd_work( Params& params, bool run )
     params.matrixB.mark();
 
     // mark non-standard output values
+    params.workspace_mib();
+    params.rss_mib();
     params.ref_time();
     // params.ref_gflops();
     // params.gflops();
@@ -81,6 +83,7 @@ void test_hegvd_work( Params& params, bool run )
 
     // ---------- run test
     testsweeper::flush_cache( params.cache() );
+    MemoryMeter memory;
     double time = testsweeper::get_wtime();
     int64_t info_tst = lapack::hegvd(
                            itype, jobz, uplo, n,
@@ -88,6 +91,7 @@ void test_hegvd_work( Params& params, bool run )
                            &B_tst[0], ldb,
                            &Lambda_tst[0] );
     time = testsweeper::get_wtime() - time;
+    memory.stop( params );
     if (info_tst != 0) {
         fprintf( stderr, "lapack::hegvd returned error %lld\n", (lld) info_tst );
     }
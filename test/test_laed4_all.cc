@@ -0,0 +1,152 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+// Tests laed4_all against n calls of laed4, one per root.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "lapack/update.hh"
+#include "print_matrix.hh"
+
+#include <algorithm>
+#include <vector>
+
+// -----------------------------------------------------------------------------
+template< typename scalar_t >
+void test_laed4_all_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+    typedef long long lld;
+
+    // get & mark input values
+    int64_t n = params.dim.n();
+    scalar_t rho = std::abs( params.alpha() );
+    int64_t verbose = params.verbose();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.ref_time();
+    params.error2();
+
+    if (! run)
+        return;
+
+    // ---------- setup
+    int64_t lddelta = blas::max( 1, n );
+    std::vector< scalar_t > d( n );
+    std::vector< scalar_t > z( n );
+    std::vector< scalar_t > lambda_tst( n );
+    std::vector< scalar_t > lambda_ref( n );
+    std::vector< scalar_t > delta_tst( lddelta*n );
+    std::vector< scalar_t > delta_ref( lddelta*n );
+
+    int64_t idist = 1;
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+    lapack::larnv( idist, iseed, d.size(), &d[0] );
+    lapack::larnv( idist, iseed, z.size(), &z[0] );
+
+    // sort d.
+    std::sort( d.begin(), d.end() );
+
+    // z should have unit norm, for laed4.
+    real_t z_norm = blas::nrm2( n, &z[0], 1 );
+    for (int64_t i = 0; i < n; ++i)
+        z[ i ] /= z_norm;
+
+    if (verbose >= 2) {
+        printf( "d = " ); print_vector( n, &d[0], 1 );
+        printf( "z = " ); print_vector( n, &z[0], 1 );
+    }
+
+    // test error exits
+    if (params.error_exit() == 'y') {
+        assert_throw( lapack::laed4_all( -1, &d[0], &z[0], &delta_tst[0], lddelta, rho, &lambda_tst[0] ), lapack::Error );
+        assert_throw( lapack::laed4_all(  n, &d[0], &z[0], &delta_tst[0], n-1,     rho, &lambda_tst[0] ), lapack::Error );
+        assert_throw( lapack::laed4_all(  n, &d[0], &z[0], &delta_tst[0], lddelta, -rho, &lambda_tst[0] ), lapack::Error );
+    }
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+    int64_t info_tst = lapack::laed4_all( n, &d[0], &z[0], &delta_tst[0], lddelta,
+                                          rho, &lambda_tst[0] );
+    time = testsweeper::get_wtime() - time;
+    if (info_tst != 0) {
+        fprintf( stderr, "lapack::laed4_all returned error %lld\n", (lld) info_tst );
+    }
+    params.time() = time;
+
+    if (verbose >= 2) {
+        printf( "lambda = " ); print_vector( n, &lambda_tst[0], 1 );
+    }
+
+    if (params.ref() == 'y' || params.check() == 'y') {
+        // ---------- run reference: laed4 for each root
+        int64_t info_ref = 0;
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        for (int64_t i = 0; i < n; ++i) {
+            int64_t info = lapack::laed4( n, i, &d[0], &z[0],
+                                          &delta_ref[ i*lddelta ], rho,
+                                          &lambda_ref[ i ] );
+            if (info != 0 && info_ref == 0)
+                info_ref = i + 1;
+        }
+        params.ref_time() = testsweeper::get_wtime() - time;
+        if (info_ref != 0) {
+            fprintf( stderr, "lapack::laed4 returned error %lld\n", (lld) info_ref );
+        }
+
+        // ---------- check error compared to reference
+        // max_i |lambda_tst(i) - lambda_ref(i)| / |lambda_ref(i)|, and
+        // max_ij |delta_tst(j,i) - delta_ref(j,i)| / |delta_ref(j,i)|.
+        // For n <= 2, laed4 doesn't return d(j) - lambda(i) in delta.
+        // Both stop when f(lambda) is within its rounding error, so allow
+        // n eps relative error.
+        real_t error = (info_tst != info_ref ? 1 : 0);
+        real_t error2 = 0;
+        for (int64_t i = 0; i < n; ++i) {
+            error = blas::max( error, std::abs( lambda_tst[ i ] - lambda_ref[ i ] )
+                                      / std::abs( lambda_ref[ i ] ) );
+            for (int64_t j = 0; n > 2 && j < n; ++j) {
+                scalar_t ref = delta_ref[ j + i*lddelta ];
+                error2 = blas::max( error2, std::abs( delta_tst[ j + i*lddelta ] - ref )
+                                            / std::abs( ref ) );
+            }
+        }
+        if (n > 0) {
+            error  /= n;
+            error2 /= n;
+        }
+        params.error() = error;
+        params.error2() = error2;
+        params.okay() = (error < tol) && (error2 < tol);
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_laed4_all( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Integer:
+            throw std::exception();
+            break;
+
+        case testsweeper::DataType::Single:
+            test_laed4_all_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_laed4_all_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+        case testsweeper::DataType::DoubleComplex:
+            params.msg() = "skipping: no complex version";
+            break;
+    }
+}
@@ -31,6 +31,7 @@ void test_lanhe_work( Params& params, bool run )
     params.ref_time();
     //params.ref_gflops();
     //params.gflops();
+    params.gbytes();
 
     if (! run)
         return;
@@ -61,6 +62,8 @@ void test_lanhe_work( Params& params, bool run )
     params.time() = time;
     //double gflop = lapack::Gflop< scalar_t >::lanhe( norm, n );
     //params.gflops() = gflop / time;
+    double gbyte = lapack::Gbyte< scalar_t >::lanhe( n );
+    params.gbytes() = gbyte / time;
 
     if (verbose >= 1) {
         printf( "norm_tst = %.8e\n", norm_tst );
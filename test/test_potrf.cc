@@ -10,6 +10,7 @@
 #include "error.hh"
 #include "lapacke_wrappers.hh"
 
+#include <memory>
 #include <vector>
 
 // -----------------------------------------------------------------------------
@@ -24,6 +25,7 @@ void test_potrf_work( Params& params, bool run )
     int64_t n = params.dim.n();
     int64_t align = params.align();
     int64_t verbose = params.verbose();
+    int64_t concurrent = mark_concurrent( params );
     params.matrix.mark();
 
     real_t eps = std::numeric_limits< real_t >::epsilon();
@@ -33,6 +35,7 @@ void test_potrf_work( Params& params, bool run )
     params.ref_time();
     params.ref_gflops();
     params.gflops();
+    params.gbytes();
 
     if (! run) {
         params.matrix.kind.set_default( "rand_dominant" );
@@ -66,6 +69,25 @@ void test_potrf_work( Params& params, bool run )
         assert_throw( lapack::potrf( uplo,     n, &A_tst[0], n-1 ), lapack::Error );
     }
 
+    if (concurrent > 0) {
+        // ---------- run throughput test; no check or reference
+        scalar_t const* A0 = &A_ref[0];
+        run_concurrent( params, [=]( int64_t thread ) {
+            auto A = std::make_shared< std::vector< scalar_t > >( size_A );
+            ConcurrentTask task;
+            task.reset = [=]() {
+                std::copy( A0, A0 + size_A, A->begin() );
+            };
+            task.call = [=]() {
+                lapack::potrf( uplo, n, A->data(), lda );
+            };
+            return task;
+        } );
+        double gflop = lapack::Gflop< scalar_t >::potrf( n );
+        params.gflops() = gflop * params.throughput();
+        return;
+    }
+
     // ---------- run test
     testsweeper::flush_cache( params.cache() );
     double time = testsweeper::get_wtime();
@@ -78,6 +100,8 @@ void test_potrf_work( Params& params, bool run )
     params.time() = time;
     double gflop = lapack::Gflop< scalar_t >::potrf( n );
     params.gflops() = gflop / time;
+    double gbyte = lapack::Gbyte< scalar_t >::potrf( n );
+    params.gbytes() = gbyte / time;
 
     if (verbose >= 2) {
         printf( "A_factor = " ); print_matrix( n, n, &A_tst[0], lda );
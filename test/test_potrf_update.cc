@@ -0,0 +1,199 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+// Tests potrf_update and potrf_downdate against refactoring with potrf.
+// The rank k of the update is the dim k parameter.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "lapack/update.hh"
+#include "print_matrix.hh"
+
+#include <vector>
+
+// -----------------------------------------------------------------------------
+template< typename scalar_t >
+void test_potrf_update_work( Params& params, bool run, bool downdate )
+{
+    using real_t = blas::real_type< scalar_t >;
+    typedef long long lld;
+
+    // get & mark input values
+    lapack::Uplo uplo = params.uplo();
+    int64_t n = params.dim.n();
+    int64_t k = params.dim.k();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    params.matrix.mark();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.ref_time();
+
+    if (! run) {
+        params.matrix.kind.set_default( "rand_dominant" );
+        return;
+    }
+
+    // ---------- setup
+    // For update, factor A, then update by X to get factor of A + X X^H.
+    // For downdate, factor A + X X^H, then downdate by X to get factor of A.
+    int64_t lda = roundup( blas::max( 1, n ), align );
+    int64_t ldx = roundup( blas::max( 1, n ), align );
+    size_t size_A = (size_t) lda * n;
+    size_t size_X = (size_t) ldx * k;
+
+    std::vector< scalar_t > A( size_A );
+    std::vector< scalar_t > A_tst( size_A );
+    std::vector< scalar_t > A_ref( size_A );
+    std::vector< scalar_t > X( size_X );
+    std::vector< scalar_t > X_tst( size_X );
+
+    lapack::generate_matrix( params.matrix, n, n, &A[0], lda );
+    int64_t idist = 1;
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+    lapack::larnv( idist, iseed, X.size(), &X[0] );
+
+    // A_upd = A + X X^H
+    std::vector< scalar_t > A_upd = A;
+    blas::herk( blas::Layout::ColMajor, uplo, blas::Op::NoTrans, n, k,
+                1.0, &X[0], ldx, 1.0, &A_upd[0], lda );
+
+    // input factor
+    A_tst = (downdate ? A_upd : A);
+    int64_t info = lapack::potrf( uplo, n, &A_tst[0], lda );
+    if (info != 0) {
+        fprintf( stderr, "lapack::potrf returned error %lld\n", (lld) info );
+    }
+    X_tst = X;
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A n=%5lld, lda=%5lld\n"
+                "X n=%5lld, k=%5lld, ldx=%5lld\n",
+                (lld) n, (lld) lda, (lld) n, (lld) k, (lld) ldx );
+    }
+    if (verbose >= 2) {
+        printf( "A_factor = " ); print_matrix( n, n, &A_tst[0], lda );
+        printf( "X = " ); print_matrix( n, k, &X[0], ldx );
+    }
+
+    // test error exits
+    if (params.error_exit() == 'y') {
+        using lapack::Uplo;
+        assert_throw( lapack::potrf_update( Uplo(0), n, k, &A_tst[0], lda, &X_tst[0], ldx ), lapack::Error );
+        assert_throw( lapack::potrf_update( uplo,   -1, k, &A_tst[0], lda, &X_tst[0], ldx ), lapack::Error );
+        assert_throw( lapack::potrf_update( uplo,    n,-1, &A_tst[0], lda, &X_tst[0], ldx ), lapack::Error );
+        assert_throw( lapack::potrf_update( uplo,    n, k, &A_tst[0], n-1, &X_tst[0], ldx ), lapack::Error );
+        assert_throw( lapack::potrf_update( uplo,    n, k, &A_tst[0], lda, &X_tst[0], n-1 ), lapack::Error );
+    }
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+    if (downdate)
+        info = lapack::potrf_downdate( uplo, n, k, &A_tst[0], lda, &X_tst[0], ldx );
+    else
+        info = lapack::potrf_update( uplo, n, k, &A_tst[0], lda, &X_tst[0], ldx );
+    time = testsweeper::get_wtime() - time;
+    if (info != 0) {
+        fprintf( stderr, "lapack::potrf_%s returned error %lld\n",
+                 downdate ? "downdate" : "update", (lld) info );
+    }
+    params.time() = time;
+
+    if (verbose >= 2) {
+        printf( "A_factor_new = " ); print_matrix( n, n, &A_tst[0], lda );
+    }
+
+    if (params.check() == 'y' || params.ref() == 'y') {
+        // ---------- run reference: refactor from scratch,
+        // timing forming A + X X^H as well as factoring it
+        A_ref = A;
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        if (! downdate) {
+            blas::herk( blas::Layout::ColMajor, uplo, blas::Op::NoTrans, n, k,
+                        1.0, &X[0], ldx, 1.0, &A_ref[0], lda );
+        }
+        int64_t info_ref = lapack::potrf( uplo, n, &A_ref[0], lda );
+        time = testsweeper::get_wtime() - time;
+        if (info_ref != 0) {
+            fprintf( stderr, "lapack::potrf returned error %lld\n", (lld) info_ref );
+        }
+        params.ref_time() = time;
+
+        if (verbose >= 2) {
+            printf( "A_factor_ref = " ); print_matrix( n, n, &A_ref[0], lda );
+        }
+
+        // ---------- check error
+        // || L_tst - L_ref ||_1 / || L_ref ||_1, in the uplo triangle.
+        real_t Lnorm = lapack::lantr( lapack::Norm::One, uplo, lapack::Diag::NonUnit,
+                                      n, n, &A_ref[0], lda );
+        for (size_t i = 0; i < size_A; ++i)
+            A_tst[ i ] -= A_ref[ i ];
+        real_t error = lapack::lantr( lapack::Norm::One, uplo, lapack::Diag::NonUnit,
+                                      n, n, &A_tst[0], lda );
+        if (Lnorm != 0)
+            error /= Lnorm;
+        params.error() = error;
+        params.okay() = (info == 0 && error < tol);
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_potrf_update( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Integer:
+            throw std::exception();
+            break;
+
+        case testsweeper::DataType::Single:
+            test_potrf_update_work< float >( params, run, false );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_potrf_update_work< double >( params, run, false );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_potrf_update_work< std::complex<float> >( params, run, false );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_potrf_update_work< std::complex<double> >( params, run, false );
+            break;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_potrf_downdate( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Integer:
+            throw std::exception();
+            break;
+
+        case testsweeper::DataType::Single:
+            test_potrf_update_work< float >( params, run, true );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_potrf_update_work< double >( params, run, true );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_potrf_update_work< std::complex<float> >( params, run, true );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_potrf_update_work< std::complex<double> >( params, run, true );
+            break;
+    }
+}
@@ -10,6 +10,7 @@
 #include "error.hh"
 #include "lapacke_wrappers.hh"
 
+#include <memory>
 #include <vector>
 
 // -----------------------------------------------------------------------------
@@ -25,12 +26,14 @@ void test_potrs_work( Params& params, bool run )
     int64_t nrhs = params.nrhs();
     int64_t align = params.align();
     int64_t verbose = params.verbose();
+    int64_t concurrent = mark_concurrent( params );
     params.matrix.mark();
 
     // mark non-standard output values
     params.ref_time();
     params.ref_gflops();
     params.gflops();
+    params.gbytes();
 
     if (! run) {
         params.matrix.kind.set_default( "rand_dominant" );
@@ -81,6 +84,27 @@ void test_potrs_work( Params& params, bool run )
         assert_throw( lapack::potrs( uplo,     n, nrhs, &A[0], lda, &B_tst[0], n-1 ), lapack::Error );
     }
 
+    if (concurrent > 0) {
+        // ---------- run throughput test; no check or reference
+        // factor A is shared read-only; each thread has its own B
+        scalar_t const* A_ptr = &A[0];
+        scalar_t const* B0 = &B_ref[0];
+        run_concurrent( params, [=]( int64_t thread ) {
+            auto B = std::make_shared< std::vector< scalar_t > >( size_B );
+            ConcurrentTask task;
+            task.reset = [=]() {
+                std::copy( B0, B0 + size_B, B->begin() );
+            };
+            task.call = [=]() {
+                lapack::potrs( uplo, n, nrhs, A_ptr, lda, B->data(), ldb );
+            };
+            return task;
+        } );
+        double gflop = lapack::Gflop< scalar_t >::potrs( n, nrhs );
+        params.gflops() = gflop * params.throughput();
+        return;
+    }
+
     // ---------- run test
     testsweeper::flush_cache( params.cache() );
     double time = testsweeper::get_wtime();
@@ -93,6 +117,8 @@ void test_potrs_work( Params& params, bool run )
     params.time() = time;
     double gflop = lapack::Gflop< scalar_t >::potrs( n, nrhs );
     params.gflops() = gflop / time;
+    double gbyte = lapack::Gbyte< scalar_t >::potrs( n, nrhs );
+    params.gbytes() = gbyte / time;
 
     if (verbose >= 2) {
         printf( "B2 = " ); print_matrix( n, nrhs, &B_tst[0], ldb );
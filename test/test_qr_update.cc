@@ -0,0 +1,245 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+// Tests qr_update, qr_insert_col, qr_delete_col, qr_insert_row, and
+// qr_delete_row, starting from geqrf and ungqr of an m-by-n A.
+// Columns and rows are inserted or deleted in the middle of A.
+// ref_time refactors the updated A with geqrf and ungqr.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "lapack/update.hh"
+#include "print_matrix.hh"
+
+#include <vector>
+
+enum class QRUpdate { Rank1, InsertCol, DeleteCol, InsertRow, DeleteRow };
+
+// -----------------------------------------------------------------------------
+// Computes full m-by-m Q and m-by-n R of A, as from geqrf and ungqr.
+template< typename scalar_t >
+void qr_full(
+    int64_t m, int64_t n, scalar_t const* A, int64_t lda,
+    scalar_t* Q, int64_t ldq, scalar_t* R, int64_t ldr )
+{
+    int64_t minmn = blas::min( m, n );
+    std::vector< scalar_t > F( A, A + lda*n );
+    std::vector< scalar_t > tau( blas::max( 1, minmn ) );
+    lapack::geqrf( m, n, &F[0], lda, &tau[0] );
+    lapack::laset( lapack::MatrixType::General, m, n, 0.0, 0.0, R, ldr );
+    lapack::lacpy( lapack::MatrixType::Upper, m, n, &F[0], lda, R, ldr );
+    lapack::laset( lapack::MatrixType::General, m, m, 0.0, 0.0, Q, ldq );
+    lapack::lacpy( lapack::MatrixType::Lower, m, minmn, &F[0], lda, Q, ldq );
+    lapack::ungqr( m, m, minmn, Q, ldq, &tau[0] );
+}
+
+// -----------------------------------------------------------------------------
+template< typename scalar_t >
+void test_qr_update_work( Params& params, bool run, QRUpdate op )
+{
+    using real_t = blas::real_type< scalar_t >;
+    typedef long long lld;
+
+    // get & mark input values
+    int64_t m = params.dim.m();
+    int64_t n = params.dim.n();
+    int64_t verbose = params.verbose();
+    params.matrix.mark();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.ref_time();
+    params.ortho();
+
+    if (! run)
+        return;
+
+    if ((op == QRUpdate::DeleteCol && n < 1)
+        || (op == QRUpdate::DeleteRow && m < 1)) {
+        params.msg() = "skipping: nothing to delete";
+        return;
+    }
+
+    // ---------- setup
+    // Arrays have room for an inserted row or column.
+    int64_t ld = m + 1;
+    std::vector< scalar_t > A( ld*(n + 1) );
+    std::vector< scalar_t > Q( ld*(m + 1) );
+    std::vector< scalar_t > R( ld*(n + 1) );
+    std::vector< scalar_t > u( m + 1 ), v( n + 1 );
+
+    lapack::generate_matrix( params.matrix, m, n, &A[0], ld );
+    int64_t idist = 1;
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+    lapack::larnv( idist, iseed, u.size(), &u[0] );
+    lapack::larnv( idist, iseed, v.size(), &v[0] );
+
+    qr_full( m, n, &A[0], ld, &Q[0], ld, &R[0], ld );
+
+    // updated A, of size m2-by-n2
+    int64_t m2 = m, n2 = n;
+    int64_t j = n/2 + 1;  // 1-based column to insert or delete
+    int64_t i = m/2 + 1;  // 1-based row to insert or delete
+    switch (op) {
+        case QRUpdate::Rank1:
+            // A += u v^H
+            blas::ger( blas::Layout::ColMajor, m, n, 1.0, &u[0], 1, &v[0], 1,
+                       &A[0], ld );
+            break;
+        case QRUpdate::InsertCol:
+            n2 = n + 1;
+            for (int64_t c = n; c >= j; --c)
+                blas::copy( m, &A[ (c-1)*ld ], 1, &A[ c*ld ], 1 );
+            blas::copy( m, &u[0], 1, &A[ (j-1)*ld ], 1 );
+            break;
+        case QRUpdate::DeleteCol:
+            n2 = n - 1;
+            for (int64_t c = j - 1; c < n - 1; ++c)
+                blas::copy( m, &A[ (c+1)*ld ], 1, &A[ c*ld ], 1 );
+            break;
+        case QRUpdate::InsertRow:
+            m2 = m + 1;
+            for (int64_t r = m; r >= i; --r)
+                blas::copy( n, &A[ r-1 ], ld, &A[ r ], ld );
+            blas::copy( n, &v[0], 1, &A[ i-1 ], ld );
+            break;
+        case QRUpdate::DeleteRow:
+            m2 = m - 1;
+            for (int64_t r = i - 1; r < m - 1; ++r)
+                blas::copy( n, &A[ r+1 ], ld, &A[ r ], ld );
+            break;
+    }
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A m=%5lld, n=%5lld, ld=%5lld; updated A m=%5lld, n=%5lld\n",
+                (lld) m, (lld) n, (lld) ld, (lld) m2, (lld) n2 );
+    }
+    if (verbose >= 2) {
+        printf( "A_new = " ); print_matrix( m2, n2, &A[0], ld );
+    }
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+    switch (op) {
+        case QRUpdate::Rank1:
+            lapack::qr_update( m, n, &Q[0], ld, &R[0], ld, &u[0], &v[0] );
+            break;
+        case QRUpdate::InsertCol:
+            lapack::qr_insert_col( m, n, &Q[0], ld, &R[0], ld, j, &u[0] );
+            break;
+        case QRUpdate::DeleteCol:
+            lapack::qr_delete_col( m, n, &Q[0], ld, &R[0], ld, j );
+            break;
+        case QRUpdate::InsertRow:
+            lapack::qr_insert_row( m, n, &Q[0], ld, &R[0], ld, i, &v[0] );
+            break;
+        case QRUpdate::DeleteRow:
+            lapack::qr_delete_row( m, n, &Q[0], ld, &R[0], ld, i );
+            break;
+    }
+    params.time() = testsweeper::get_wtime() - time;
+
+    if (verbose >= 2) {
+        printf( "Q = " ); print_matrix( m2, m2, &Q[0], ld );
+        printf( "R = " ); print_matrix( m2, n2, &R[0], ld );
+    }
+
+    if (params.check() == 'y') {
+        // ---------- check error
+        // || A - Q R ||_1 / (max( m, n ) ||A||_1)
+        int64_t ldw = blas::max( 1, m2 );
+        std::vector< scalar_t > W( ldw*blas::max( 1, blas::max( m2, n2 ) ) );
+        lapack::laset( lapack::MatrixType::General, m2, n2, 0.0, 0.0, &W[0], ldw );
+        lapack::lacpy( lapack::MatrixType::Upper, m2, n2, &R[0], ld, &W[0], ldw );
+        std::vector< scalar_t > Res( ldw*blas::max( 1, n2 ) );
+        lapack::lacpy( lapack::MatrixType::General, m2, n2, &A[0], ld, &Res[0], ldw );
+        blas::gemm( blas::Layout::ColMajor, blas::Op::NoTrans, blas::Op::NoTrans,
+                    m2, n2, m2,
+                    -1.0, &Q[0], ld, &W[0], ldw, 1.0, &Res[0], ldw );
+        real_t Anorm = lapack::lange( lapack::Norm::One, m2, n2, &A[0], ld );
+        real_t error = lapack::lange( lapack::Norm::One, m2, n2, &Res[0], ldw );
+        if (Anorm > 0)
+            error /= (blas::max( m2, n2 ) * Anorm);
+
+        // || I - Q^H Q ||_1 / m
+        lapack::laset( lapack::MatrixType::Upper, m2, m2, 0.0, 1.0, &W[0], ldw );
+        blas::herk( blas::Layout::ColMajor, blas::Uplo::Upper, blas::Op::ConjTrans,
+                    m2, m2, -1.0, &Q[0], ld, 1.0, &W[0], ldw );
+        real_t ortho = lapack::lanhe( lapack::Norm::One, lapack::Uplo::Upper,
+                                      m2, &W[0], ldw );
+        if (m2 > 0)
+            ortho /= m2;
+
+        params.error() = error;
+        params.ortho() = ortho;
+        params.okay() = (error < tol) && (ortho < tol);
+    }
+
+    if (params.ref() == 'y') {
+        // ---------- run reference: refactor from scratch
+        std::vector< scalar_t > Q_ref( ld*(m + 1) );
+        std::vector< scalar_t > R_ref( ld*(n + 1) );
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        qr_full( m2, n2, &A[0], ld, &Q_ref[0], ld, &R_ref[0], ld );
+        params.ref_time() = testsweeper::get_wtime() - time;
+    }
+}
+
+// -----------------------------------------------------------------------------
+static void test_qr_update_dispatch( Params& params, bool run, QRUpdate op )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Integer:
+            throw std::exception();
+            break;
+
+        case testsweeper::DataType::Single:
+            test_qr_update_work< float >( params, run, op );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_qr_update_work< double >( params, run, op );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_qr_update_work< std::complex<float> >( params, run, op );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_qr_update_work< std::complex<double> >( params, run, op );
+            break;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_qr_update( Params& params, bool run )
+{
+    test_qr_update_dispatch( params, run, QRUpdate::Rank1 );
+}
+
+void test_qr_insert_col( Params& params, bool run )
+{
+    test_qr_update_dispatch( params, run, QRUpdate::InsertCol );
+}
+
+void test_qr_delete_col( Params& params, bool run )
+{
+    test_qr_update_dispatch( params, run, QRUpdate::DeleteCol );
+}
+
+void test_qr_insert_row( Params& params, bool run )
+{
+    test_qr_update_dispatch( params, run, QRUpdate::InsertRow );
+}
+
+void test_qr_delete_row( Params& params, bool run )
+{
+    test_qr_update_dispatch( params, run, QRUpdate::DeleteRow );
+}
@@ -0,0 +1,175 @@
+// Copyright (c) 2017-2022, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+// Tests syev_update, starting from syev of A, against syev of A + rho z z^T.
+// rho is the alpha parameter, of either sign.
+// ref_time recomputes the eigendecomposition of the updated A with syevd.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "lapack/update.hh"
+#include "print_matrix.hh"
+#include "error.hh"
+#include "scale.hh"
+
+#include <vector>
+
+// -----------------------------------------------------------------------------
+template< typename scalar_t >
+void test_syev_update_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+    typedef long long lld;
+
+    // get & mark input values
+    lapack::Job jobz = params.jobz();
+    int64_t n = params.dim.n();
+    scalar_t rho = params.alpha();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    params.matrix.mark();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.ref_time();
+    params.error2();
+    params.ortho();
+
+    if (! run)
+        return;
+
+    // ---------- setup
+    int64_t lda = roundup( blas::max( 1, n ), align );
+    size_t size_A = (size_t) lda * n;
+
+    std::vector< scalar_t > A( size_A );
+    std::vector< scalar_t > Q( size_A );
+    std::vector< scalar_t > z( n );
+    std::vector< real_t > D_tst( n );
+    std::vector< real_t > D_ref( n );
+
+    lapack::generate_matrix( params.matrix, n, n, &A[0], lda );
+    int64_t idist = 1;
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+    lapack::larnv( idist, iseed, z.size(), &z[0] );
+
+    // input eigendecomposition A = Q D Q^T
+    Q = A;
+    int64_t info = lapack::syev( lapack::Job::Vec, lapack::Uplo::Lower, n,
+                                 &Q[0], lda, &D_tst[0] );
+    if (info != 0) {
+        fprintf( stderr, "lapack::syev returned error %lld\n", (lld) info );
+    }
+
+    // A_upd = A + rho z z^T, lower triangle
+    std::vector< scalar_t > A_upd = A;
+    blas::syr( blas::Layout::ColMajor, blas::Uplo::Lower, n,
+               rho, &z[0], 1, &A_upd[0], lda );
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A n=%5lld, lda=%5lld, rho=%.4g\n",
+                (lld) n, (lld) lda, double( rho ) );
+    }
+    if (verbose >= 2) {
+        printf( "D = " ); print_vector( n, &D_tst[0], 1 );
+        printf( "z = " ); print_vector( n, &z[0], 1 );
+    }
+
+    // test error exits
+    if (params.error_exit() == 'y') {
+        using lapack::Job;
+        assert_throw( lapack::syev_update( Job(0), n, &D_tst[0], &Q[0], lda, rho, &z[0] ), lapack::Error );
+        assert_throw( lapack::syev_update( jobz,  -1, &D_tst[0], &Q[0], lda, rho, &z[0] ), lapack::Error );
+        assert_throw( lapack::syev_update( jobz,   n, &D_tst[0], &Q[0], n-1, rho, &z[0] ), lapack::Error );
+    }
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+    info = lapack::syev_update( jobz, n, &D_tst[0], &Q[0], lda, rho, &z[0] );
+    time = testsweeper::get_wtime() - time;
+    if (info != 0) {
+        fprintf( stderr, "lapack::syev_update returned error %lld\n", (lld) info );
+    }
+    params.time() = time;
+
+    if (verbose >= 2) {
+        printf( "D_new = " ); print_vector( n, &D_tst[0], 1 );
+        if (jobz == lapack::Job::Vec) {
+            printf( "Q_new = " ); print_matrix( n, n, &Q[0], lda );
+        }
+    }
+
+    if (params.check() == 'y' || params.ref() == 'y') {
+        // ---------- run reference: eigendecomposition of updated A
+        std::vector< scalar_t > A_ref = A_upd;
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        int64_t info_ref = lapack::syevd( jobz, lapack::Uplo::Lower, n,
+                                          &A_ref[0], lda, &D_ref[0] );
+        params.ref_time() = testsweeper::get_wtime() - time;
+        if (info_ref != 0) {
+            fprintf( stderr, "lapack::syevd returned error %lld\n", (lld) info_ref );
+        }
+    }
+
+    if (params.check() == 'y') {
+        // ---------- check error
+        // eigenvalues compared to reference
+        real_t error2 = (info != 0 ? 1 : 0);
+        error2 += rel_error( D_tst, D_ref );
+        params.error2() = error2;
+        bool okay = (error2 < tol);
+
+        if (jobz == lapack::Job::Vec) {
+            // || A_upd Q - Q D ||_1 / (n ||A_upd||_1)
+            real_t Anorm = lapack::lansy( lapack::Norm::One, lapack::Uplo::Lower,
+                                          n, &A_upd[0], lda );
+            std::vector< scalar_t > W = Q;
+            col_scale( n, n, &W[0], lda, &D_tst[0] );
+            blas::symm( blas::Layout::ColMajor, blas::Side::Left,
+                        blas::Uplo::Lower, n, n,
+                        1.0, &A_upd[0], lda, &Q[0], lda, -1.0, &W[0], lda );
+            real_t error = lapack::lange( lapack::Norm::One, n, n, &W[0], lda );
+            if (Anorm > 0)
+                error /= (n * Anorm);
+
+            // || I - Q^T Q ||_1 / n
+            lapack::laset( lapack::MatrixType::Upper, n, n, 0.0, 1.0, &W[0], lda );
+            blas::syrk( blas::Layout::ColMajor, blas::Uplo::Upper, blas::Op::Trans,
+                        n, n, -1.0, &Q[0], lda, 1.0, &W[0], lda );
+            real_t ortho = lapack::lansy( lapack::Norm::One, lapack::Uplo::Upper,
+                                          n, &W[0], lda );
+            if (n > 0)
+                ortho /= n;
+
+            params.error() = error;
+            params.ortho() = ortho;
+            okay = okay && (error < tol) && (ortho < tol);
+        }
+        params.okay() = okay;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_syev_update( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_syev_update_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_syev_update_work< double >( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unsupported datatype" );
+            break;
+    }
+}